@@ -1,9 +1,10 @@
 import re
 
-def generate_emoji_header(input_file, output_file):
+
+def parse_emoji_sequences(input_file):
     """
-    Parses the emoji-test.txt file and generates a C++ header file
-    with a set of emoji code points.
+    Parses the emoji-test.txt file and returns the set of fully- and
+    minimally-qualified emoji sequences as tuples of code points.
     """
     emoji_sequences = set()
 
@@ -28,22 +29,121 @@ def generate_emoji_header(input_file, output_file):
                     code_points = tuple(int(cp, 16) for cp in code_points_str.split())
                     emoji_sequences.add(code_points)
 
+    return emoji_sequences
+
+
+def build_trie(sequences):
+    """
+    Builds a prefix tree over the given symbol sequences and flattens it
+    breadth-first. Children of a node get consecutive indices in that order,
+    so the node reached by edge e is always node e + 1 and only the per-node
+    edge offsets, the edge symbols and the terminal flags need to be stored.
+    """
+    root = {"children": {}, "terminal": False}
+    for sequence in sequences:
+        node = root
+        for symbol in sequence:
+            node = node["children"].setdefault(symbol, {"children": {}, "terminal": False})
+        node["terminal"] = True
+
+    edge_offsets = []
+    symbols = []
+    terminal = []
+    order = [root]
+    for node in order:
+        edge_offsets.append(len(symbols))
+        terminal.append(node["terminal"])
+        for symbol in sorted(node["children"]):
+            symbols.append(symbol)
+            order.append(node["children"][symbol])
+    edge_offsets.append(len(symbols))
+
+    # Offsets are stored as uint16_t
+    assert len(symbols) < 0x10000
+    return edge_offsets, symbols, terminal
+
+
+def build_start_bitmap(sequences):
+    """
+    Builds a two-level bitmap of the code points that can begin an emoji
+    sequence. The first level maps each 256-code-point block to one of a few
+    distinct 256-bit blocks in the second level; block 0 is all zeros and is
+    shared by every block without a starter. Blocks past the last starter are
+    left out of the first level entirely.
+    """
+    starters = {sequence[0] for sequence in sequences}
+    last_block = max(starters) >> 8
+
+    blocks = [(0,) * 8]
+    block_ids = {blocks[0]: 0}
+    block_index = []
+    for block in range(last_block + 1):
+        words = [0] * 8
+        for code_point in starters:
+            if code_point >> 8 == block:
+                low = code_point & 0xFF
+                words[low >> 5] |= 1 << (low & 31)
+        words = tuple(words)
+        if words not in block_ids:
+            block_ids[words] = len(blocks)
+            blocks.append(words)
+        block_index.append(block_ids[words])
+
+    # Block ids are stored as uint8_t
+    assert len(blocks) <= 0x100
+    return block_index, [word for block in blocks for word in block]
+
+
+def write_array(f, declaration, values, per_line, formatter):
+    f.write(f"constexpr {declaration}[] = {{\n")
+    for start in range(0, len(values), per_line):
+        chunk = values[start:start + per_line]
+        f.write("    " + ", ".join(formatter(value) for value in chunk))
+        f.write(",\n" if start + per_line < len(values) else "\n")
+    f.write("};\n\n")
+
+
+def write_trie(f, name, symbol_type, symbol_format, symbols_per_line, trie):
+    edge_offsets, symbols, terminal = trie
+    write_array(f, f"uint16_t {name}_EDGE_OFFSETS", edge_offsets, 12, str)
+    write_array(f, f"{symbol_type} {name}_SYMBOLS", symbols, symbols_per_line, symbol_format)
+    write_array(f, f"bool {name}_TERMINAL", terminal, 12,
+                lambda value: "true" if value else "false")
+
+
+def generate_emoji_header(input_file, output_file):
+    """
+    Generates a C++ header with the emoji sequences compiled into two prefix
+    trees, one over code points and one over their UTF-8 bytes, plus a bitmap
+    of the code points that can begin a sequence. Every table
+    is a flat constexpr array, so it lives in read-only data and needs no
+    initialization at startup.
+    """
+    emoji_sequences = sorted(parse_emoji_sequences(input_file))
+    utf8_sequences = sorted(
+        tuple("".join(chr(cp) for cp in sequence).encode("utf-8")) for sequence in emoji_sequences
+    )
+
     with open(output_file, "w") as f:
+        f.write("// Generated by generate_emoji_header.py from emoji-test.txt. Do not edit.\n")
+        f.write("//\n")
+        f.write("// Each trie is flattened breadth-first: the edges of node n are the symbols in\n")
+        f.write("// [EDGE_OFFSETS[n], EDGE_OFFSETS[n + 1]), sorted ascending, and edge e leads to\n")
+        f.write("// node e + 1. Node 0 is the root; TERMINAL[n] marks complete emoji sequences.\n\n")
         f.write("#ifndef NEJ_EMOJI_DATA_H\n")
         f.write("#define NEJ_EMOJI_DATA_H\n\n")
-        f.write("#include <cstdint>\n")
-        f.write("#include <set>\n")
-        f.write("#include <vector>\n\n")
-        f.write("const std::set<std::vector<uint32_t>> EMOJI_SEQUENCES = {\n")
-        for i, emoji_sequence in enumerate(sorted(list(emoji_sequences))):
-            f.write("    {")
-            f.write(", ".join(f"0x{cp:04X}" for cp in emoji_sequence))
-            f.write("}")
-            if i < len(emoji_sequences) - 1:
-                f.write(",")
-            f.write("\n")
-        f.write("};\n\n")
+        f.write("#include <cstdint>\n\n")
+        block_index, bits = build_start_bitmap(emoji_sequences)
+        f.write("// Code points that can begin an emoji sequence: bit (cp & 0xFF) of the 256-bit block\n")
+        f.write("// EMOJI_START_BITS[EMOJI_START_BLOCK_INDEX[cp >> 8] * 8 ...], for cp >> 8 within the index.\n")
+        write_array(f, "uint8_t EMOJI_START_BLOCK_INDEX", block_index, 16, str)
+        write_array(f, "uint32_t EMOJI_START_BITS", bits, 8, lambda word: f"0x{word:08X}")
+        write_trie(f, "EMOJI_CODE_POINT_TRIE", "uint32_t", lambda cp: f"0x{cp:04X}", 8,
+                   build_trie(emoji_sequences))
+        write_trie(f, "EMOJI_BYTE_TRIE", "uint8_t", lambda byte: f"0x{byte:02X}", 12,
+                   build_trie(utf8_sequences))
         f.write("#endif  // NEJ_EMOJI_DATA_H\n")
 
+
 if __name__ == "__main__":
-    generate_emoji_header("emoji-test.txt", "src/emoji_data.h")
\ No newline at end of file
+    generate_emoji_header("emoji-test.txt", "src/emoji_data.h")
@@ -0,0 +1,230 @@
+#include "clean_cache.h"
+
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#include "core.h"
+#include "file_io.h"
+
+namespace {
+
+// Bumped whenever the file layout, or what counts as clean, changes
+constexpr int CACHE_FORMAT_VERSION = 1;
+
+// Files modified less than this long before the run started are not recorded. Covers file systems
+// with coarse timestamps and a file system clock that lags the system clock.
+constexpr int64_t SETTLE_TIME_NS = 2'000'000'000;
+
+auto headerLine() -> std::string {
+    char version[16];
+    auto result = std::to_chars(version, version + sizeof(version), emojiTableVersion(), 16);
+    return "nej-clean-cache " + std::to_string(CACHE_FORMAT_VERSION) + " " +
+           std::string(version, result.ptr) + "\n";
+}
+
+// Absolute form of `file_path`, so that runs from different directories share entries
+auto cacheKey(const std::string& file_path) -> std::string {
+    std::error_code error;
+    std::filesystem::path absolute = std::filesystem::absolute(file_path, error);
+    return error ? file_path : absolute.lexically_normal().string();
+}
+
+// Modification time in nanoseconds since the epoch. macOS names the field differently.
+auto modificationTimeNs(const struct stat& status) -> int64_t {
+#ifdef __APPLE__
+    const struct timespec& mtime = status.st_mtimespec;
+#else
+    const struct timespec& mtime = status.st_mtim;
+#endif
+    return static_cast<int64_t>(mtime.tv_sec) * 1'000'000'000 + mtime.tv_nsec;
+}
+
+auto mix(uint64_t hash, uint64_t word) -> uint64_t {
+    hash ^= word * 0x9e3779b97f4a7c15ULL;
+    hash = (hash << 31) | (hash >> 33);
+    return hash * 0xbf58476d1ce4e5b9ULL;
+}
+
+// Parses the space-terminated number at `pos`, moving past it
+template <typename Number>
+auto parseField(std::string_view text, size_t& pos, Number& value, int base = 10) -> bool {
+    auto result = std::from_chars(text.data() + pos, text.data() + text.size(), value, base);
+    if (result.ec != std::errc() || result.ptr == text.data() + text.size() || *result.ptr != ' ') {
+        return false;
+    }
+    pos = static_cast<size_t>(result.ptr - text.data()) + 1;
+    return true;
+}
+
+template <typename Number>
+void appendField(std::string& text, Number value, int base = 10) {
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value, base);
+    text.append(digits, result.ptr);
+    text += ' ';
+}
+
+}  // namespace
+
+auto contentHash(std::string_view content) -> uint64_t {
+    uint64_t hash = mix(0, content.size());
+    size_t pos = 0;
+    for (; pos + sizeof(uint64_t) <= content.size(); pos += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        std::memcpy(&word, content.data() + pos, sizeof(word));
+        hash = mix(hash, word);
+    }
+    if (pos < content.size()) {
+        uint64_t tail = 0;
+        std::memcpy(&tail, content.data() + pos, content.size() - pos);
+        hash = mix(hash, tail);
+    }
+
+    // Final avalanche, so every input bit affects every output bit
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+CleanCache::CleanCache()
+    : run_start_ns_(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::system_clock::now().time_since_epoch())
+                        .count()) {}
+
+auto CleanCache::load(const std::string& path) -> bool {
+    path_ = path;
+    InputFile file;
+    if (!file.open(path.c_str())) {
+        return errno == ENOENT;
+    }
+
+    // Records are "device inode size mtime hash length path", with numbers in decimal apart from
+    // the hexadecimal hash, and the path taken as the next `length` bytes
+    std::string_view text = file.content();
+    std::string header = headerLine();
+    if (text.substr(0, header.size()) != header) {
+        return true;
+    }
+    std::unordered_map<std::string, Entry> entries;
+    size_t pos = header.size();
+    while (pos < text.size()) {
+        Entry entry;
+        size_t length = 0;
+        if (!parseField(text, pos, entry.device) || !parseField(text, pos, entry.inode) ||
+            !parseField(text, pos, entry.size) || !parseField(text, pos, entry.mtime_ns) ||
+            !parseField(text, pos, entry.hash, 16) || !parseField(text, pos, length) ||
+            length >= text.size() - pos || text[pos + length] != '\n') {
+            return true;  // Damaged; start over
+        }
+        entries[std::string(text.substr(pos, length))] = entry;
+        pos += length + 1;
+    }
+    entries_ = std::move(entries);
+    return true;
+}
+
+auto CleanCache::isClean(const std::string& file_path, const struct stat& status,
+                         std::string_view content) -> bool {
+    if (!S_ISREG(status.st_mode)) {
+        return false;
+    }
+    std::string key = cacheKey(file_path);
+    Entry current = entryFor(status);
+    Entry recorded;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto found = entries_.find(key);
+        if (found == entries_.end()) {
+            return false;
+        }
+        recorded = found->second;
+    }
+    if (current.device == recorded.device && current.inode == recorded.inode &&
+        current.size == recorded.size && current.mtime_ns == recorded.mtime_ns) {
+        return true;
+    }
+
+    // Rewritten or touched, as by a checkout: the same content is still clean
+    bool same_content = current.size == recorded.size && content.size() == current.size &&
+                        contentHash(content) == recorded.hash;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!same_content) {
+        entries_.erase(key);
+        changed_ = true;
+    } else if (isSettled(current)) {
+        current.hash = recorded.hash;
+        entries_[key] = current;
+        changed_ = true;
+    }
+    return same_content;
+}
+
+void CleanCache::recordClean(const std::string& file_path, const struct stat& status,
+                             std::string_view content) {
+    Entry entry = entryFor(status);
+    if (!S_ISREG(status.st_mode) || content.size() != entry.size || !isSettled(entry)) {
+        return;
+    }
+    entry.hash = contentHash(content);
+    std::string key = cacheKey(file_path);
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_[key] = entry;
+    changed_ = true;
+}
+
+auto CleanCache::save() -> bool {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Files that were deleted or moved away since they were recorded are dropped, so the cache
+    // does not keep growing with churn in the tree
+    for (auto entry = entries_.begin(); entry != entries_.end();) {
+        struct stat status {};
+        if (lstat(entry->first.c_str(), &status) != 0 && (errno == ENOENT || errno == ENOTDIR)) {
+            entry = entries_.erase(entry);
+            changed_ = true;
+        } else {
+            ++entry;
+        }
+    }
+    if (!changed_) {
+        return true;
+    }
+    std::string text = headerLine();
+    for (const auto& [key, entry] : entries_) {
+        appendField(text, entry.device);
+        appendField(text, entry.inode);
+        appendField(text, entry.size);
+        appendField(text, entry.mtime_ns);
+        appendField(text, entry.hash, 16);
+        appendField(text, key.size());
+        text += key;
+        text += '\n';
+    }
+
+    ReplacementFile replacement;
+    if (!replacement.open(path_) || !writeAll(replacement.get(), text) ||
+        !replacement.commit("")) {
+        return false;
+    }
+    changed_ = false;
+    return true;
+}
+
+auto CleanCache::entryFor(const struct stat& status) -> Entry {
+    Entry entry;
+    entry.device = static_cast<uint64_t>(status.st_dev);
+    entry.inode = static_cast<uint64_t>(status.st_ino);
+    entry.size = static_cast<uint64_t>(status.st_size);
+    entry.mtime_ns = modificationTimeNs(status);
+    return entry;
+}
+
+// True if the file was last modified well before the run started, so that any later change is
+// bound to show in its metadata
+auto CleanCache::isSettled(const Entry& entry) const -> bool {
+    return entry.mtime_ns < run_start_ns_ - SETTLE_TIME_NS;
+}
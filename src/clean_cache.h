@@ -0,0 +1,64 @@
+#ifndef NEJ_CLEAN_CACHE_H
+#define NEJ_CLEAN_CACHE_H
+
+#include <sys/stat.h>
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Function to hash file content for CleanCache. Not cryptographic, but fast enough that checking a
+// file against its recorded hash costs less than scanning it for emojis.
+auto contentHash(std::string_view content) -> uint64_t;
+
+// Persistent record of the files that processing would leave unchanged, so that later runs can skip
+// them without reading them. A file counts as unchanged while its device, inode, size and
+// modification time all match what was recorded; when only the size matches, the file is hashed
+// and compared with the recorded hash instead of being scanned. Files modified shortly before the
+// run started are not recorded, since a second change within the same timestamp tick would go
+// unnoticed. The whole cache is discarded when the emoji tables change. Safe to use from several
+// threads at once.
+class CleanCache {
+   public:
+    CleanCache();
+
+    // Reads the cache saved at `path`, which save() later writes back. A cache that does not exist
+    // yet, is damaged or was saved with different emoji tables starts out empty. Returns false
+    // with errno set if the file exists but cannot be read.
+    auto load(const std::string& path) -> bool;
+
+    // True if the regular file at `file_path`, opened with the given status, is known to be clean.
+    // `content` is the whole file and is only read when the recorded metadata no longer matches.
+    auto isClean(const std::string& file_path, const struct stat& status, std::string_view content)
+        -> bool;
+
+    // Records that the regular file at `file_path`, with the given status and content, is clean
+    void recordClean(const std::string& file_path, const struct stat& status,
+                     std::string_view content);
+
+    // Drops the entries of files that no longer exist and writes the cache back if it changed,
+    // replacing the old one atomically. Returns false with errno set on failure.
+    auto save() -> bool;
+
+   private:
+    struct Entry {
+        uint64_t device = 0;
+        uint64_t inode = 0;
+        uint64_t size = 0;
+        int64_t mtime_ns = 0;
+        uint64_t hash = 0;
+    };
+
+    static auto entryFor(const struct stat& status) -> Entry;
+    [[nodiscard]] auto isSettled(const Entry& entry) const -> bool;
+
+    std::string path_;
+    int64_t run_start_ns_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    bool changed_ = false;
+};
+
+#endif  // NEJ_CLEAN_CACHE_H
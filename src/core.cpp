@@ -2,15 +2,404 @@
 
 #include <algorithm>
 #include <fstream>
-#include <iterator>
+#include <iterator>  // For std::size
+#include <string_view>
 #include <utility>  // For std::pair
 #include <vector>
 
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 #include "emoji_data.h"
 
 // Constants for file processing
 const size_t FILE_BUFFER_SIZE = 4096;  // Check first 4KB
 
+namespace {
+
+// Prefix tree over the symbols of every emoji sequence, either code points or the bytes of their
+// UTF-8 encoding. The tree is compiled by generate_emoji_header.py into flat constexpr arrays, so
+// this is only a view over read-only data and costs nothing at startup. Each node's outgoing edges
+// are contiguous and sorted by symbol, so following an edge is a binary search over a handful of
+// entries. Matching walks the tree one symbol at a time and stops as soon as no sequence can
+// continue, which caps the lookahead at the longest emoji sequence.
+template <typename Symbol>
+class SequenceTrie {
+   public:
+    static constexpr uint32_t NO_NODE = UINT32_MAX;
+    static constexpr uint32_t ROOT = 0;
+
+    constexpr SequenceTrie(const uint16_t* edge_offsets, const Symbol* symbols,
+                           const bool* terminal)
+        : edge_offsets_(edge_offsets), symbols_(symbols), terminal_(terminal) {}
+
+    // Returns the node reached from `node` by `symbol`, or NO_NODE if no sequence continues
+    [[nodiscard]] auto child(uint32_t node, Symbol symbol) const -> uint32_t {
+        const Symbol* first = symbols_ + edge_offsets_[node];
+        const Symbol* last = symbols_ + edge_offsets_[node + 1];
+        const Symbol* found = std::lower_bound(first, last, symbol);
+        if (found == last || *found != symbol) {
+            return NO_NODE;
+        }
+        // Nodes are laid out breadth-first, so edge e always leads to node e + 1
+        return static_cast<uint32_t>(found - symbols_) + 1;
+    }
+
+    // True if some longer sequence continues past `node`
+    [[nodiscard]] auto hasChildren(uint32_t node) const -> bool {
+        return edge_offsets_[node + 1] != edge_offsets_[node];
+    }
+
+    // True if the path from the root to `node` spells a complete emoji sequence
+    [[nodiscard]] auto isTerminal(uint32_t node) const -> bool { return terminal_[node]; }
+
+   private:
+    const uint16_t* edge_offsets_;
+    const Symbol* symbols_;
+    const bool* terminal_;
+};
+
+using CodePointTrie = SequenceTrie<uint32_t>;
+using ByteTrie = SequenceTrie<uint8_t>;
+
+constexpr CodePointTrie CODE_POINT_TRIE(EMOJI_CODE_POINT_TRIE_EDGE_OFFSETS,
+                                        EMOJI_CODE_POINT_TRIE_SYMBOLS,
+                                        EMOJI_CODE_POINT_TRIE_TERMINAL);
+constexpr ByteTrie BYTE_TRIE(EMOJI_BYTE_TRIE_EDGE_OFFSETS, EMOJI_BYTE_TRIE_SYMBOLS,
+                             EMOJI_BYTE_TRIE_TERMINAL);
+
+// FNV-1a hash of the byte trie, which spells out every sequence, computed at compile time
+constexpr auto hashByteTrie() -> uint64_t {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    auto mix = [&hash](uint64_t value) {
+        hash ^= value;
+        hash *= 0x100000001b3ULL;
+    };
+    for (uint16_t offset : EMOJI_BYTE_TRIE_EDGE_OFFSETS) {
+        mix(offset);
+    }
+    for (uint8_t symbol : EMOJI_BYTE_TRIE_SYMBOLS) {
+        mix(symbol);
+    }
+    for (bool terminal : EMOJI_BYTE_TRIE_TERMINAL) {
+        mix(terminal ? 1 : 0);
+    }
+    return hash;
+}
+
+constexpr uint64_t EMOJI_TABLE_VERSION = hashByteTrie();
+
+// True if some emoji sequence begins with `code_point`. Looks the code point up in the generated
+// two-level bitmap, so text in other scripts is rejected without touching the sequence tables.
+constexpr auto canStartEmoji(uint32_t code_point) -> bool {
+    uint32_t block = code_point >> 8;
+    if (block >= std::size(EMOJI_START_BLOCK_INDEX)) {
+        return false;
+    }
+    uint32_t word =
+        EMOJI_START_BITS[EMOJI_START_BLOCK_INDEX[block] * 8 + ((code_point & 0xFF) >> 5)];
+    return ((word >> (code_point & 31)) & 1) != 0;
+}
+
+// Table of the bytes that the byte trie's root has an edge for, that is the first bytes of every
+// emoji sequence's encoding, computed at compile time
+struct ByteStartTable {
+    bool starts[256] = {};
+
+    constexpr ByteStartTable() {
+        for (uint16_t edge = EMOJI_BYTE_TRIE_EDGE_OFFSETS[0]; edge < EMOJI_BYTE_TRIE_EDGE_OFFSETS[1];
+             ++edge) {
+            starts[EMOJI_BYTE_TRIE_SYMBOLS[edge]] = true;
+        }
+    }
+};
+
+constexpr ByteStartTable BYTE_START_TABLE;
+
+// True if some emoji sequence's UTF-8 encoding begins with `byte`. Lets the byte engine pass over
+// the characters of other scripts without searching the trie, as canStartEmoji does for the code
+// point engine.
+constexpr auto canStartEmojiBytes(uint8_t byte) -> bool { return BYTE_START_TABLE.starts[byte]; }
+
+// Returns the first byte in [first, last) that is not ASCII, or `last` if there is none. Scans 32
+// bytes at a time with AVX2 when the build enables it, 16 at a time with the SSE2 baseline, and
+// finishes the tail one byte at a time.
+auto findNonAscii(const char* first, const char* last) -> const char* {
+#if defined(__AVX2__)
+    while (last - first >= 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(chunk));
+        if (mask != 0) {
+            return first + __builtin_ctz(mask);
+        }
+        first += 32;
+    }
+#endif
+#if defined(__SSE2__)
+    while (last - first >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(chunk));
+        if (mask != 0) {
+            return first + __builtin_ctz(mask);
+        }
+        first += 16;
+    }
+#endif
+    while (first != last && static_cast<uint8_t>(*first) < 0x80) {
+        ++first;
+    }
+    return first;
+}
+
+// Returns the end of the run starting at `pos` that can be copied to the output untouched. The run
+// covers every ASCII byte up to the next non-ASCII one, except that an ASCII byte directly in front
+// of non-ASCII input is left to the matcher: keycap sequences such as "#\uFE0F\u20E3" start with
+// ASCII, and every sequence that does continues with a non-ASCII code point. Unless `is_final` is
+// set, a starter at the very end is left too, since the next block may continue it.
+auto asciiRunEnd(std::string_view text, size_t pos, bool is_final) -> size_t {
+    const char* data = text.data();
+    auto run_end = static_cast<size_t>(findNonAscii(data + pos, data + text.size()) - data);
+    if (run_end > pos && (run_end < text.size() || !is_final) &&
+        canStartEmoji(static_cast<uint8_t>(text[run_end - 1]))) {
+        --run_end;
+    }
+    return run_end;
+}
+
+// Outcome of examining one UTF-8 character
+enum class DecodeStatus {
+    Ok,
+    Malformed,  // Invalid, overlong or surrogate byte sequence
+    Truncated,  // Well-formed so far, but the text ends before the character does
+};
+
+// Measures the UTF-8 character starting at `text[pos]`, setting `length` when it is well-formed.
+// Follows the byte ranges of Unicode Table 3-7, so overlong forms, surrogates and values above
+// U+10FFFF are rejected without decoding.
+auto measureCharacter(std::string_view text, size_t pos, size_t& length) -> DecodeStatus {
+    auto lead = static_cast<uint8_t>(text[pos]);
+    if (lead < 0x80) {
+        length = 1;
+        return DecodeStatus::Ok;
+    }
+
+    size_t expected_length = 0;
+    uint8_t low = 0x80;  // Allowed range of the second byte; later bytes are always 80..BF
+    uint8_t high = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        expected_length = 2;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        expected_length = 3;
+        low = lead == 0xE0 ? 0xA0 : 0x80;
+        high = lead == 0xED ? 0x9F : 0xBF;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        expected_length = 4;
+        low = lead == 0xF0 ? 0x90 : 0x80;
+        high = lead == 0xF4 ? 0x8F : 0xBF;
+    } else {
+        return DecodeStatus::Malformed;
+    }
+
+    for (size_t i = 1; i < expected_length; ++i) {
+        if (pos + i >= text.size()) {
+            return DecodeStatus::Truncated;
+        }
+        auto byte = static_cast<uint8_t>(text[pos + i]);
+        if (byte < low || byte > high) {
+            return DecodeStatus::Malformed;
+        }
+        low = 0x80;
+        high = 0xBF;
+    }
+    length = expected_length;
+    return DecodeStatus::Ok;
+}
+
+// Decodes the UTF-8 character starting at `text[pos]` into `code_point` and its byte `length`.
+// Reports malformed input through the status instead of throwing, so stray bytes cost no more
+// than well-formed ones.
+auto decodeCharacter(std::string_view text, size_t pos, uint32_t& code_point, size_t& length)
+    -> DecodeStatus {
+    static constexpr uint8_t LEAD_BYTE_MASK[] = {0x00, 0x7F, 0x1F, 0x0F, 0x07};
+
+    DecodeStatus status = measureCharacter(text, pos, length);
+    if (status != DecodeStatus::Ok) {
+        return status;
+    }
+    code_point = static_cast<uint8_t>(text[pos]) & LEAD_BYTE_MASK[length];
+    for (size_t i = 1; i < length; ++i) {
+        code_point = (code_point << 6) | (static_cast<uint8_t>(text[pos + i]) & 0x3F);
+    }
+    return DecodeStatus::Ok;
+}
+
+// A stretch of input that the output does not copy through: an emoji sequence, which becomes a
+// single space, or a malformed byte, which becomes '?'. Everything between changes is copied as is.
+// A Pending change marks where a block ends before the matcher could decide; the bytes from its
+// offset on have to be examined again together with the next block.
+struct Change {
+    enum class Kind { None, Emoji, Malformed, Pending };
+
+    Kind kind;
+    size_t offset;
+    size_t length;
+
+    [[nodiscard]] auto replacement() const -> char { return kind == Kind::Emoji ? ' ' : '?'; }
+};
+
+// Byte engine: walks the byte trie directly over the input and only validates everything else,
+// so no code point is ever decoded.
+auto findNextChangeByBytes(std::string_view text, size_t pos, bool is_final) -> Change {
+    const ByteTrie& trie = BYTE_TRIE;
+
+    while (true) {
+        pos = asciiRunEnd(text, pos, is_final);
+        if (pos == text.size()) {
+            return {Change::Kind::None, pos, 0};
+        }
+
+        // Only lead bytes that can begin a sequence go on to touch the trie
+        size_t matched_length = 0;
+        uint32_t node = canStartEmojiBytes(static_cast<uint8_t>(text[pos])) ? ByteTrie::ROOT
+                                                                            : ByteTrie::NO_NODE;
+        for (size_t lookahead = pos; node != ByteTrie::NO_NODE && trie.hasChildren(node);
+             ++lookahead) {
+            if (lookahead == text.size()) {
+                // A longer sequence may still follow in the next block
+                if (!is_final) {
+                    return {Change::Kind::Pending, pos, 0};
+                }
+                break;
+            }
+            node = trie.child(node, static_cast<uint8_t>(text[lookahead]));
+            if (node == ByteTrie::NO_NODE) {
+                break;
+            }
+            if (trie.isTerminal(node)) {
+                matched_length = lookahead + 1 - pos;
+            }
+        }
+        if (matched_length != 0) {
+            return {Change::Kind::Emoji, pos, matched_length};
+        }
+
+        size_t length = 0;
+        DecodeStatus status = measureCharacter(text, pos, length);
+        if (status == DecodeStatus::Truncated && !is_final) {
+            return {Change::Kind::Pending, pos, 0};
+        }
+        if (status != DecodeStatus::Ok) {
+            return {Change::Kind::Malformed, pos, 1};
+        }
+        pos += length;
+    }
+}
+
+// Code point engine: decodes the input and walks the code point trie, entering it only for code
+// points that can begin a sequence.
+auto findNextChangeByCodePoints(std::string_view text, size_t pos, bool is_final) -> Change {
+    const CodePointTrie& trie = CODE_POINT_TRIE;
+
+    while (true) {
+        pos = asciiRunEnd(text, pos, is_final);
+        if (pos == text.size()) {
+            return {Change::Kind::None, pos, 0};
+        }
+
+        uint32_t first_code_point = 0;
+        size_t first_length = 0;
+        DecodeStatus status = decodeCharacter(text, pos, first_code_point, first_length);
+        if (status == DecodeStatus::Truncated && !is_final) {
+            return {Change::Kind::Pending, pos, 0};
+        }
+        if (status != DecodeStatus::Ok) {
+            return {Change::Kind::Malformed, pos, 1};
+        }
+
+        // Only code points that can begin a sequence go on to touch the trie
+        if (!canStartEmoji(first_code_point)) {
+            pos += first_length;
+            continue;
+        }
+
+        uint32_t node = trie.child(CodePointTrie::ROOT, first_code_point);
+        size_t lookahead = pos + first_length;
+        size_t matched_end = trie.isTerminal(node) ? lookahead : pos;
+
+        // Try to match the longest possible emoji sequence, stopping as soon as no sequence in
+        // the trie can continue or the input is malformed
+        while (trie.hasChildren(node)) {
+            if (lookahead == text.size()) {
+                // A longer sequence may still follow in the next block
+                if (!is_final) {
+                    return {Change::Kind::Pending, pos, 0};
+                }
+                break;
+            }
+            uint32_t code_point = 0;
+            size_t length = 0;
+            status = decodeCharacter(text, lookahead, code_point, length);
+            if (status == DecodeStatus::Truncated && !is_final) {
+                return {Change::Kind::Pending, pos, 0};
+            }
+            if (status != DecodeStatus::Ok) {
+                break;
+            }
+            node = trie.child(node, code_point);
+            if (node == CodePointTrie::NO_NODE) {
+                break;
+            }
+            lookahead += length;
+
+            // Check if the current sequence is an emoji
+            if (trie.isTerminal(node)) {
+                matched_end = lookahead;
+            }
+        }
+        if (matched_end != pos) {
+            return {Change::Kind::Emoji, pos, matched_end - pos};
+        }
+        pos += first_length;
+    }
+}
+
+// Returns the first change at or after `pos`, or one of kind None at the end of `text`
+auto findNextChange(std::string_view text, size_t pos, bool is_final, MatchEngine engine)
+    -> Change {
+    return engine == MatchEngine::Byte ? findNextChangeByBytes(text, pos, is_final)
+                                       : findNextChangeByCodePoints(text, pos, is_final);
+}
+
+// Applies `change` and every change after it to `text`, appending the result to `output`, or only
+// counting emoji sequences if `output` is null. Untouched input between changes is appended as one
+// span, so output is only written piecewise at emoji and malformed-byte boundaries. Stops before a
+// pending change.
+auto applyChanges(std::string_view text, Change change, bool is_final, MatchEngine engine,
+                  std::string* output) -> BlockResult {
+    BlockResult result;
+    size_t span_start = 0;
+    while (true) {
+        if (output != nullptr) {
+            output->append(text, span_start, change.offset - span_start);
+        }
+        if (change.kind == Change::Kind::None || change.kind == Change::Kind::Pending) {
+            result.consumed = change.offset;
+            return result;
+        }
+        if (output != nullptr) {
+            *output += change.replacement();
+        }
+        if (change.kind == Change::Kind::Emoji) {
+            result.removed_emoji_count++;
+        }
+        span_start = change.offset + change.length;
+        change = findNextChange(text, span_start, is_final, engine);
+    }
+}
+
+}  // namespace
+
 // Function to check if a file is likely binary
 auto isBinary(const fs::path& file_path) -> bool {
     std::ifstream file(file_path, std::ios::binary);
@@ -20,64 +409,126 @@ auto isBinary(const fs::path& file_path) -> bool {
 
     std::vector<char> buffer(FILE_BUFFER_SIZE);  // Check first 4KB
     file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
-    std::streamsize bytes_read = file.gcount();
+    return isBinaryContent(std::string_view(buffer.data(), static_cast<size_t>(file.gcount())));
+}
 
-    for (std::streamsize i = 0; i < bytes_read; ++i) {
-        if (buffer[i] == 0) {  // Null byte found
-            return true;
-        }
-    }
-    return false;
+// Function to check if the start of a file's content looks binary
+auto isBinaryContent(std::string_view head) -> bool {
+    // Null byte found in the first 4KB
+    return head.substr(0, FILE_BUFFER_SIZE).find('\0') != std::string_view::npos;
 }
 
 // Function to remove emojis from a UTF-8 string
-auto removeEmojis(const std::string& text) -> std::pair<std::string, int> {
-    std::string result;
-    int removed_emoji_count = 0;
-
-    auto it = text.begin();
-    auto end = text.end();
-
-    while (it != end) {
-        auto start_of_sequence = it;
-        std::vector<uint32_t> current_sequence;
-        auto lookahead_it = it;
-        auto matched_end_it = it;
-        bool found_emoji = false;
-
-        // Try to match the longest possible emoji sequence
-        while (lookahead_it != end) {
-            try {
-                uint32_t code_point = utf8::next(lookahead_it, end);
-                current_sequence.push_back(code_point);
-
-                // Check if the current sequence is an emoji
-                if (EMOJI_SEQUENCES.count(current_sequence) != 0) {
-                    matched_end_it = lookahead_it;
-                    found_emoji = true;
-                }
-            } catch (const utf8::exception&) {
-                // Invalid UTF-8 sequence, stop lookahead
-                break;
-            }
+auto removeEmojis(const std::string& text, MatchEngine engine) -> std::pair<std::string, int> {
+    EmojiRemoval removal = removeEmojisIfPresent(text, engine);
+    if (!removal.changed) {
+        return {text, 0};
+    }
+    return {std::move(removal.text), removal.removed_emoji_count};
+}
+
+// Function to remove emojis from a UTF-8 string, allocating only once the first change is found
+auto removeEmojisIfPresent(std::string_view text, MatchEngine engine) -> EmojiRemoval {
+    Change change = findNextChange(text, 0, true, engine);
+    if (change.kind == Change::Kind::None) {
+        return {};
+    }
+
+    EmojiRemoval removal;
+    removal.changed = true;
+    removal.text.reserve(text.size());  // Output is never longer than the input
+    removal.removed_emoji_count = static_cast<int>(
+        applyChanges(text, change, true, engine, &removal.text).removed_emoji_count);
+    return removal;
+}
+
+// Function to find the first byte that removeEmojis would change
+auto findFirstChange(std::string_view text, MatchEngine engine) -> size_t {
+    Change change = findNextChange(text, 0, true, engine);
+    return change.kind == Change::Kind::None ? std::string_view::npos : change.offset;
+}
+
+// Function to count the emojis in a UTF-8 string without building any output
+auto countEmojis(std::string_view text, MatchEngine engine) -> uint64_t {
+    return countEmojisInBlock(text, true, engine).removed_emoji_count;
+}
+
+// Function to find where a UTF-8 string can be cut without changing the output
+auto findSafeSplit(std::string_view text, size_t pos) -> size_t {
+    if (pos == 0) {
+        return 0;
+    }
+    // No UTF-8 character or emoji sequence continues past an ASCII byte, and the only sequences
+    // that start with one are keycaps
+    for (; pos < text.size(); ++pos) {
+        auto previous = static_cast<uint8_t>(text[pos - 1]);
+        if (previous < 0x80 && !canStartEmoji(previous)) {
+            return pos;
         }
+    }
+    return text.size();
+}
 
-        if (found_emoji) {
-            // An emoji sequence was found, replace it with a single space
-            result += ' ';
-            removed_emoji_count++;
-            it = matched_end_it;
-        } else {
-            // No emoji sequence found, append the current character
-            try {
-                uint32_t code_point = utf8::next(it, end);
-                utf8::append(code_point, std::back_inserter(result));
-            } catch (const utf8::exception&) {
-                // Invalid UTF-8 character, append replacement character
-                result += '?';
-                ++it;
-            }
+// Function to identify the emoji tables this build was generated from
+auto emojiTableVersion() -> uint64_t { return EMOJI_TABLE_VERSION; }
+
+// Function to remove emojis from one block of a larger UTF-8 input
+auto removeEmojisFromBlock(std::string_view block, bool is_final, std::string& output,
+                           MatchEngine engine) -> BlockResult {
+    return applyChanges(block, findNextChange(block, 0, is_final, engine), is_final, engine,
+                        &output);
+}
+
+// Function to find the unchanged prefix of one block of a larger UTF-8 input
+auto findUnchangedPrefix(std::string_view block, bool is_final, MatchEngine engine) -> size_t {
+    return findNextChange(block, 0, is_final, engine).offset;
+}
+
+// Function to count the emojis in one block of a larger UTF-8 input
+auto countEmojisInBlock(std::string_view block, bool is_final, MatchEngine engine)
+    -> BlockResult {
+    return applyChanges(block, findNextChange(block, 0, is_final, engine), is_final, engine,
+                        nullptr);
+}
+
+// Bytes of a new chunk joined to the held-back tail of the previous one. Longer than any emoji
+// sequence, so the joined block always decides the tail unless the chunk itself is shorter.
+const size_t STREAM_STITCH_SIZE = 64;
+
+void EmojiStreamFilter::feed(std::string_view chunk, std::string* output) {
+    if (!pending_.empty()) {
+        size_t tail_size = pending_.size();
+        size_t stitched = std::min(chunk.size(), STREAM_STITCH_SIZE);
+        pending_.append(chunk.data(), stitched);
+        size_t consumed = process(pending_, false, output);
+        if (consumed < tail_size) {
+            // The whole chunk went into pending_ and still was not enough to decide
+            pending_.erase(0, consumed);
+            return;
         }
+        // Continue on the chunk itself from wherever the joined block stopped
+        chunk.remove_prefix(consumed - tail_size);
+        pending_.clear();
     }
-    return {result, removed_emoji_count};
-}
\ No newline at end of file
+
+    size_t consumed = process(chunk, false, output);
+    pending_.assign(chunk.data() + consumed, chunk.size() - consumed);
+}
+
+auto EmojiStreamFilter::unchangedPrefix(std::string_view chunk) const -> size_t {
+    return pending_.empty() ? findUnchangedPrefix(chunk, false, engine_) : 0;
+}
+
+void EmojiStreamFilter::finish(std::string* output) {
+    process(pending_, true, output);
+    pending_.clear();
+}
+
+auto EmojiStreamFilter::process(std::string_view block, bool is_final, std::string* output)
+    -> size_t {
+    BlockResult result = output != nullptr
+                             ? removeEmojisFromBlock(block, is_final, *output, engine_)
+                             : countEmojisInBlock(block, is_final, engine_);
+    removed_emoji_count_ += result.removed_emoji_count;
+    return result.consumed;
+}
@@ -1,23 +1,114 @@
 #ifndef NEJ_CORE_H
 #define NEJ_CORE_H
 
-#include <utf8.h>
-
 #include <cstdint>
 #include <filesystem>
-#include <set>
 #include <string>
-#include <vector>
+#include <string_view>
 
 namespace fs = std::filesystem;
 
-// Set of Unicode code points for emojis
-extern const std::set<std::vector<uint32_t>> EMOJI_SEQUENCES;
-
 // Function to check if a file is likely binary
 auto isBinary(const fs::path& file_path) -> bool;
 
+// Function to check if the start of a file's content looks binary, for callers that have already
+// read it. Only the first 4KB are examined.
+auto isBinaryContent(std::string_view head) -> bool;
+
+// Strategy used to find emoji sequences in the input
+enum class MatchEngine {
+    CodePoint,  // Decode UTF-8 and walk a trie of code points
+    Byte,       // Walk a trie compiled over the UTF-8 bytes of each sequence, without decoding
+};
+
 // Function to remove emojis from a UTF-8 string and return the count of removed emojis
-auto removeEmojis(const std::string& text) -> std::pair<std::string, int>;
+auto removeEmojis(const std::string& text, MatchEngine engine = MatchEngine::CodePoint)
+    -> std::pair<std::string, int>;
+
+// Result of removeEmojisIfPresent
+struct EmojiRemoval {
+    bool changed = false;         // False if the input had no emojis and no malformed bytes
+    std::string text;             // Processed text; left empty when nothing changed
+    int removed_emoji_count = 0;  // Number of emoji sequences replaced
+};
+
+// Function to remove emojis from a UTF-8 string that only allocates once the first emoji or
+// malformed byte is found. Callers should use the original input when `changed` is false.
+auto removeEmojisIfPresent(std::string_view text, MatchEngine engine = MatchEngine::CodePoint)
+    -> EmojiRemoval;
+
+// Function to find the offset of the first byte that removeEmojis would change, or
+// std::string_view::npos if the text would come out unchanged. Processing can restart at that
+// offset with the prefix copied through as is.
+auto findFirstChange(std::string_view text, MatchEngine engine = MatchEngine::CodePoint) -> size_t;
+
+// Function to count the emojis in a UTF-8 string without building any output
+auto countEmojis(std::string_view text, MatchEngine engine = MatchEngine::CodePoint) -> uint64_t;
+
+// Function to find the first offset at or after `pos` where `text` can be cut so that processing
+// the two parts separately gives the same output as processing it whole, or text.size() if there
+// is none. Such a cut follows an ASCII byte that cannot begin an emoji sequence, like a newline.
+auto findSafeSplit(std::string_view text, size_t pos) -> size_t;
+
+// Function to identify the emoji tables this build was generated from. The value changes whenever
+// the set of recognized sequences does, so results saved by another build can be told apart.
+auto emojiTableVersion() -> uint64_t;
+
+// Result of processing one block of a larger input
+struct BlockResult {
+    size_t consumed = 0;               // Leading bytes of the block that were fully processed
+    uint64_t removed_emoji_count = 0;  // Number of emoji sequences replaced or counted
+};
+
+// Function to remove emojis from one block of a larger UTF-8 input, appending the processed bytes
+// to `output`. Newlines are ordinary bytes, so concatenating the output of every block reproduces
+// the input exactly apart from the replacements. Unless `is_final` is set, trailing bytes that the
+// next block could still turn into an emoji sequence or a complete character are left unconsumed;
+// the caller passes them again at the front of the next block. That tail is never longer than the
+// longest emoji sequence.
+auto removeEmojisFromBlock(std::string_view block, bool is_final, std::string& output,
+                           MatchEngine engine = MatchEngine::CodePoint) -> BlockResult;
+
+// Function to find how many leading bytes of one block of a larger UTF-8 input
+// removeEmojisFromBlock would copy to its output unchanged. Processing can restart at that offset,
+// so callers can write the prefix straight from the input instead.
+auto findUnchangedPrefix(std::string_view block, bool is_final,
+                         MatchEngine engine = MatchEngine::CodePoint) -> size_t;
+
+// Function to count the emojis in one block of a larger UTF-8 input; see removeEmojisFromBlock
+auto countEmojisInBlock(std::string_view block, bool is_final,
+                        MatchEngine engine = MatchEngine::CodePoint) -> BlockResult;
+
+// Removes emojis from an input that arrives in chunks of any size. Partial UTF-8 characters and
+// partial emoji sequences at the end of a chunk are held back until the next one, so memory stays
+// bounded by one chunk plus the longest emoji sequence no matter how long a line is.
+class EmojiStreamFilter {
+   public:
+    explicit EmojiStreamFilter(MatchEngine engine = MatchEngine::CodePoint) : engine_(engine) {}
+
+    // Processes the next chunk of input, appending finished output to `output`. Pass nullptr to
+    // only count emojis.
+    void feed(std::string_view chunk, std::string* output);
+
+    // Number of leading bytes of `chunk` that feed would pass through unchanged; always 0 while
+    // anything is held back. The caller may write those bytes itself and feed only the rest.
+    [[nodiscard]] auto unchangedPrefix(std::string_view chunk) const -> size_t;
+
+    // Processes whatever is still held back at the end of the input
+    void finish(std::string* output);
+
+    // Number of emoji sequences removed or counted so far
+    [[nodiscard]] auto removedEmojiCount() const -> uint64_t { return removed_emoji_count_; }
+
+    // Number of bytes currently held back waiting for more input
+    [[nodiscard]] auto pendingSize() const -> size_t { return pending_.size(); }
+
+   private:
+    auto process(std::string_view block, bool is_final, std::string* output) -> size_t;
+
+    MatchEngine engine_;
+    std::string pending_;
+    uint64_t removed_emoji_count_ = 0;
+};
 
 #endif  // NEJ_CORE_H
@@ -0,0 +1,168 @@
+#include "directory_walk.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+
+namespace {
+
+struct DirectoryEntry {
+    std::string name;
+    bool is_directory = false;
+};
+
+auto matchesAny(const std::vector<std::string>& patterns, const std::string& name,
+                const std::string& relative_path) -> bool {
+    return std::any_of(patterns.begin(), patterns.end(), [&](const std::string& pattern) {
+        if (pattern.find('/') == std::string::npos) {
+            return fnmatch(pattern.c_str(), name.c_str(), 0) == 0;
+        }
+        return fnmatch(pattern.c_str(), relative_path.c_str(), FNM_PATHNAME) == 0;
+    });
+}
+
+auto joinPath(const std::string& directory, const std::string& name) -> std::string {
+    if (!directory.empty() && directory.back() == '/') {
+        return directory + name;
+    }
+    return directory + "/" + name;
+}
+
+// Lists the regular files and directories in the directory open as `dir_fd`, sorted by name.
+// Entries whose type readdir does not report are looked up with fstatat.
+auto listDirectory(DIR* dir, int dir_fd, std::vector<DirectoryEntry>& entries) -> bool {
+    while (true) {
+        errno = 0;
+        const dirent* entry = readdir(dir);
+        if (entry == nullptr) {
+            if (errno != 0) {
+                return false;
+            }
+            break;
+        }
+        if (std::strcmp(entry->d_name, ".") == 0 || std::strcmp(entry->d_name, "..") == 0) {
+            continue;
+        }
+
+        unsigned char type = entry->d_type;
+        if (type == DT_UNKNOWN) {
+            struct stat status {};
+            if (fstatat(dir_fd, entry->d_name, &status, AT_SYMLINK_NOFOLLOW) != 0) {
+                continue;  // Removed since it was listed
+            }
+            type = S_ISDIR(status.st_mode) ? DT_DIR : S_ISREG(status.st_mode) ? DT_REG : DT_UNKNOWN;
+        }
+        if (type == DT_DIR || type == DT_REG) {
+            entries.push_back({entry->d_name, type == DT_DIR});
+        }
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const DirectoryEntry& a, const DirectoryEntry& b) { return a.name < b.name; });
+    return true;
+}
+
+// Everything a walk needs, shared by the tasks that walk its subdirectories so that it outlives
+// the call to walkDirectory
+struct WalkContext {
+    WalkFilter filter;
+    std::function<void(const std::string&)> visit;
+    std::function<void(const std::string&, int)> fail;
+    WalkSubmitter submit;
+};
+
+// Directory stream that subdirectories are opened relative to, closed once the last of them has
+// been opened
+class OpenDirectory {
+   public:
+    explicit OpenDirectory(DIR* dir) : dir_(dir) {}
+    ~OpenDirectory() { closedir(dir_); }  // Also closes the descriptor
+
+    OpenDirectory(const OpenDirectory&) = delete;
+    auto operator=(const OpenDirectory&) -> OpenDirectory& = delete;
+
+    [[nodiscard]] auto fd() const -> int { return dirfd(dir_); }
+
+   private:
+    DIR* dir_;
+};
+
+void walkOpenDirectory(int dir_fd, const std::string& path, const std::string& relative_path,
+                       const std::shared_ptr<const WalkContext>& context);
+
+// Opens the subdirectory `name` of `parent` and walks it
+void walkSubdirectory(const OpenDirectory& parent, const std::string& name,
+                      const std::string& path, const std::string& relative_path,
+                      const std::shared_ptr<const WalkContext>& context) {
+    int child_fd =
+        openat(parent.fd(), name.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+    if (child_fd < 0) {
+        context->fail(path, errno);
+        return;
+    }
+    walkOpenDirectory(child_fd, path, relative_path, context);
+}
+
+// Walks the directory open as `dir_fd`, which is closed when done
+void walkOpenDirectory(int dir_fd, const std::string& path, const std::string& relative_path,
+                       const std::shared_ptr<const WalkContext>& context) {
+    DIR* dir = fdopendir(dir_fd);
+    if (dir == nullptr) {
+        context->fail(path, errno);
+        close(dir_fd);
+        return;
+    }
+    auto directory = std::make_shared<OpenDirectory>(dir);
+
+    std::vector<DirectoryEntry> entries;
+    if (!listDirectory(dir, dir_fd, entries)) {
+        context->fail(path, errno);
+        return;
+    }
+
+    const WalkFilter& filter = context->filter;
+    for (const auto& entry : entries) {
+        std::string entry_path = joinPath(path, entry.name);
+        std::string entry_relative_path =
+            relative_path.empty() ? entry.name : relative_path + "/" + entry.name;
+        if (matchesAny(filter.exclude, entry.name, entry_relative_path)) {
+            continue;
+        }
+
+        if (entry.is_directory) {
+            if (context->submit) {
+                context->submit([directory, name = entry.name, entry_path, entry_relative_path,
+                                 context] {
+                    walkSubdirectory(*directory, name, entry_path, entry_relative_path, context);
+                });
+            } else {
+                walkSubdirectory(*directory, entry.name, entry_path, entry_relative_path,
+                                 context);
+            }
+        } else if (filter.include.empty() ||
+                   matchesAny(filter.include, entry.name, entry_relative_path)) {
+            context->visit(entry_path);
+        }
+    }
+}
+
+}  // namespace
+
+void walkDirectory(const std::string& root, const WalkFilter& filter,
+                   const std::function<void(const std::string&)>& visit,
+                   const std::function<void(const std::string&, int)>& fail,
+                   const WalkSubmitter& submit) {
+    int root_fd = open(root.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (root_fd < 0) {
+        fail(root, errno);
+        return;
+    }
+    auto context = std::make_shared<const WalkContext>(WalkContext{filter, visit, fail, submit});
+    walkOpenDirectory(root_fd, root, "", context);
+}
@@ -0,0 +1,36 @@
+#ifndef NEJ_DIRECTORY_WALK_H
+#define NEJ_DIRECTORY_WALK_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// Glob patterns, as understood by fnmatch, that select the files a walk reports. A pattern without
+// a '/' is matched against entry names, like find -name; one with a '/' is matched against the
+// path below the root of the walk.
+struct WalkFilter {
+    std::vector<std::string> include;  // Files must match one of these; empty selects every file
+    std::vector<std::string> exclude;  // Files and directories matching any of these are skipped
+};
+
+// Hands the walk of a subdirectory to another thread, such as an idle worker of a pool. The task
+// must be run exactly once, on any thread.
+using WalkSubmitter = std::function<void(std::function<void()>)>;
+
+// Function to walk the directory tree under `root`, calling `visit` with the path of every regular
+// file that `filter` selects, in name order within each directory. Each directory is opened
+// relative to its parent with openat and read to the end with readdir, which fetches entries in
+// large getdents batches, before any of its files are reported; files that processing creates
+// next to them are therefore not picked up. Symbolic links are not followed. Directories that
+// cannot be read are reported to `fail` with the errno value and skipped.
+//
+// With a `submit`, each subdirectory is walked by a task handed to it, and the walk may return
+// before the tree has been read; `visit` and `fail` are then called from those tasks, possibly on
+// several threads at once. Each task keeps its parent directory open until it has opened its own.
+// Files are still reported in name order within each directory, but no longer in tree order.
+void walkDirectory(const std::string& root, const WalkFilter& filter,
+                   const std::function<void(const std::string&)>& visit,
+                   const std::function<void(const std::string&, int)>& fail,
+                   const WalkSubmitter& submit = nullptr);
+
+#endif  // NEJ_DIRECTORY_WALK_H
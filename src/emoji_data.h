@@ -1,4800 +1,4622 @@
+// Generated by generate_emoji_header.py from emoji-test.txt. Do not edit.
+//
+// Each trie is flattened breadth-first: the edges of node n are the symbols in
+// [EDGE_OFFSETS[n], EDGE_OFFSETS[n + 1]), sorted ascending, and edge e leads to
+// node e + 1. Node 0 is the root; TERMINAL[n] marks complete emoji sequences.
+
 #ifndef NEJ_EMOJI_DATA_H
 #define NEJ_EMOJI_DATA_H
 
 #include <cstdint>
-#include <set>
-#include <vector>
 
-const std::set<std::vector<uint32_t>> EMOJI_SEQUENCES = {
-    {0x0023, 0xFE0F, 0x20E3},
-    {0x002A, 0xFE0F, 0x20E3},
-    {0x0030, 0xFE0F, 0x20E3},
-    {0x0031, 0xFE0F, 0x20E3},
-    {0x0032, 0xFE0F, 0x20E3},
-    {0x0033, 0xFE0F, 0x20E3},
-    {0x0034, 0xFE0F, 0x20E3},
-    {0x0035, 0xFE0F, 0x20E3},
-    {0x0036, 0xFE0F, 0x20E3},
-    {0x0037, 0xFE0F, 0x20E3},
-    {0x0038, 0xFE0F, 0x20E3},
-    {0x0039, 0xFE0F, 0x20E3},
-    {0x00A9, 0xFE0F},
-    {0x00AE, 0xFE0F},
-    {0x203C, 0xFE0F},
-    {0x2049, 0xFE0F},
-    {0x2122, 0xFE0F},
-    {0x2139, 0xFE0F},
-    {0x2194, 0xFE0F},
-    {0x2195, 0xFE0F},
-    {0x2196, 0xFE0F},
-    {0x2197, 0xFE0F},
-    {0x2198, 0xFE0F},
-    {0x2199, 0xFE0F},
-    {0x21A9, 0xFE0F},
-    {0x21AA, 0xFE0F},
-    {0x231A},
-    {0x231B},
-    {0x2328, 0xFE0F},
-    {0x23CF, 0xFE0F},
-    {0x23E9},
-    {0x23EA},
-    {0x23EB},
-    {0x23EC},
-    {0x23ED, 0xFE0F},
-    {0x23EE, 0xFE0F},
-    {0x23EF, 0xFE0F},
-    {0x23F0},
-    {0x23F1, 0xFE0F},
-    {0x23F2, 0xFE0F},
-    {0x23F3},
-    {0x23F8, 0xFE0F},
-    {0x23F9, 0xFE0F},
-    {0x23FA, 0xFE0F},
-    {0x24C2, 0xFE0F},
-    {0x25AA, 0xFE0F},
-    {0x25AB, 0xFE0F},
-    {0x25B6, 0xFE0F},
-    {0x25C0, 0xFE0F},
-    {0x25FB, 0xFE0F},
-    {0x25FC, 0xFE0F},
-    {0x25FD},
-    {0x25FE},
-    {0x2600, 0xFE0F},
-    {0x2601, 0xFE0F},
-    {0x2602, 0xFE0F},
-    {0x2603, 0xFE0F},
-    {0x2604, 0xFE0F},
-    {0x260E, 0xFE0F},
-    {0x2611, 0xFE0F},
-    {0x2614},
-    {0x2615},
-    {0x2618, 0xFE0F},
-    {0x261D, 0xFE0F},
-    {0x261D, 0x1F3FB},
-    {0x261D, 0x1F3FC},
-    {0x261D, 0x1F3FD},
-    {0x261D, 0x1F3FE},
-    {0x261D, 0x1F3FF},
-    {0x2620, 0xFE0F},
-    {0x2622, 0xFE0F},
-    {0x2623, 0xFE0F},
-    {0x2626, 0xFE0F},
-    {0x262A, 0xFE0F},
-    {0x262E, 0xFE0F},
-    {0x262F, 0xFE0F},
-    {0x2638, 0xFE0F},
-    {0x2639, 0xFE0F},
-    {0x263A, 0xFE0F},
-    {0x2640, 0xFE0F},
-    {0x2642, 0xFE0F},
-    {0x2648},
-    {0x2649},
-    {0x264A},
-    {0x264B},
-    {0x264C},
-    {0x264D},
-    {0x264E},
-    {0x264F},
-    {0x2650},
-    {0x2651},
-    {0x2652},
-    {0x2653},
-    {0x265F, 0xFE0F},
-    {0x2660, 0xFE0F},
-    {0x2663, 0xFE0F},
-    {0x2665, 0xFE0F},
-    {0x2666, 0xFE0F},
-    {0x2668, 0xFE0F},
-    {0x267B, 0xFE0F},
-    {0x267E, 0xFE0F},
-    {0x267F},
-    {0x2692, 0xFE0F},
-    {0x2693},
-    {0x2694, 0xFE0F},
-    {0x2695, 0xFE0F},
-    {0x2696, 0xFE0F},
-    {0x2697, 0xFE0F},
-    {0x2699, 0xFE0F},
-    {0x269B, 0xFE0F},
-    {0x269C, 0xFE0F},
-    {0x26A0, 0xFE0F},
-    {0x26A1},
-    {0x26A7, 0xFE0F},
-    {0x26AA},
-    {0x26AB},
-    {0x26B0, 0xFE0F},
-    {0x26B1, 0xFE0F},
-    {0x26BD},
-    {0x26BE},
-    {0x26C4},
-    {0x26C5},
-    {0x26C8, 0xFE0F},
-    {0x26CE},
-    {0x26CF, 0xFE0F},
-    {0x26D1, 0xFE0F},
-    {0x26D3, 0xFE0F},
-    {0x26D3, 0xFE0F, 0x200D, 0x1F4A5},
-    {0x26D4},
-    {0x26E9, 0xFE0F},
-    {0x26EA},
-    {0x26F0, 0xFE0F},
-    {0x26F1, 0xFE0F},
-    {0x26F2},
-    {0x26F3},
-    {0x26F4, 0xFE0F},
-    {0x26F5},
-    {0x26F7, 0xFE0F},
-    {0x26F8, 0xFE0F},
-    {0x26F9, 0xFE0F},
-    {0x26F9, 0xFE0F, 0x200D, 0x2640},
-    {0x26F9, 0xFE0F, 0x200D, 0x2640, 0xFE0F},
-    {0x26F9, 0xFE0F, 0x200D, 0x2642},
-    {0x26F9, 0xFE0F, 0x200D, 0x2642, 0xFE0F},
-    {0x26F9, 0x1F3FB},
-    {0x26F9, 0x1F3FB, 0x200D, 0x2640},
-    {0x26F9, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x26F9, 0x1F3FB, 0x200D, 0x2642},
-    {0x26F9, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x26F9, 0x1F3FC},
-    {0x26F9, 0x1F3FC, 0x200D, 0x2640},
-    {0x26F9, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x26F9, 0x1F3FC, 0x200D, 0x2642},
-    {0x26F9, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x26F9, 0x1F3FD},
-    {0x26F9, 0x1F3FD, 0x200D, 0x2640},
-    {0x26F9, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x26F9, 0x1F3FD, 0x200D, 0x2642},
-    {0x26F9, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x26F9, 0x1F3FE},
-    {0x26F9, 0x1F3FE, 0x200D, 0x2640},
-    {0x26F9, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x26F9, 0x1F3FE, 0x200D, 0x2642},
-    {0x26F9, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x26F9, 0x1F3FF},
-    {0x26F9, 0x1F3FF, 0x200D, 0x2640},
-    {0x26F9, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x26F9, 0x1F3FF, 0x200D, 0x2642},
-    {0x26F9, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x26FA},
-    {0x26FD},
-    {0x2702, 0xFE0F},
-    {0x2705},
-    {0x2708, 0xFE0F},
-    {0x2709, 0xFE0F},
-    {0x270A},
-    {0x270A, 0x1F3FB},
-    {0x270A, 0x1F3FC},
-    {0x270A, 0x1F3FD},
-    {0x270A, 0x1F3FE},
-    {0x270A, 0x1F3FF},
-    {0x270B},
-    {0x270B, 0x1F3FB},
-    {0x270B, 0x1F3FC},
-    {0x270B, 0x1F3FD},
-    {0x270B, 0x1F3FE},
-    {0x270B, 0x1F3FF},
-    {0x270C, 0xFE0F},
-    {0x270C, 0x1F3FB},
-    {0x270C, 0x1F3FC},
-    {0x270C, 0x1F3FD},
-    {0x270C, 0x1F3FE},
-    {0x270C, 0x1F3FF},
-    {0x270D, 0xFE0F},
-    {0x270D, 0x1F3FB},
-    {0x270D, 0x1F3FC},
-    {0x270D, 0x1F3FD},
-    {0x270D, 0x1F3FE},
-    {0x270D, 0x1F3FF},
-    {0x270F, 0xFE0F},
-    {0x2712, 0xFE0F},
-    {0x2714, 0xFE0F},
-    {0x2716, 0xFE0F},
-    {0x271D, 0xFE0F},
-    {0x2721, 0xFE0F},
-    {0x2728},
-    {0x2733, 0xFE0F},
-    {0x2734, 0xFE0F},
-    {0x2744, 0xFE0F},
-    {0x2747, 0xFE0F},
-    {0x274C},
-    {0x274E},
-    {0x2753},
-    {0x2754},
-    {0x2755},
-    {0x2757},
-    {0x2763, 0xFE0F},
-    {0x2764, 0xFE0F},
-    {0x2764, 0xFE0F, 0x200D, 0x1F525},
-    {0x2764, 0xFE0F, 0x200D, 0x1FA79},
-    {0x2795},
-    {0x2796},
-    {0x2797},
-    {0x27A1, 0xFE0F},
-    {0x27B0},
-    {0x27BF},
-    {0x2934, 0xFE0F},
-    {0x2935, 0xFE0F},
-    {0x2B05, 0xFE0F},
-    {0x2B06, 0xFE0F},
-    {0x2B07, 0xFE0F},
-    {0x2B1B},
-    {0x2B1C},
-    {0x2B50},
-    {0x2B55},
-    {0x3030, 0xFE0F},
-    {0x303D, 0xFE0F},
-    {0x3297, 0xFE0F},
-    {0x3299, 0xFE0F},
-    {0x1F004},
-    {0x1F0CF},
-    {0x1F170, 0xFE0F},
-    {0x1F171, 0xFE0F},
-    {0x1F17E, 0xFE0F},
-    {0x1F17F, 0xFE0F},
-    {0x1F18E},
-    {0x1F191},
-    {0x1F192},
-    {0x1F193},
-    {0x1F194},
-    {0x1F195},
-    {0x1F196},
-    {0x1F197},
-    {0x1F198},
-    {0x1F199},
-    {0x1F19A},
-    {0x1F1E6, 0x1F1E8},
-    {0x1F1E6, 0x1F1E9},
-    {0x1F1E6, 0x1F1EA},
-    {0x1F1E6, 0x1F1EB},
-    {0x1F1E6, 0x1F1EC},
-    {0x1F1E6, 0x1F1EE},
-    {0x1F1E6, 0x1F1F1},
-    {0x1F1E6, 0x1F1F2},
-    {0x1F1E6, 0x1F1F4},
-    {0x1F1E6, 0x1F1F6},
-    {0x1F1E6, 0x1F1F7},
-    {0x1F1E6, 0x1F1F8},
-    {0x1F1E6, 0x1F1F9},
-    {0x1F1E6, 0x1F1FA},
-    {0x1F1E6, 0x1F1FC},
-    {0x1F1E6, 0x1F1FD},
-    {0x1F1E6, 0x1F1FF},
-    {0x1F1E7, 0x1F1E6},
-    {0x1F1E7, 0x1F1E7},
-    {0x1F1E7, 0x1F1E9},
-    {0x1F1E7, 0x1F1EA},
-    {0x1F1E7, 0x1F1EB},
-    {0x1F1E7, 0x1F1EC},
-    {0x1F1E7, 0x1F1ED},
-    {0x1F1E7, 0x1F1EE},
-    {0x1F1E7, 0x1F1EF},
-    {0x1F1E7, 0x1F1F1},
-    {0x1F1E7, 0x1F1F2},
-    {0x1F1E7, 0x1F1F3},
-    {0x1F1E7, 0x1F1F4},
-    {0x1F1E7, 0x1F1F6},
-    {0x1F1E7, 0x1F1F7},
-    {0x1F1E7, 0x1F1F8},
-    {0x1F1E7, 0x1F1F9},
-    {0x1F1E7, 0x1F1FB},
-    {0x1F1E7, 0x1F1FC},
-    {0x1F1E7, 0x1F1FE},
-    {0x1F1E7, 0x1F1FF},
-    {0x1F1E8, 0x1F1E6},
-    {0x1F1E8, 0x1F1E8},
-    {0x1F1E8, 0x1F1E9},
-    {0x1F1E8, 0x1F1EB},
-    {0x1F1E8, 0x1F1EC},
-    {0x1F1E8, 0x1F1ED},
-    {0x1F1E8, 0x1F1EE},
-    {0x1F1E8, 0x1F1F0},
-    {0x1F1E8, 0x1F1F1},
-    {0x1F1E8, 0x1F1F2},
-    {0x1F1E8, 0x1F1F3},
-    {0x1F1E8, 0x1F1F4},
-    {0x1F1E8, 0x1F1F5},
-    {0x1F1E8, 0x1F1F6},
-    {0x1F1E8, 0x1F1F7},
-    {0x1F1E8, 0x1F1FA},
-    {0x1F1E8, 0x1F1FB},
-    {0x1F1E8, 0x1F1FC},
-    {0x1F1E8, 0x1F1FD},
-    {0x1F1E8, 0x1F1FE},
-    {0x1F1E8, 0x1F1FF},
-    {0x1F1E9, 0x1F1EA},
-    {0x1F1E9, 0x1F1EC},
-    {0x1F1E9, 0x1F1EF},
-    {0x1F1E9, 0x1F1F0},
-    {0x1F1E9, 0x1F1F2},
-    {0x1F1E9, 0x1F1F4},
-    {0x1F1E9, 0x1F1FF},
-    {0x1F1EA, 0x1F1E6},
-    {0x1F1EA, 0x1F1E8},
-    {0x1F1EA, 0x1F1EA},
-    {0x1F1EA, 0x1F1EC},
-    {0x1F1EA, 0x1F1ED},
-    {0x1F1EA, 0x1F1F7},
-    {0x1F1EA, 0x1F1F8},
-    {0x1F1EA, 0x1F1F9},
-    {0x1F1EA, 0x1F1FA},
-    {0x1F1EB, 0x1F1EE},
-    {0x1F1EB, 0x1F1EF},
-    {0x1F1EB, 0x1F1F0},
-    {0x1F1EB, 0x1F1F2},
-    {0x1F1EB, 0x1F1F4},
-    {0x1F1EB, 0x1F1F7},
-    {0x1F1EC, 0x1F1E6},
-    {0x1F1EC, 0x1F1E7},
-    {0x1F1EC, 0x1F1E9},
-    {0x1F1EC, 0x1F1EA},
-    {0x1F1EC, 0x1F1EB},
-    {0x1F1EC, 0x1F1EC},
-    {0x1F1EC, 0x1F1ED},
-    {0x1F1EC, 0x1F1EE},
-    {0x1F1EC, 0x1F1F1},
-    {0x1F1EC, 0x1F1F2},
-    {0x1F1EC, 0x1F1F3},
-    {0x1F1EC, 0x1F1F5},
-    {0x1F1EC, 0x1F1F6},
-    {0x1F1EC, 0x1F1F7},
-    {0x1F1EC, 0x1F1F8},
-    {0x1F1EC, 0x1F1F9},
-    {0x1F1EC, 0x1F1FA},
-    {0x1F1EC, 0x1F1FC},
-    {0x1F1EC, 0x1F1FE},
-    {0x1F1ED, 0x1F1F0},
-    {0x1F1ED, 0x1F1F2},
-    {0x1F1ED, 0x1F1F3},
-    {0x1F1ED, 0x1F1F7},
-    {0x1F1ED, 0x1F1F9},
-    {0x1F1ED, 0x1F1FA},
-    {0x1F1EE, 0x1F1E8},
-    {0x1F1EE, 0x1F1E9},
-    {0x1F1EE, 0x1F1EA},
-    {0x1F1EE, 0x1F1F1},
-    {0x1F1EE, 0x1F1F2},
-    {0x1F1EE, 0x1F1F3},
-    {0x1F1EE, 0x1F1F4},
-    {0x1F1EE, 0x1F1F6},
-    {0x1F1EE, 0x1F1F7},
-    {0x1F1EE, 0x1F1F8},
-    {0x1F1EE, 0x1F1F9},
-    {0x1F1EF, 0x1F1EA},
-    {0x1F1EF, 0x1F1F2},
-    {0x1F1EF, 0x1F1F4},
-    {0x1F1EF, 0x1F1F5},
-    {0x1F1F0, 0x1F1EA},
-    {0x1F1F0, 0x1F1EC},
-    {0x1F1F0, 0x1F1ED},
-    {0x1F1F0, 0x1F1EE},
-    {0x1F1F0, 0x1F1F2},
-    {0x1F1F0, 0x1F1F3},
-    {0x1F1F0, 0x1F1F5},
-    {0x1F1F0, 0x1F1F7},
-    {0x1F1F0, 0x1F1FC},
-    {0x1F1F0, 0x1F1FE},
-    {0x1F1F0, 0x1F1FF},
-    {0x1F1F1, 0x1F1E6},
-    {0x1F1F1, 0x1F1E7},
-    {0x1F1F1, 0x1F1E8},
-    {0x1F1F1, 0x1F1EE},
-    {0x1F1F1, 0x1F1F0},
-    {0x1F1F1, 0x1F1F7},
-    {0x1F1F1, 0x1F1F8},
-    {0x1F1F1, 0x1F1F9},
-    {0x1F1F1, 0x1F1FA},
-    {0x1F1F1, 0x1F1FB},
-    {0x1F1F1, 0x1F1FE},
-    {0x1F1F2, 0x1F1E6},
-    {0x1F1F2, 0x1F1E8},
-    {0x1F1F2, 0x1F1E9},
-    {0x1F1F2, 0x1F1EA},
-    {0x1F1F2, 0x1F1EB},
-    {0x1F1F2, 0x1F1EC},
-    {0x1F1F2, 0x1F1ED},
-    {0x1F1F2, 0x1F1F0},
-    {0x1F1F2, 0x1F1F1},
-    {0x1F1F2, 0x1F1F2},
-    {0x1F1F2, 0x1F1F3},
-    {0x1F1F2, 0x1F1F4},
-    {0x1F1F2, 0x1F1F5},
-    {0x1F1F2, 0x1F1F6},
-    {0x1F1F2, 0x1F1F7},
-    {0x1F1F2, 0x1F1F8},
-    {0x1F1F2, 0x1F1F9},
-    {0x1F1F2, 0x1F1FA},
-    {0x1F1F2, 0x1F1FB},
-    {0x1F1F2, 0x1F1FC},
-    {0x1F1F2, 0x1F1FD},
-    {0x1F1F2, 0x1F1FE},
-    {0x1F1F2, 0x1F1FF},
-    {0x1F1F3, 0x1F1E6},
-    {0x1F1F3, 0x1F1E8},
-    {0x1F1F3, 0x1F1EA},
-    {0x1F1F3, 0x1F1EB},
-    {0x1F1F3, 0x1F1EC},
-    {0x1F1F3, 0x1F1EE},
-    {0x1F1F3, 0x1F1F1},
-    {0x1F1F3, 0x1F1F4},
-    {0x1F1F3, 0x1F1F5},
-    {0x1F1F3, 0x1F1F7},
-    {0x1F1F3, 0x1F1FA},
-    {0x1F1F3, 0x1F1FF},
-    {0x1F1F4, 0x1F1F2},
-    {0x1F1F5, 0x1F1E6},
-    {0x1F1F5, 0x1F1EA},
-    {0x1F1F5, 0x1F1EB},
-    {0x1F1F5, 0x1F1EC},
-    {0x1F1F5, 0x1F1ED},
-    {0x1F1F5, 0x1F1F0},
-    {0x1F1F5, 0x1F1F1},
-    {0x1F1F5, 0x1F1F2},
-    {0x1F1F5, 0x1F1F3},
-    {0x1F1F5, 0x1F1F7},
-    {0x1F1F5, 0x1F1F8},
-    {0x1F1F5, 0x1F1F9},
-    {0x1F1F5, 0x1F1FC},
-    {0x1F1F5, 0x1F1FE},
-    {0x1F1F6, 0x1F1E6},
-    {0x1F1F7, 0x1F1EA},
-    {0x1F1F7, 0x1F1F4},
-    {0x1F1F7, 0x1F1F8},
-    {0x1F1F7, 0x1F1FA},
-    {0x1F1F7, 0x1F1FC},
-    {0x1F1F8, 0x1F1E6},
-    {0x1F1F8, 0x1F1E7},
-    {0x1F1F8, 0x1F1E8},
-    {0x1F1F8, 0x1F1E9},
-    {0x1F1F8, 0x1F1EA},
-    {0x1F1F8, 0x1F1EC},
-    {0x1F1F8, 0x1F1ED},
-    {0x1F1F8, 0x1F1EE},
-    {0x1F1F8, 0x1F1EF},
-    {0x1F1F8, 0x1F1F0},
-    {0x1F1F8, 0x1F1F1},
-    {0x1F1F8, 0x1F1F2},
-    {0x1F1F8, 0x1F1F3},
-    {0x1F1F8, 0x1F1F4},
-    {0x1F1F8, 0x1F1F7},
-    {0x1F1F8, 0x1F1F8},
-    {0x1F1F8, 0x1F1F9},
-    {0x1F1F8, 0x1F1FB},
-    {0x1F1F8, 0x1F1FD},
-    {0x1F1F8, 0x1F1FE},
-    {0x1F1F8, 0x1F1FF},
-    {0x1F1F9, 0x1F1E6},
-    {0x1F1F9, 0x1F1E8},
-    {0x1F1F9, 0x1F1E9},
-    {0x1F1F9, 0x1F1EB},
-    {0x1F1F9, 0x1F1EC},
-    {0x1F1F9, 0x1F1ED},
-    {0x1F1F9, 0x1F1EF},
-    {0x1F1F9, 0x1F1F0},
-    {0x1F1F9, 0x1F1F1},
-    {0x1F1F9, 0x1F1F2},
-    {0x1F1F9, 0x1F1F3},
-    {0x1F1F9, 0x1F1F4},
-    {0x1F1F9, 0x1F1F7},
-    {0x1F1F9, 0x1F1F9},
-    {0x1F1F9, 0x1F1FB},
-    {0x1F1F9, 0x1F1FC},
-    {0x1F1F9, 0x1F1FF},
-    {0x1F1FA, 0x1F1E6},
-    {0x1F1FA, 0x1F1EC},
-    {0x1F1FA, 0x1F1F2},
-    {0x1F1FA, 0x1F1F3},
-    {0x1F1FA, 0x1F1F8},
-    {0x1F1FA, 0x1F1FE},
-    {0x1F1FA, 0x1F1FF},
-    {0x1F1FB, 0x1F1E6},
-    {0x1F1FB, 0x1F1E8},
-    {0x1F1FB, 0x1F1EA},
-    {0x1F1FB, 0x1F1EC},
-    {0x1F1FB, 0x1F1EE},
-    {0x1F1FB, 0x1F1F3},
-    {0x1F1FB, 0x1F1FA},
-    {0x1F1FC, 0x1F1EB},
-    {0x1F1FC, 0x1F1F8},
-    {0x1F1FD, 0x1F1F0},
-    {0x1F1FE, 0x1F1EA},
-    {0x1F1FE, 0x1F1F9},
-    {0x1F1FF, 0x1F1E6},
-    {0x1F1FF, 0x1F1F2},
-    {0x1F1FF, 0x1F1FC},
-    {0x1F201},
-    {0x1F202, 0xFE0F},
-    {0x1F21A},
-    {0x1F22F},
-    {0x1F232},
-    {0x1F233},
-    {0x1F234},
-    {0x1F235},
-    {0x1F236},
-    {0x1F237, 0xFE0F},
-    {0x1F238},
-    {0x1F239},
-    {0x1F23A},
-    {0x1F250},
-    {0x1F251},
-    {0x1F300},
-    {0x1F301},
-    {0x1F302},
-    {0x1F303},
-    {0x1F304},
-    {0x1F305},
-    {0x1F306},
-    {0x1F307},
-    {0x1F308},
-    {0x1F309},
-    {0x1F30A},
-    {0x1F30B},
-    {0x1F30C},
-    {0x1F30D},
-    {0x1F30E},
-    {0x1F30F},
-    {0x1F310},
-    {0x1F311},
-    {0x1F312},
-    {0x1F313},
-    {0x1F314},
-    {0x1F315},
-    {0x1F316},
-    {0x1F317},
-    {0x1F318},
-    {0x1F319},
-    {0x1F31A},
-    {0x1F31B},
-    {0x1F31C},
-    {0x1F31D},
-    {0x1F31E},
-    {0x1F31F},
-    {0x1F320},
-    {0x1F321, 0xFE0F},
-    {0x1F324, 0xFE0F},
-    {0x1F325, 0xFE0F},
-    {0x1F326, 0xFE0F},
-    {0x1F327, 0xFE0F},
-    {0x1F328, 0xFE0F},
-    {0x1F329, 0xFE0F},
-    {0x1F32A, 0xFE0F},
-    {0x1F32B, 0xFE0F},
-    {0x1F32C, 0xFE0F},
-    {0x1F32D},
-    {0x1F32E},
-    {0x1F32F},
-    {0x1F330},
-    {0x1F331},
-    {0x1F332},
-    {0x1F333},
-    {0x1F334},
-    {0x1F335},
-    {0x1F336, 0xFE0F},
-    {0x1F337},
-    {0x1F338},
-    {0x1F339},
-    {0x1F33A},
-    {0x1F33B},
-    {0x1F33C},
-    {0x1F33D},
-    {0x1F33E},
-    {0x1F33F},
-    {0x1F340},
-    {0x1F341},
-    {0x1F342},
-    {0x1F343},
-    {0x1F344},
-    {0x1F344, 0x200D, 0x1F7EB},
-    {0x1F345},
-    {0x1F346},
-    {0x1F347},
-    {0x1F348},
-    {0x1F349},
-    {0x1F34A},
-    {0x1F34B},
-    {0x1F34B, 0x200D, 0x1F7E9},
-    {0x1F34C},
-    {0x1F34D},
-    {0x1F34E},
-    {0x1F34F},
-    {0x1F350},
-    {0x1F351},
-    {0x1F352},
-    {0x1F353},
-    {0x1F354},
-    {0x1F355},
-    {0x1F356},
-    {0x1F357},
-    {0x1F358},
-    {0x1F359},
-    {0x1F35A},
-    {0x1F35B},
-    {0x1F35C},
-    {0x1F35D},
-    {0x1F35E},
-    {0x1F35F},
-    {0x1F360},
-    {0x1F361},
-    {0x1F362},
-    {0x1F363},
-    {0x1F364},
-    {0x1F365},
-    {0x1F366},
-    {0x1F367},
-    {0x1F368},
-    {0x1F369},
-    {0x1F36A},
-    {0x1F36B},
-    {0x1F36C},
-    {0x1F36D},
-    {0x1F36E},
-    {0x1F36F},
-    {0x1F370},
-    {0x1F371},
-    {0x1F372},
-    {0x1F373},
-    {0x1F374},
-    {0x1F375},
-    {0x1F376},
-    {0x1F377},
-    {0x1F378},
-    {0x1F379},
-    {0x1F37A},
-    {0x1F37B},
-    {0x1F37C},
-    {0x1F37D, 0xFE0F},
-    {0x1F37E},
-    {0x1F37F},
-    {0x1F380},
-    {0x1F381},
-    {0x1F382},
-    {0x1F383},
-    {0x1F384},
-    {0x1F385},
-    {0x1F385, 0x1F3FB},
-    {0x1F385, 0x1F3FC},
-    {0x1F385, 0x1F3FD},
-    {0x1F385, 0x1F3FE},
-    {0x1F385, 0x1F3FF},
-    {0x1F386},
-    {0x1F387},
-    {0x1F388},
-    {0x1F389},
-    {0x1F38A},
-    {0x1F38B},
-    {0x1F38C},
-    {0x1F38D},
-    {0x1F38E},
-    {0x1F38F},
-    {0x1F390},
-    {0x1F391},
-    {0x1F392},
-    {0x1F393},
-    {0x1F396, 0xFE0F},
-    {0x1F397, 0xFE0F},
-    {0x1F399, 0xFE0F},
-    {0x1F39A, 0xFE0F},
-    {0x1F39B, 0xFE0F},
-    {0x1F39E, 0xFE0F},
-    {0x1F39F, 0xFE0F},
-    {0x1F3A0},
-    {0x1F3A1},
-    {0x1F3A2},
-    {0x1F3A3},
-    {0x1F3A4},
-    {0x1F3A5},
-    {0x1F3A6},
-    {0x1F3A7},
-    {0x1F3A8},
-    {0x1F3A9},
-    {0x1F3AA},
-    {0x1F3AB},
-    {0x1F3AC},
-    {0x1F3AD},
-    {0x1F3AE},
-    {0x1F3AF},
-    {0x1F3B0},
-    {0x1F3B1},
-    {0x1F3B2},
-    {0x1F3B3},
-    {0x1F3B4},
-    {0x1F3B5},
-    {0x1F3B6},
-    {0x1F3B7},
-    {0x1F3B8},
-    {0x1F3B9},
-    {0x1F3BA},
-    {0x1F3BB},
-    {0x1F3BC},
-    {0x1F3BD},
-    {0x1F3BE},
-    {0x1F3BF},
-    {0x1F3C0},
-    {0x1F3C1},
-    {0x1F3C2},
-    {0x1F3C2, 0x1F3FB},
-    {0x1F3C2, 0x1F3FC},
-    {0x1F3C2, 0x1F3FD},
-    {0x1F3C2, 0x1F3FE},
-    {0x1F3C2, 0x1F3FF},
-    {0x1F3C3},
-    {0x1F3C3, 0x200D, 0x2640},
-    {0x1F3C3, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F3C3, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3C3, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F3C3, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x200D, 0x2642},
-    {0x1F3C3, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F3C3, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3C3, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F3C3, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x200D, 0x27A1},
-    {0x1F3C3, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FB},
-    {0x1F3C3, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F3C3, 0x1F3FB, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FB, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3C3, 0x1F3FB, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FB, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F3C3, 0x1F3FB, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FB, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3C3, 0x1F3FB, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FB, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FB, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FB, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FC},
-    {0x1F3C3, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F3C3, 0x1F3FC, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FC, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3C3, 0x1F3FC, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FC, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F3C3, 0x1F3FC, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FC, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3C3, 0x1F3FC, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FC, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FC, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FD},
-    {0x1F3C3, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F3C3, 0x1F3FD, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FD, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3C3, 0x1F3FD, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FD, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F3C3, 0x1F3FD, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FD, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3C3, 0x1F3FD, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FD, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FD, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FE},
-    {0x1F3C3, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F3C3, 0x1F3FE, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FE, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3C3, 0x1F3FE, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FE, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F3C3, 0x1F3FE, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FE, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3C3, 0x1F3FE, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FE, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FE, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FE, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FF},
-    {0x1F3C3, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F3C3, 0x1F3FF, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FF, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3C3, 0x1F3FF, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FF, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F3C3, 0x1F3FF, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FF, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3C3, 0x1F3FF, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FF, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C3, 0x1F3FF, 0x200D, 0x27A1},
-    {0x1F3C3, 0x1F3FF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F3C4},
-    {0x1F3C4, 0x200D, 0x2640},
-    {0x1F3C4, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3C4, 0x200D, 0x2642},
-    {0x1F3C4, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3C4, 0x1F3FB},
-    {0x1F3C4, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F3C4, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3C4, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F3C4, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3C4, 0x1F3FC},
-    {0x1F3C4, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F3C4, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3C4, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F3C4, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3C4, 0x1F3FD},
-    {0x1F3C4, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F3C4, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3C4, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F3C4, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3C4, 0x1F3FE},
-    {0x1F3C4, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F3C4, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3C4, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F3C4, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3C4, 0x1F3FF},
-    {0x1F3C4, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F3C4, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3C4, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F3C4, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3C5},
-    {0x1F3C6},
-    {0x1F3C7},
-    {0x1F3C7, 0x1F3FB},
-    {0x1F3C7, 0x1F3FC},
-    {0x1F3C7, 0x1F3FD},
-    {0x1F3C7, 0x1F3FE},
-    {0x1F3C7, 0x1F3FF},
-    {0x1F3C8},
-    {0x1F3C9},
-    {0x1F3CA},
-    {0x1F3CA, 0x200D, 0x2640},
-    {0x1F3CA, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CA, 0x200D, 0x2642},
-    {0x1F3CA, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CA, 0x1F3FB},
-    {0x1F3CA, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F3CA, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CA, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F3CA, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CA, 0x1F3FC},
-    {0x1F3CA, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F3CA, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CA, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F3CA, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CA, 0x1F3FD},
-    {0x1F3CA, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F3CA, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CA, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F3CA, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CA, 0x1F3FE},
-    {0x1F3CA, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F3CA, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CA, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F3CA, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CA, 0x1F3FF},
-    {0x1F3CA, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F3CA, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CA, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F3CA, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CB, 0xFE0F},
-    {0x1F3CB, 0xFE0F, 0x200D, 0x2640},
-    {0x1F3CB, 0xFE0F, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CB, 0xFE0F, 0x200D, 0x2642},
-    {0x1F3CB, 0xFE0F, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CB, 0x1F3FB},
-    {0x1F3CB, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F3CB, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CB, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F3CB, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CB, 0x1F3FC},
-    {0x1F3CB, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F3CB, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CB, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F3CB, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CB, 0x1F3FD},
-    {0x1F3CB, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F3CB, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CB, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F3CB, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CB, 0x1F3FE},
-    {0x1F3CB, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F3CB, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CB, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F3CB, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CB, 0x1F3FF},
-    {0x1F3CB, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F3CB, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CB, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F3CB, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CC, 0xFE0F},
-    {0x1F3CC, 0xFE0F, 0x200D, 0x2640},
-    {0x1F3CC, 0xFE0F, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CC, 0xFE0F, 0x200D, 0x2642},
-    {0x1F3CC, 0xFE0F, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CC, 0x1F3FB},
-    {0x1F3CC, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F3CC, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CC, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F3CC, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CC, 0x1F3FC},
-    {0x1F3CC, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F3CC, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CC, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F3CC, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CC, 0x1F3FD},
-    {0x1F3CC, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F3CC, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CC, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F3CC, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CC, 0x1F3FE},
-    {0x1F3CC, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F3CC, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CC, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F3CC, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CC, 0x1F3FF},
-    {0x1F3CC, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F3CC, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F3CC, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F3CC, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F3CD, 0xFE0F},
-    {0x1F3CE, 0xFE0F},
-    {0x1F3CF},
-    {0x1F3D0},
-    {0x1F3D1},
-    {0x1F3D2},
-    {0x1F3D3},
-    {0x1F3D4, 0xFE0F},
-    {0x1F3D5, 0xFE0F},
-    {0x1F3D6, 0xFE0F},
-    {0x1F3D7, 0xFE0F},
-    {0x1F3D8, 0xFE0F},
-    {0x1F3D9, 0xFE0F},
-    {0x1F3DA, 0xFE0F},
-    {0x1F3DB, 0xFE0F},
-    {0x1F3DC, 0xFE0F},
-    {0x1F3DD, 0xFE0F},
-    {0x1F3DE, 0xFE0F},
-    {0x1F3DF, 0xFE0F},
-    {0x1F3E0},
-    {0x1F3E1},
-    {0x1F3E2},
-    {0x1F3E3},
-    {0x1F3E4},
-    {0x1F3E5},
-    {0x1F3E6},
-    {0x1F3E7},
-    {0x1F3E8},
-    {0x1F3E9},
-    {0x1F3EA},
-    {0x1F3EB},
-    {0x1F3EC},
-    {0x1F3ED},
-    {0x1F3EE},
-    {0x1F3EF},
-    {0x1F3F0},
-    {0x1F3F3, 0xFE0F},
-    {0x1F3F3, 0xFE0F, 0x200D, 0x26A7},
-    {0x1F3F3, 0xFE0F, 0x200D, 0x26A7, 0xFE0F},
-    {0x1F3F3, 0xFE0F, 0x200D, 0x1F308},
-    {0x1F3F4},
-    {0x1F3F4, 0x200D, 0x2620},
-    {0x1F3F4, 0x200D, 0x2620, 0xFE0F},
-    {0x1F3F4, 0xE0067, 0xE0062, 0xE0065, 0xE006E, 0xE0067, 0xE007F},
-    {0x1F3F4, 0xE0067, 0xE0062, 0xE0073, 0xE0063, 0xE0074, 0xE007F},
-    {0x1F3F4, 0xE0067, 0xE0062, 0xE0077, 0xE006C, 0xE0073, 0xE007F},
-    {0x1F3F5, 0xFE0F},
-    {0x1F3F7, 0xFE0F},
-    {0x1F3F8},
-    {0x1F3F9},
-    {0x1F3FA},
-    {0x1F400},
-    {0x1F401},
-    {0x1F402},
-    {0x1F403},
-    {0x1F404},
-    {0x1F405},
-    {0x1F406},
-    {0x1F407},
-    {0x1F408},
-    {0x1F408, 0x200D, 0x2B1B},
-    {0x1F409},
-    {0x1F40A},
-    {0x1F40B},
-    {0x1F40C},
-    {0x1F40D},
-    {0x1F40E},
-    {0x1F40F},
-    {0x1F410},
-    {0x1F411},
-    {0x1F412},
-    {0x1F413},
-    {0x1F414},
-    {0x1F415},
-    {0x1F415, 0x200D, 0x1F9BA},
-    {0x1F416},
-    {0x1F417},
-    {0x1F418},
-    {0x1F419},
-    {0x1F41A},
-    {0x1F41B},
-    {0x1F41C},
-    {0x1F41D},
-    {0x1F41E},
-    {0x1F41F},
-    {0x1F420},
-    {0x1F421},
-    {0x1F422},
-    {0x1F423},
-    {0x1F424},
-    {0x1F425},
-    {0x1F426},
-    {0x1F426, 0x200D, 0x2B1B},
-    {0x1F426, 0x200D, 0x1F525},
-    {0x1F427},
-    {0x1F428},
-    {0x1F429},
-    {0x1F42A},
-    {0x1F42B},
-    {0x1F42C},
-    {0x1F42D},
-    {0x1F42E},
-    {0x1F42F},
-    {0x1F430},
-    {0x1F431},
-    {0x1F432},
-    {0x1F433},
-    {0x1F434},
-    {0x1F435},
-    {0x1F436},
-    {0x1F437},
-    {0x1F438},
-    {0x1F439},
-    {0x1F43A},
-    {0x1F43B},
-    {0x1F43B, 0x200D, 0x2744},
-    {0x1F43B, 0x200D, 0x2744, 0xFE0F},
-    {0x1F43C},
-    {0x1F43D},
-    {0x1F43E},
-    {0x1F43F, 0xFE0F},
-    {0x1F440},
-    {0x1F441, 0xFE0F},
-    {0x1F441, 0xFE0F, 0x200D, 0x1F5E8},
-    {0x1F441, 0xFE0F, 0x200D, 0x1F5E8, 0xFE0F},
-    {0x1F442},
-    {0x1F442, 0x1F3FB},
-    {0x1F442, 0x1F3FC},
-    {0x1F442, 0x1F3FD},
-    {0x1F442, 0x1F3FE},
-    {0x1F442, 0x1F3FF},
-    {0x1F443},
-    {0x1F443, 0x1F3FB},
-    {0x1F443, 0x1F3FC},
-    {0x1F443, 0x1F3FD},
-    {0x1F443, 0x1F3FE},
-    {0x1F443, 0x1F3FF},
-    {0x1F444},
-    {0x1F445},
-    {0x1F446},
-    {0x1F446, 0x1F3FB},
-    {0x1F446, 0x1F3FC},
-    {0x1F446, 0x1F3FD},
-    {0x1F446, 0x1F3FE},
-    {0x1F446, 0x1F3FF},
-    {0x1F447},
-    {0x1F447, 0x1F3FB},
-    {0x1F447, 0x1F3FC},
-    {0x1F447, 0x1F3FD},
-    {0x1F447, 0x1F3FE},
-    {0x1F447, 0x1F3FF},
-    {0x1F448},
-    {0x1F448, 0x1F3FB},
-    {0x1F448, 0x1F3FC},
-    {0x1F448, 0x1F3FD},
-    {0x1F448, 0x1F3FE},
-    {0x1F448, 0x1F3FF},
-    {0x1F449},
-    {0x1F449, 0x1F3FB},
-    {0x1F449, 0x1F3FC},
-    {0x1F449, 0x1F3FD},
-    {0x1F449, 0x1F3FE},
-    {0x1F449, 0x1F3FF},
-    {0x1F44A},
-    {0x1F44A, 0x1F3FB},
-    {0x1F44A, 0x1F3FC},
-    {0x1F44A, 0x1F3FD},
-    {0x1F44A, 0x1F3FE},
-    {0x1F44A, 0x1F3FF},
-    {0x1F44B},
-    {0x1F44B, 0x1F3FB},
-    {0x1F44B, 0x1F3FC},
-    {0x1F44B, 0x1F3FD},
-    {0x1F44B, 0x1F3FE},
-    {0x1F44B, 0x1F3FF},
-    {0x1F44C},
-    {0x1F44C, 0x1F3FB},
-    {0x1F44C, 0x1F3FC},
-    {0x1F44C, 0x1F3FD},
-    {0x1F44C, 0x1F3FE},
-    {0x1F44C, 0x1F3FF},
-    {0x1F44D},
-    {0x1F44D, 0x1F3FB},
-    {0x1F44D, 0x1F3FC},
-    {0x1F44D, 0x1F3FD},
-    {0x1F44D, 0x1F3FE},
-    {0x1F44D, 0x1F3FF},
-    {0x1F44E},
-    {0x1F44E, 0x1F3FB},
-    {0x1F44E, 0x1F3FC},
-    {0x1F44E, 0x1F3FD},
-    {0x1F44E, 0x1F3FE},
-    {0x1F44E, 0x1F3FF},
-    {0x1F44F},
-    {0x1F44F, 0x1F3FB},
-    {0x1F44F, 0x1F3FC},
-    {0x1F44F, 0x1F3FD},
-    {0x1F44F, 0x1F3FE},
-    {0x1F44F, 0x1F3FF},
-    {0x1F450},
-    {0x1F450, 0x1F3FB},
-    {0x1F450, 0x1F3FC},
-    {0x1F450, 0x1F3FD},
-    {0x1F450, 0x1F3FE},
-    {0x1F450, 0x1F3FF},
-    {0x1F451},
-    {0x1F452},
-    {0x1F453},
-    {0x1F454},
-    {0x1F455},
-    {0x1F456},
-    {0x1F457},
-    {0x1F458},
-    {0x1F459},
-    {0x1F45A},
-    {0x1F45B},
-    {0x1F45C},
-    {0x1F45D},
-    {0x1F45E},
-    {0x1F45F},
-    {0x1F460},
-    {0x1F461},
-    {0x1F462},
-    {0x1F463},
-    {0x1F464},
-    {0x1F465},
-    {0x1F466},
-    {0x1F466, 0x1F3FB},
-    {0x1F466, 0x1F3FC},
-    {0x1F466, 0x1F3FD},
-    {0x1F466, 0x1F3FE},
-    {0x1F466, 0x1F3FF},
-    {0x1F467},
-    {0x1F467, 0x1F3FB},
-    {0x1F467, 0x1F3FC},
-    {0x1F467, 0x1F3FD},
-    {0x1F467, 0x1F3FE},
-    {0x1F467, 0x1F3FF},
-    {0x1F468},
-    {0x1F468, 0x200D, 0x2695},
-    {0x1F468, 0x200D, 0x2695, 0xFE0F},
-    {0x1F468, 0x200D, 0x2696},
-    {0x1F468, 0x200D, 0x2696, 0xFE0F},
-    {0x1F468, 0x200D, 0x2708},
-    {0x1F468, 0x200D, 0x2708, 0xFE0F},
-    {0x1F468, 0x200D, 0x2764, 0x200D, 0x1F468},
-    {0x1F468, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468},
-    {0x1F468, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468},
-    {0x1F468, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468},
-    {0x1F468, 0x200D, 0x1F33E},
-    {0x1F468, 0x200D, 0x1F373},
-    {0x1F468, 0x200D, 0x1F37C},
-    {0x1F468, 0x200D, 0x1F393},
-    {0x1F468, 0x200D, 0x1F3A4},
-    {0x1F468, 0x200D, 0x1F3A8},
-    {0x1F468, 0x200D, 0x1F3EB},
-    {0x1F468, 0x200D, 0x1F3ED},
-    {0x1F468, 0x200D, 0x1F466},
-    {0x1F468, 0x200D, 0x1F466, 0x200D, 0x1F466},
-    {0x1F468, 0x200D, 0x1F467},
-    {0x1F468, 0x200D, 0x1F467, 0x200D, 0x1F466},
-    {0x1F468, 0x200D, 0x1F467, 0x200D, 0x1F467},
-    {0x1F468, 0x200D, 0x1F468, 0x200D, 0x1F466},
-    {0x1F468, 0x200D, 0x1F468, 0x200D, 0x1F466, 0x200D, 0x1F466},
-    {0x1F468, 0x200D, 0x1F468, 0x200D, 0x1F467},
-    {0x1F468, 0x200D, 0x1F468, 0x200D, 0x1F467, 0x200D, 0x1F466},
-    {0x1F468, 0x200D, 0x1F468, 0x200D, 0x1F467, 0x200D, 0x1F467},
-    {0x1F468, 0x200D, 0x1F469, 0x200D, 0x1F466},
-    {0x1F468, 0x200D, 0x1F469, 0x200D, 0x1F466, 0x200D, 0x1F466},
-    {0x1F468, 0x200D, 0x1F469, 0x200D, 0x1F467},
-    {0x1F468, 0x200D, 0x1F469, 0x200D, 0x1F467, 0x200D, 0x1F466},
-    {0x1F468, 0x200D, 0x1F469, 0x200D, 0x1F467, 0x200D, 0x1F467},
-    {0x1F468, 0x200D, 0x1F4BB},
-    {0x1F468, 0x200D, 0x1F4BC},
-    {0x1F468, 0x200D, 0x1F527},
-    {0x1F468, 0x200D, 0x1F52C},
-    {0x1F468, 0x200D, 0x1F680},
-    {0x1F468, 0x200D, 0x1F692},
-    {0x1F468, 0x200D, 0x1F9AF},
-    {0x1F468, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F468, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x200D, 0x1F9B0},
-    {0x1F468, 0x200D, 0x1F9B1},
-    {0x1F468, 0x200D, 0x1F9B2},
-    {0x1F468, 0x200D, 0x1F9B3},
-    {0x1F468, 0x200D, 0x1F9BC},
-    {0x1F468, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F468, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x200D, 0x1F9BD},
-    {0x1F468, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F468, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2695},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2695, 0xFE0F},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2696},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2696, 0xFE0F},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2708},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2708, 0xFE0F},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F33E},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F373},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F37C},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F393},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F3A4},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F3A8},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F3EB},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F3ED},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F4BB},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F4BC},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F527},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F52C},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F680},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F692},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F9AF},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F9B0},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F9B1},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F9B2},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F9B3},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F9BC},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F9BD},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FB, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2695},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2695, 0xFE0F},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2696},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2696, 0xFE0F},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2708},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2708, 0xFE0F},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F33E},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F373},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F37C},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F393},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F3A4},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F3A8},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F3EB},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F3ED},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F4BB},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F4BC},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F527},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F52C},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F680},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F692},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F9AF},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F9B0},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F9B1},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F9B2},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F9B3},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F9BC},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F9BD},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FC, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2695},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2695, 0xFE0F},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2696},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2696, 0xFE0F},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2708},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2708, 0xFE0F},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F33E},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F373},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F37C},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F393},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F3A4},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F3A8},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F3EB},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F3ED},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F4BB},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F4BC},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F527},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F52C},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F680},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F692},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F9AF},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F9B0},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F9B1},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F9B2},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F9B3},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F9BC},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F9BD},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FD, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2695},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2695, 0xFE0F},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2696},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2696, 0xFE0F},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2708},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2708, 0xFE0F},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F33E},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F373},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F37C},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F393},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F3A4},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F3A8},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F3EB},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F3ED},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F4BB},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F4BC},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F527},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F52C},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F680},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F692},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F9AF},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F9B0},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F9B1},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F9B2},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F9B3},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F9BC},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F9BD},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FE, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2695},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2695, 0xFE0F},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2696},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2696, 0xFE0F},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2708},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2708, 0xFE0F},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F33E},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F373},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F37C},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F393},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F3A4},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F3A8},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F3EB},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F3ED},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F4BB},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F4BC},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F527},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F52C},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F680},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F692},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F9AF},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F9B0},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F9B1},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F9B2},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F9B3},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F9BC},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F9BD},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F468, 0x1F3FF, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469},
-    {0x1F469, 0x200D, 0x2695},
-    {0x1F469, 0x200D, 0x2695, 0xFE0F},
-    {0x1F469, 0x200D, 0x2696},
-    {0x1F469, 0x200D, 0x2696, 0xFE0F},
-    {0x1F469, 0x200D, 0x2708},
-    {0x1F469, 0x200D, 0x2708, 0xFE0F},
-    {0x1F469, 0x200D, 0x2764, 0x200D, 0x1F468},
-    {0x1F469, 0x200D, 0x2764, 0x200D, 0x1F469},
-    {0x1F469, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468},
-    {0x1F469, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469},
-    {0x1F469, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468},
-    {0x1F469, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469},
-    {0x1F469, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468},
-    {0x1F469, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469},
-    {0x1F469, 0x200D, 0x1F33E},
-    {0x1F469, 0x200D, 0x1F373},
-    {0x1F469, 0x200D, 0x1F37C},
-    {0x1F469, 0x200D, 0x1F393},
-    {0x1F469, 0x200D, 0x1F3A4},
-    {0x1F469, 0x200D, 0x1F3A8},
-    {0x1F469, 0x200D, 0x1F3EB},
-    {0x1F469, 0x200D, 0x1F3ED},
-    {0x1F469, 0x200D, 0x1F466},
-    {0x1F469, 0x200D, 0x1F466, 0x200D, 0x1F466},
-    {0x1F469, 0x200D, 0x1F467},
-    {0x1F469, 0x200D, 0x1F467, 0x200D, 0x1F466},
-    {0x1F469, 0x200D, 0x1F467, 0x200D, 0x1F467},
-    {0x1F469, 0x200D, 0x1F469, 0x200D, 0x1F466},
-    {0x1F469, 0x200D, 0x1F469, 0x200D, 0x1F466, 0x200D, 0x1F466},
-    {0x1F469, 0x200D, 0x1F469, 0x200D, 0x1F467},
-    {0x1F469, 0x200D, 0x1F469, 0x200D, 0x1F467, 0x200D, 0x1F466},
-    {0x1F469, 0x200D, 0x1F469, 0x200D, 0x1F467, 0x200D, 0x1F467},
-    {0x1F469, 0x200D, 0x1F4BB},
-    {0x1F469, 0x200D, 0x1F4BC},
-    {0x1F469, 0x200D, 0x1F527},
-    {0x1F469, 0x200D, 0x1F52C},
-    {0x1F469, 0x200D, 0x1F680},
-    {0x1F469, 0x200D, 0x1F692},
-    {0x1F469, 0x200D, 0x1F9AF},
-    {0x1F469, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F469, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x200D, 0x1F9B0},
-    {0x1F469, 0x200D, 0x1F9B1},
-    {0x1F469, 0x200D, 0x1F9B2},
-    {0x1F469, 0x200D, 0x1F9B3},
-    {0x1F469, 0x200D, 0x1F9BC},
-    {0x1F469, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F469, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x200D, 0x1F9BD},
-    {0x1F469, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F469, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2695},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2695, 0xFE0F},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2696},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2696, 0xFE0F},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2708},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2708, 0xFE0F},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F33E},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F373},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F37C},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F393},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F3A4},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F3A8},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F3EB},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F3ED},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F4BB},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F4BC},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F527},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F52C},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F680},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F692},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F9AF},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F9B0},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F9B1},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F9B2},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F9B3},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F9BC},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F9BD},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FB, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2695},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2695, 0xFE0F},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2696},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2696, 0xFE0F},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2708},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2708, 0xFE0F},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F33E},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F373},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F37C},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F393},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F3A4},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F3A8},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F3EB},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F3ED},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F4BB},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F4BC},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F527},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F52C},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F680},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F692},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F9AF},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F9B0},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F9B1},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F9B2},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F9B3},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F9BC},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F9BD},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FC, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2695},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2695, 0xFE0F},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2696},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2696, 0xFE0F},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2708},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2708, 0xFE0F},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F33E},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F373},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F37C},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F393},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F3A4},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F3A8},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F3EB},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F3ED},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F4BB},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F4BC},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F527},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F52C},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F680},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F692},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F9AF},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F9B0},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F9B1},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F9B2},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F9B3},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F9BC},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F9BD},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FD, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2695},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2695, 0xFE0F},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2696},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2696, 0xFE0F},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2708},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2708, 0xFE0F},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F33E},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F373},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F37C},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F393},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F3A4},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F3A8},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F3EB},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F3ED},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F4BB},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F4BC},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F527},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F52C},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F680},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F692},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F9AF},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F9B0},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F9B1},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F9B2},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F9B3},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F9BC},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F9BD},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FE, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2695},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2695, 0xFE0F},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2696},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2696, 0xFE0F},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2708},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2708, 0xFE0F},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FF},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F33E},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F373},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F37C},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F393},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F3A4},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F3A8},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F3EB},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F3ED},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F4BB},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F4BC},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F527},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F52C},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F680},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F692},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FB},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FC},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FD},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FE},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FB},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FC},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FD},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FE},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F9AF},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F9B0},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F9B1},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F9B2},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F9B3},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F9BC},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F9BD},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F469, 0x1F3FF, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F46A},
-    {0x1F46B},
-    {0x1F46B, 0x1F3FB},
-    {0x1F46B, 0x1F3FC},
-    {0x1F46B, 0x1F3FD},
-    {0x1F46B, 0x1F3FE},
-    {0x1F46B, 0x1F3FF},
-    {0x1F46C},
-    {0x1F46C, 0x1F3FB},
-    {0x1F46C, 0x1F3FC},
-    {0x1F46C, 0x1F3FD},
-    {0x1F46C, 0x1F3FE},
-    {0x1F46C, 0x1F3FF},
-    {0x1F46D},
-    {0x1F46D, 0x1F3FB},
-    {0x1F46D, 0x1F3FC},
-    {0x1F46D, 0x1F3FD},
-    {0x1F46D, 0x1F3FE},
-    {0x1F46D, 0x1F3FF},
-    {0x1F46E},
-    {0x1F46E, 0x200D, 0x2640},
-    {0x1F46E, 0x200D, 0x2640, 0xFE0F},
-    {0x1F46E, 0x200D, 0x2642},
-    {0x1F46E, 0x200D, 0x2642, 0xFE0F},
-    {0x1F46E, 0x1F3FB},
-    {0x1F46E, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F46E, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F46E, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F46E, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F46E, 0x1F3FC},
-    {0x1F46E, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F46E, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F46E, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F46E, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F46E, 0x1F3FD},
-    {0x1F46E, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F46E, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F46E, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F46E, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F46E, 0x1F3FE},
-    {0x1F46E, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F46E, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F46E, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F46E, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F46E, 0x1F3FF},
-    {0x1F46E, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F46E, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F46E, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F46E, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F46F},
-    {0x1F46F, 0x200D, 0x2640},
-    {0x1F46F, 0x200D, 0x2640, 0xFE0F},
-    {0x1F46F, 0x200D, 0x2642},
-    {0x1F46F, 0x200D, 0x2642, 0xFE0F},
-    {0x1F470},
-    {0x1F470, 0x200D, 0x2640},
-    {0x1F470, 0x200D, 0x2640, 0xFE0F},
-    {0x1F470, 0x200D, 0x2642},
-    {0x1F470, 0x200D, 0x2642, 0xFE0F},
-    {0x1F470, 0x1F3FB},
-    {0x1F470, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F470, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F470, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F470, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F470, 0x1F3FC},
-    {0x1F470, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F470, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F470, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F470, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F470, 0x1F3FD},
-    {0x1F470, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F470, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F470, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F470, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F470, 0x1F3FE},
-    {0x1F470, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F470, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F470, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F470, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F470, 0x1F3FF},
-    {0x1F470, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F470, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F470, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F470, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F471},
-    {0x1F471, 0x200D, 0x2640},
-    {0x1F471, 0x200D, 0x2640, 0xFE0F},
-    {0x1F471, 0x200D, 0x2642},
-    {0x1F471, 0x200D, 0x2642, 0xFE0F},
-    {0x1F471, 0x1F3FB},
-    {0x1F471, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F471, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F471, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F471, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F471, 0x1F3FC},
-    {0x1F471, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F471, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F471, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F471, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F471, 0x1F3FD},
-    {0x1F471, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F471, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F471, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F471, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F471, 0x1F3FE},
-    {0x1F471, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F471, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F471, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F471, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F471, 0x1F3FF},
-    {0x1F471, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F471, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F471, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F471, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F472},
-    {0x1F472, 0x1F3FB},
-    {0x1F472, 0x1F3FC},
-    {0x1F472, 0x1F3FD},
-    {0x1F472, 0x1F3FE},
-    {0x1F472, 0x1F3FF},
-    {0x1F473},
-    {0x1F473, 0x200D, 0x2640},
-    {0x1F473, 0x200D, 0x2640, 0xFE0F},
-    {0x1F473, 0x200D, 0x2642},
-    {0x1F473, 0x200D, 0x2642, 0xFE0F},
-    {0x1F473, 0x1F3FB},
-    {0x1F473, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F473, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F473, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F473, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F473, 0x1F3FC},
-    {0x1F473, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F473, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F473, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F473, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F473, 0x1F3FD},
-    {0x1F473, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F473, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F473, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F473, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F473, 0x1F3FE},
-    {0x1F473, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F473, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F473, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F473, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F473, 0x1F3FF},
-    {0x1F473, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F473, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F473, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F473, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F474},
-    {0x1F474, 0x1F3FB},
-    {0x1F474, 0x1F3FC},
-    {0x1F474, 0x1F3FD},
-    {0x1F474, 0x1F3FE},
-    {0x1F474, 0x1F3FF},
-    {0x1F475},
-    {0x1F475, 0x1F3FB},
-    {0x1F475, 0x1F3FC},
-    {0x1F475, 0x1F3FD},
-    {0x1F475, 0x1F3FE},
-    {0x1F475, 0x1F3FF},
-    {0x1F476},
-    {0x1F476, 0x1F3FB},
-    {0x1F476, 0x1F3FC},
-    {0x1F476, 0x1F3FD},
-    {0x1F476, 0x1F3FE},
-    {0x1F476, 0x1F3FF},
-    {0x1F477},
-    {0x1F477, 0x200D, 0x2640},
-    {0x1F477, 0x200D, 0x2640, 0xFE0F},
-    {0x1F477, 0x200D, 0x2642},
-    {0x1F477, 0x200D, 0x2642, 0xFE0F},
-    {0x1F477, 0x1F3FB},
-    {0x1F477, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F477, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F477, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F477, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F477, 0x1F3FC},
-    {0x1F477, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F477, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F477, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F477, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F477, 0x1F3FD},
-    {0x1F477, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F477, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F477, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F477, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F477, 0x1F3FE},
-    {0x1F477, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F477, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F477, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F477, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F477, 0x1F3FF},
-    {0x1F477, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F477, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F477, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F477, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F478},
-    {0x1F478, 0x1F3FB},
-    {0x1F478, 0x1F3FC},
-    {0x1F478, 0x1F3FD},
-    {0x1F478, 0x1F3FE},
-    {0x1F478, 0x1F3FF},
-    {0x1F479},
-    {0x1F47A},
-    {0x1F47B},
-    {0x1F47C},
-    {0x1F47C, 0x1F3FB},
-    {0x1F47C, 0x1F3FC},
-    {0x1F47C, 0x1F3FD},
-    {0x1F47C, 0x1F3FE},
-    {0x1F47C, 0x1F3FF},
-    {0x1F47D},
-    {0x1F47E},
-    {0x1F47F},
-    {0x1F480},
-    {0x1F481},
-    {0x1F481, 0x200D, 0x2640},
-    {0x1F481, 0x200D, 0x2640, 0xFE0F},
-    {0x1F481, 0x200D, 0x2642},
-    {0x1F481, 0x200D, 0x2642, 0xFE0F},
-    {0x1F481, 0x1F3FB},
-    {0x1F481, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F481, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F481, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F481, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F481, 0x1F3FC},
-    {0x1F481, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F481, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F481, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F481, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F481, 0x1F3FD},
-    {0x1F481, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F481, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F481, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F481, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F481, 0x1F3FE},
-    {0x1F481, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F481, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F481, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F481, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F481, 0x1F3FF},
-    {0x1F481, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F481, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F481, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F481, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F482},
-    {0x1F482, 0x200D, 0x2640},
-    {0x1F482, 0x200D, 0x2640, 0xFE0F},
-    {0x1F482, 0x200D, 0x2642},
-    {0x1F482, 0x200D, 0x2642, 0xFE0F},
-    {0x1F482, 0x1F3FB},
-    {0x1F482, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F482, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F482, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F482, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F482, 0x1F3FC},
-    {0x1F482, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F482, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F482, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F482, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F482, 0x1F3FD},
-    {0x1F482, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F482, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F482, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F482, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F482, 0x1F3FE},
-    {0x1F482, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F482, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F482, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F482, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F482, 0x1F3FF},
-    {0x1F482, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F482, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F482, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F482, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F483},
-    {0x1F483, 0x1F3FB},
-    {0x1F483, 0x1F3FC},
-    {0x1F483, 0x1F3FD},
-    {0x1F483, 0x1F3FE},
-    {0x1F483, 0x1F3FF},
-    {0x1F484},
-    {0x1F485},
-    {0x1F485, 0x1F3FB},
-    {0x1F485, 0x1F3FC},
-    {0x1F485, 0x1F3FD},
-    {0x1F485, 0x1F3FE},
-    {0x1F485, 0x1F3FF},
-    {0x1F486},
-    {0x1F486, 0x200D, 0x2640},
-    {0x1F486, 0x200D, 0x2640, 0xFE0F},
-    {0x1F486, 0x200D, 0x2642},
-    {0x1F486, 0x200D, 0x2642, 0xFE0F},
-    {0x1F486, 0x1F3FB},
-    {0x1F486, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F486, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F486, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F486, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F486, 0x1F3FC},
-    {0x1F486, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F486, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F486, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F486, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F486, 0x1F3FD},
-    {0x1F486, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F486, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F486, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F486, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F486, 0x1F3FE},
-    {0x1F486, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F486, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F486, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F486, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F486, 0x1F3FF},
-    {0x1F486, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F486, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F486, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F486, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F487},
-    {0x1F487, 0x200D, 0x2640},
-    {0x1F487, 0x200D, 0x2640, 0xFE0F},
-    {0x1F487, 0x200D, 0x2642},
-    {0x1F487, 0x200D, 0x2642, 0xFE0F},
-    {0x1F487, 0x1F3FB},
-    {0x1F487, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F487, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F487, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F487, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F487, 0x1F3FC},
-    {0x1F487, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F487, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F487, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F487, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F487, 0x1F3FD},
-    {0x1F487, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F487, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F487, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F487, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F487, 0x1F3FE},
-    {0x1F487, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F487, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F487, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F487, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F487, 0x1F3FF},
-    {0x1F487, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F487, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F487, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F487, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F488},
-    {0x1F489},
-    {0x1F48A},
-    {0x1F48B},
-    {0x1F48C},
-    {0x1F48D},
-    {0x1F48E},
-    {0x1F48F},
-    {0x1F48F, 0x1F3FB},
-    {0x1F48F, 0x1F3FC},
-    {0x1F48F, 0x1F3FD},
-    {0x1F48F, 0x1F3FE},
-    {0x1F48F, 0x1F3FF},
-    {0x1F490},
-    {0x1F491},
-    {0x1F491, 0x1F3FB},
-    {0x1F491, 0x1F3FC},
-    {0x1F491, 0x1F3FD},
-    {0x1F491, 0x1F3FE},
-    {0x1F491, 0x1F3FF},
-    {0x1F492},
-    {0x1F493},
-    {0x1F494},
-    {0x1F495},
-    {0x1F496},
-    {0x1F497},
-    {0x1F498},
-    {0x1F499},
-    {0x1F49A},
-    {0x1F49B},
-    {0x1F49C},
-    {0x1F49D},
-    {0x1F49E},
-    {0x1F49F},
-    {0x1F4A0},
-    {0x1F4A1},
-    {0x1F4A2},
-    {0x1F4A3},
-    {0x1F4A4},
-    {0x1F4A5},
-    {0x1F4A6},
-    {0x1F4A7},
-    {0x1F4A8},
-    {0x1F4A9},
-    {0x1F4AA},
-    {0x1F4AA, 0x1F3FB},
-    {0x1F4AA, 0x1F3FC},
-    {0x1F4AA, 0x1F3FD},
-    {0x1F4AA, 0x1F3FE},
-    {0x1F4AA, 0x1F3FF},
-    {0x1F4AB},
-    {0x1F4AC},
-    {0x1F4AD},
-    {0x1F4AE},
-    {0x1F4AF},
-    {0x1F4B0},
-    {0x1F4B1},
-    {0x1F4B2},
-    {0x1F4B3},
-    {0x1F4B4},
-    {0x1F4B5},
-    {0x1F4B6},
-    {0x1F4B7},
-    {0x1F4B8},
-    {0x1F4B9},
-    {0x1F4BA},
-    {0x1F4BB},
-    {0x1F4BC},
-    {0x1F4BD},
-    {0x1F4BE},
-    {0x1F4BF},
-    {0x1F4C0},
-    {0x1F4C1},
-    {0x1F4C2},
-    {0x1F4C3},
-    {0x1F4C4},
-    {0x1F4C5},
-    {0x1F4C6},
-    {0x1F4C7},
-    {0x1F4C8},
-    {0x1F4C9},
-    {0x1F4CA},
-    {0x1F4CB},
-    {0x1F4CC},
-    {0x1F4CD},
-    {0x1F4CE},
-    {0x1F4CF},
-    {0x1F4D0},
-    {0x1F4D1},
-    {0x1F4D2},
-    {0x1F4D3},
-    {0x1F4D4},
-    {0x1F4D5},
-    {0x1F4D6},
-    {0x1F4D7},
-    {0x1F4D8},
-    {0x1F4D9},
-    {0x1F4DA},
-    {0x1F4DB},
-    {0x1F4DC},
-    {0x1F4DD},
-    {0x1F4DE},
-    {0x1F4DF},
-    {0x1F4E0},
-    {0x1F4E1},
-    {0x1F4E2},
-    {0x1F4E3},
-    {0x1F4E4},
-    {0x1F4E5},
-    {0x1F4E6},
-    {0x1F4E7},
-    {0x1F4E8},
-    {0x1F4E9},
-    {0x1F4EA},
-    {0x1F4EB},
-    {0x1F4EC},
-    {0x1F4ED},
-    {0x1F4EE},
-    {0x1F4EF},
-    {0x1F4F0},
-    {0x1F4F1},
-    {0x1F4F2},
-    {0x1F4F3},
-    {0x1F4F4},
-    {0x1F4F5},
-    {0x1F4F6},
-    {0x1F4F7},
-    {0x1F4F8},
-    {0x1F4F9},
-    {0x1F4FA},
-    {0x1F4FB},
-    {0x1F4FC},
-    {0x1F4FD, 0xFE0F},
-    {0x1F4FF},
-    {0x1F500},
-    {0x1F501},
-    {0x1F502},
-    {0x1F503},
-    {0x1F504},
-    {0x1F505},
-    {0x1F506},
-    {0x1F507},
-    {0x1F508},
-    {0x1F509},
-    {0x1F50A},
-    {0x1F50B},
-    {0x1F50C},
-    {0x1F50D},
-    {0x1F50E},
-    {0x1F50F},
-    {0x1F510},
-    {0x1F511},
-    {0x1F512},
-    {0x1F513},
-    {0x1F514},
-    {0x1F515},
-    {0x1F516},
-    {0x1F517},
-    {0x1F518},
-    {0x1F519},
-    {0x1F51A},
-    {0x1F51B},
-    {0x1F51C},
-    {0x1F51D},
-    {0x1F51E},
-    {0x1F51F},
-    {0x1F520},
-    {0x1F521},
-    {0x1F522},
-    {0x1F523},
-    {0x1F524},
-    {0x1F525},
-    {0x1F526},
-    {0x1F527},
-    {0x1F528},
-    {0x1F529},
-    {0x1F52A},
-    {0x1F52B},
-    {0x1F52C},
-    {0x1F52D},
-    {0x1F52E},
-    {0x1F52F},
-    {0x1F530},
-    {0x1F531},
-    {0x1F532},
-    {0x1F533},
-    {0x1F534},
-    {0x1F535},
-    {0x1F536},
-    {0x1F537},
-    {0x1F538},
-    {0x1F539},
-    {0x1F53A},
-    {0x1F53B},
-    {0x1F53C},
-    {0x1F53D},
-    {0x1F549, 0xFE0F},
-    {0x1F54A, 0xFE0F},
-    {0x1F54B},
-    {0x1F54C},
-    {0x1F54D},
-    {0x1F54E},
-    {0x1F550},
-    {0x1F551},
-    {0x1F552},
-    {0x1F553},
-    {0x1F554},
-    {0x1F555},
-    {0x1F556},
-    {0x1F557},
-    {0x1F558},
-    {0x1F559},
-    {0x1F55A},
-    {0x1F55B},
-    {0x1F55C},
-    {0x1F55D},
-    {0x1F55E},
-    {0x1F55F},
-    {0x1F560},
-    {0x1F561},
-    {0x1F562},
-    {0x1F563},
-    {0x1F564},
-    {0x1F565},
-    {0x1F566},
-    {0x1F567},
-    {0x1F56F, 0xFE0F},
-    {0x1F570, 0xFE0F},
-    {0x1F573, 0xFE0F},
-    {0x1F574, 0xFE0F},
-    {0x1F574, 0x1F3FB},
-    {0x1F574, 0x1F3FC},
-    {0x1F574, 0x1F3FD},
-    {0x1F574, 0x1F3FE},
-    {0x1F574, 0x1F3FF},
-    {0x1F575, 0xFE0F},
-    {0x1F575, 0xFE0F, 0x200D, 0x2640},
-    {0x1F575, 0xFE0F, 0x200D, 0x2640, 0xFE0F},
-    {0x1F575, 0xFE0F, 0x200D, 0x2642},
-    {0x1F575, 0xFE0F, 0x200D, 0x2642, 0xFE0F},
-    {0x1F575, 0x1F3FB},
-    {0x1F575, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F575, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F575, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F575, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F575, 0x1F3FC},
-    {0x1F575, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F575, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F575, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F575, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F575, 0x1F3FD},
-    {0x1F575, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F575, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F575, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F575, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F575, 0x1F3FE},
-    {0x1F575, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F575, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F575, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F575, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F575, 0x1F3FF},
-    {0x1F575, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F575, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F575, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F575, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F576, 0xFE0F},
-    {0x1F577, 0xFE0F},
-    {0x1F578, 0xFE0F},
-    {0x1F579, 0xFE0F},
-    {0x1F57A},
-    {0x1F57A, 0x1F3FB},
-    {0x1F57A, 0x1F3FC},
-    {0x1F57A, 0x1F3FD},
-    {0x1F57A, 0x1F3FE},
-    {0x1F57A, 0x1F3FF},
-    {0x1F587, 0xFE0F},
-    {0x1F58A, 0xFE0F},
-    {0x1F58B, 0xFE0F},
-    {0x1F58C, 0xFE0F},
-    {0x1F58D, 0xFE0F},
-    {0x1F590, 0xFE0F},
-    {0x1F590, 0x1F3FB},
-    {0x1F590, 0x1F3FC},
-    {0x1F590, 0x1F3FD},
-    {0x1F590, 0x1F3FE},
-    {0x1F590, 0x1F3FF},
-    {0x1F595},
-    {0x1F595, 0x1F3FB},
-    {0x1F595, 0x1F3FC},
-    {0x1F595, 0x1F3FD},
-    {0x1F595, 0x1F3FE},
-    {0x1F595, 0x1F3FF},
-    {0x1F596},
-    {0x1F596, 0x1F3FB},
-    {0x1F596, 0x1F3FC},
-    {0x1F596, 0x1F3FD},
-    {0x1F596, 0x1F3FE},
-    {0x1F596, 0x1F3FF},
-    {0x1F5A4},
-    {0x1F5A5, 0xFE0F},
-    {0x1F5A8, 0xFE0F},
-    {0x1F5B1, 0xFE0F},
-    {0x1F5B2, 0xFE0F},
-    {0x1F5BC, 0xFE0F},
-    {0x1F5C2, 0xFE0F},
-    {0x1F5C3, 0xFE0F},
-    {0x1F5C4, 0xFE0F},
-    {0x1F5D1, 0xFE0F},
-    {0x1F5D2, 0xFE0F},
-    {0x1F5D3, 0xFE0F},
-    {0x1F5DC, 0xFE0F},
-    {0x1F5DD, 0xFE0F},
-    {0x1F5DE, 0xFE0F},
-    {0x1F5E1, 0xFE0F},
-    {0x1F5E3, 0xFE0F},
-    {0x1F5E8, 0xFE0F},
-    {0x1F5EF, 0xFE0F},
-    {0x1F5F3, 0xFE0F},
-    {0x1F5FA, 0xFE0F},
-    {0x1F5FB},
-    {0x1F5FC},
-    {0x1F5FD},
-    {0x1F5FE},
-    {0x1F5FF},
-    {0x1F600},
-    {0x1F601},
-    {0x1F602},
-    {0x1F603},
-    {0x1F604},
-    {0x1F605},
-    {0x1F606},
-    {0x1F607},
-    {0x1F608},
-    {0x1F609},
-    {0x1F60A},
-    {0x1F60B},
-    {0x1F60C},
-    {0x1F60D},
-    {0x1F60E},
-    {0x1F60F},
-    {0x1F610},
-    {0x1F611},
-    {0x1F612},
-    {0x1F613},
-    {0x1F614},
-    {0x1F615},
-    {0x1F616},
-    {0x1F617},
-    {0x1F618},
-    {0x1F619},
-    {0x1F61A},
-    {0x1F61B},
-    {0x1F61C},
-    {0x1F61D},
-    {0x1F61E},
-    {0x1F61F},
-    {0x1F620},
-    {0x1F621},
-    {0x1F622},
-    {0x1F623},
-    {0x1F624},
-    {0x1F625},
-    {0x1F626},
-    {0x1F627},
-    {0x1F628},
-    {0x1F629},
-    {0x1F62A},
-    {0x1F62B},
-    {0x1F62C},
-    {0x1F62D},
-    {0x1F62E},
-    {0x1F62E, 0x200D, 0x1F4A8},
-    {0x1F62F},
-    {0x1F630},
-    {0x1F631},
-    {0x1F632},
-    {0x1F633},
-    {0x1F634},
-    {0x1F635},
-    {0x1F635, 0x200D, 0x1F4AB},
-    {0x1F636},
-    {0x1F636, 0x200D, 0x1F32B},
-    {0x1F636, 0x200D, 0x1F32B, 0xFE0F},
-    {0x1F637},
-    {0x1F638},
-    {0x1F639},
-    {0x1F63A},
-    {0x1F63B},
-    {0x1F63C},
-    {0x1F63D},
-    {0x1F63E},
-    {0x1F63F},
-    {0x1F640},
-    {0x1F641},
-    {0x1F642},
-    {0x1F642, 0x200D, 0x2194},
-    {0x1F642, 0x200D, 0x2194, 0xFE0F},
-    {0x1F642, 0x200D, 0x2195},
-    {0x1F642, 0x200D, 0x2195, 0xFE0F},
-    {0x1F643},
-    {0x1F644},
-    {0x1F645},
-    {0x1F645, 0x200D, 0x2640},
-    {0x1F645, 0x200D, 0x2640, 0xFE0F},
-    {0x1F645, 0x200D, 0x2642},
-    {0x1F645, 0x200D, 0x2642, 0xFE0F},
-    {0x1F645, 0x1F3FB},
-    {0x1F645, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F645, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F645, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F645, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F645, 0x1F3FC},
-    {0x1F645, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F645, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F645, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F645, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F645, 0x1F3FD},
-    {0x1F645, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F645, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F645, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F645, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F645, 0x1F3FE},
-    {0x1F645, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F645, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F645, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F645, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F645, 0x1F3FF},
-    {0x1F645, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F645, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F645, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F645, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F646},
-    {0x1F646, 0x200D, 0x2640},
-    {0x1F646, 0x200D, 0x2640, 0xFE0F},
-    {0x1F646, 0x200D, 0x2642},
-    {0x1F646, 0x200D, 0x2642, 0xFE0F},
-    {0x1F646, 0x1F3FB},
-    {0x1F646, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F646, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F646, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F646, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F646, 0x1F3FC},
-    {0x1F646, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F646, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F646, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F646, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F646, 0x1F3FD},
-    {0x1F646, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F646, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F646, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F646, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F646, 0x1F3FE},
-    {0x1F646, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F646, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F646, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F646, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F646, 0x1F3FF},
-    {0x1F646, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F646, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F646, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F646, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F647},
-    {0x1F647, 0x200D, 0x2640},
-    {0x1F647, 0x200D, 0x2640, 0xFE0F},
-    {0x1F647, 0x200D, 0x2642},
-    {0x1F647, 0x200D, 0x2642, 0xFE0F},
-    {0x1F647, 0x1F3FB},
-    {0x1F647, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F647, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F647, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F647, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F647, 0x1F3FC},
-    {0x1F647, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F647, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F647, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F647, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F647, 0x1F3FD},
-    {0x1F647, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F647, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F647, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F647, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F647, 0x1F3FE},
-    {0x1F647, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F647, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F647, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F647, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F647, 0x1F3FF},
-    {0x1F647, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F647, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F647, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F647, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F648},
-    {0x1F649},
-    {0x1F64A},
-    {0x1F64B},
-    {0x1F64B, 0x200D, 0x2640},
-    {0x1F64B, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64B, 0x200D, 0x2642},
-    {0x1F64B, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64B, 0x1F3FB},
-    {0x1F64B, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F64B, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64B, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F64B, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64B, 0x1F3FC},
-    {0x1F64B, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F64B, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64B, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F64B, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64B, 0x1F3FD},
-    {0x1F64B, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F64B, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64B, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F64B, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64B, 0x1F3FE},
-    {0x1F64B, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F64B, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64B, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F64B, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64B, 0x1F3FF},
-    {0x1F64B, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F64B, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64B, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F64B, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64C},
-    {0x1F64C, 0x1F3FB},
-    {0x1F64C, 0x1F3FC},
-    {0x1F64C, 0x1F3FD},
-    {0x1F64C, 0x1F3FE},
-    {0x1F64C, 0x1F3FF},
-    {0x1F64D},
-    {0x1F64D, 0x200D, 0x2640},
-    {0x1F64D, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64D, 0x200D, 0x2642},
-    {0x1F64D, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64D, 0x1F3FB},
-    {0x1F64D, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F64D, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64D, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F64D, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64D, 0x1F3FC},
-    {0x1F64D, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F64D, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64D, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F64D, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64D, 0x1F3FD},
-    {0x1F64D, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F64D, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64D, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F64D, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64D, 0x1F3FE},
-    {0x1F64D, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F64D, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64D, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F64D, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64D, 0x1F3FF},
-    {0x1F64D, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F64D, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64D, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F64D, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64E},
-    {0x1F64E, 0x200D, 0x2640},
-    {0x1F64E, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64E, 0x200D, 0x2642},
-    {0x1F64E, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64E, 0x1F3FB},
-    {0x1F64E, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F64E, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64E, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F64E, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64E, 0x1F3FC},
-    {0x1F64E, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F64E, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64E, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F64E, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64E, 0x1F3FD},
-    {0x1F64E, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F64E, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64E, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F64E, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64E, 0x1F3FE},
-    {0x1F64E, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F64E, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64E, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F64E, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64E, 0x1F3FF},
-    {0x1F64E, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F64E, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F64E, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F64E, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F64F},
-    {0x1F64F, 0x1F3FB},
-    {0x1F64F, 0x1F3FC},
-    {0x1F64F, 0x1F3FD},
-    {0x1F64F, 0x1F3FE},
-    {0x1F64F, 0x1F3FF},
-    {0x1F680},
-    {0x1F681},
-    {0x1F682},
-    {0x1F683},
-    {0x1F684},
-    {0x1F685},
-    {0x1F686},
-    {0x1F687},
-    {0x1F688},
-    {0x1F689},
-    {0x1F68A},
-    {0x1F68B},
-    {0x1F68C},
-    {0x1F68D},
-    {0x1F68E},
-    {0x1F68F},
-    {0x1F690},
-    {0x1F691},
-    {0x1F692},
-    {0x1F693},
-    {0x1F694},
-    {0x1F695},
-    {0x1F696},
-    {0x1F697},
-    {0x1F698},
-    {0x1F699},
-    {0x1F69A},
-    {0x1F69B},
-    {0x1F69C},
-    {0x1F69D},
-    {0x1F69E},
-    {0x1F69F},
-    {0x1F6A0},
-    {0x1F6A1},
-    {0x1F6A2},
-    {0x1F6A3},
-    {0x1F6A3, 0x200D, 0x2640},
-    {0x1F6A3, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6A3, 0x200D, 0x2642},
-    {0x1F6A3, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6A3, 0x1F3FB},
-    {0x1F6A3, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F6A3, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6A3, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F6A3, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6A3, 0x1F3FC},
-    {0x1F6A3, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F6A3, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6A3, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F6A3, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6A3, 0x1F3FD},
-    {0x1F6A3, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F6A3, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6A3, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F6A3, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6A3, 0x1F3FE},
-    {0x1F6A3, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F6A3, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6A3, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F6A3, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6A3, 0x1F3FF},
-    {0x1F6A3, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F6A3, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6A3, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F6A3, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6A4},
-    {0x1F6A5},
-    {0x1F6A6},
-    {0x1F6A7},
-    {0x1F6A8},
-    {0x1F6A9},
-    {0x1F6AA},
-    {0x1F6AB},
-    {0x1F6AC},
-    {0x1F6AD},
-    {0x1F6AE},
-    {0x1F6AF},
-    {0x1F6B0},
-    {0x1F6B1},
-    {0x1F6B2},
-    {0x1F6B3},
-    {0x1F6B4},
-    {0x1F6B4, 0x200D, 0x2640},
-    {0x1F6B4, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B4, 0x200D, 0x2642},
-    {0x1F6B4, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B4, 0x1F3FB},
-    {0x1F6B4, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F6B4, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B4, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F6B4, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B4, 0x1F3FC},
-    {0x1F6B4, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F6B4, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B4, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F6B4, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B4, 0x1F3FD},
-    {0x1F6B4, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F6B4, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B4, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F6B4, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B4, 0x1F3FE},
-    {0x1F6B4, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F6B4, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B4, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F6B4, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B4, 0x1F3FF},
-    {0x1F6B4, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F6B4, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B4, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F6B4, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B5},
-    {0x1F6B5, 0x200D, 0x2640},
-    {0x1F6B5, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B5, 0x200D, 0x2642},
-    {0x1F6B5, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B5, 0x1F3FB},
-    {0x1F6B5, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F6B5, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B5, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F6B5, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B5, 0x1F3FC},
-    {0x1F6B5, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F6B5, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B5, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F6B5, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B5, 0x1F3FD},
-    {0x1F6B5, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F6B5, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B5, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F6B5, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B5, 0x1F3FE},
-    {0x1F6B5, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F6B5, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B5, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F6B5, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B5, 0x1F3FF},
-    {0x1F6B5, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F6B5, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B5, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F6B5, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B6},
-    {0x1F6B6, 0x200D, 0x2640},
-    {0x1F6B6, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F6B6, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B6, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F6B6, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x200D, 0x2642},
-    {0x1F6B6, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F6B6, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B6, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F6B6, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x200D, 0x27A1},
-    {0x1F6B6, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FB},
-    {0x1F6B6, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F6B6, 0x1F3FB, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FB, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B6, 0x1F3FB, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FB, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F6B6, 0x1F3FB, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FB, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B6, 0x1F3FB, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FB, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FB, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FB, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FC},
-    {0x1F6B6, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F6B6, 0x1F3FC, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FC, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B6, 0x1F3FC, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FC, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F6B6, 0x1F3FC, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FC, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B6, 0x1F3FC, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FC, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FC, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FD},
-    {0x1F6B6, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F6B6, 0x1F3FD, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FD, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B6, 0x1F3FD, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FD, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F6B6, 0x1F3FD, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FD, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B6, 0x1F3FD, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FD, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FD, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FE},
-    {0x1F6B6, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F6B6, 0x1F3FE, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FE, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B6, 0x1F3FE, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FE, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F6B6, 0x1F3FE, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FE, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B6, 0x1F3FE, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FE, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FE, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FE, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FF},
-    {0x1F6B6, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F6B6, 0x1F3FF, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FF, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F6B6, 0x1F3FF, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FF, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F6B6, 0x1F3FF, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FF, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F6B6, 0x1F3FF, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FF, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B6, 0x1F3FF, 0x200D, 0x27A1},
-    {0x1F6B6, 0x1F3FF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F6B7},
-    {0x1F6B8},
-    {0x1F6B9},
-    {0x1F6BA},
-    {0x1F6BB},
-    {0x1F6BC},
-    {0x1F6BD},
-    {0x1F6BE},
-    {0x1F6BF},
-    {0x1F6C0},
-    {0x1F6C0, 0x1F3FB},
-    {0x1F6C0, 0x1F3FC},
-    {0x1F6C0, 0x1F3FD},
-    {0x1F6C0, 0x1F3FE},
-    {0x1F6C0, 0x1F3FF},
-    {0x1F6C1},
-    {0x1F6C2},
-    {0x1F6C3},
-    {0x1F6C4},
-    {0x1F6C5},
-    {0x1F6CB, 0xFE0F},
-    {0x1F6CC},
-    {0x1F6CC, 0x1F3FB},
-    {0x1F6CC, 0x1F3FC},
-    {0x1F6CC, 0x1F3FD},
-    {0x1F6CC, 0x1F3FE},
-    {0x1F6CC, 0x1F3FF},
-    {0x1F6CD, 0xFE0F},
-    {0x1F6CE, 0xFE0F},
-    {0x1F6CF, 0xFE0F},
-    {0x1F6D0},
-    {0x1F6D1},
-    {0x1F6D2},
-    {0x1F6D5},
-    {0x1F6D6},
-    {0x1F6D7},
-    {0x1F6DC},
-    {0x1F6DD},
-    {0x1F6DE},
-    {0x1F6DF},
-    {0x1F6E0, 0xFE0F},
-    {0x1F6E1, 0xFE0F},
-    {0x1F6E2, 0xFE0F},
-    {0x1F6E3, 0xFE0F},
-    {0x1F6E4, 0xFE0F},
-    {0x1F6E5, 0xFE0F},
-    {0x1F6E9, 0xFE0F},
-    {0x1F6EB},
-    {0x1F6EC},
-    {0x1F6F0, 0xFE0F},
-    {0x1F6F3, 0xFE0F},
-    {0x1F6F4},
-    {0x1F6F5},
-    {0x1F6F6},
-    {0x1F6F7},
-    {0x1F6F8},
-    {0x1F6F9},
-    {0x1F6FA},
-    {0x1F6FB},
-    {0x1F6FC},
-    {0x1F7E0},
-    {0x1F7E1},
-    {0x1F7E2},
-    {0x1F7E3},
-    {0x1F7E4},
-    {0x1F7E5},
-    {0x1F7E6},
-    {0x1F7E7},
-    {0x1F7E8},
-    {0x1F7E9},
-    {0x1F7EA},
-    {0x1F7EB},
-    {0x1F7F0},
-    {0x1F90C},
-    {0x1F90C, 0x1F3FB},
-    {0x1F90C, 0x1F3FC},
-    {0x1F90C, 0x1F3FD},
-    {0x1F90C, 0x1F3FE},
-    {0x1F90C, 0x1F3FF},
-    {0x1F90D},
-    {0x1F90E},
-    {0x1F90F},
-    {0x1F90F, 0x1F3FB},
-    {0x1F90F, 0x1F3FC},
-    {0x1F90F, 0x1F3FD},
-    {0x1F90F, 0x1F3FE},
-    {0x1F90F, 0x1F3FF},
-    {0x1F910},
-    {0x1F911},
-    {0x1F912},
-    {0x1F913},
-    {0x1F914},
-    {0x1F915},
-    {0x1F916},
-    {0x1F917},
-    {0x1F918},
-    {0x1F918, 0x1F3FB},
-    {0x1F918, 0x1F3FC},
-    {0x1F918, 0x1F3FD},
-    {0x1F918, 0x1F3FE},
-    {0x1F918, 0x1F3FF},
-    {0x1F919},
-    {0x1F919, 0x1F3FB},
-    {0x1F919, 0x1F3FC},
-    {0x1F919, 0x1F3FD},
-    {0x1F919, 0x1F3FE},
-    {0x1F919, 0x1F3FF},
-    {0x1F91A},
-    {0x1F91A, 0x1F3FB},
-    {0x1F91A, 0x1F3FC},
-    {0x1F91A, 0x1F3FD},
-    {0x1F91A, 0x1F3FE},
-    {0x1F91A, 0x1F3FF},
-    {0x1F91B},
-    {0x1F91B, 0x1F3FB},
-    {0x1F91B, 0x1F3FC},
-    {0x1F91B, 0x1F3FD},
-    {0x1F91B, 0x1F3FE},
-    {0x1F91B, 0x1F3FF},
-    {0x1F91C},
-    {0x1F91C, 0x1F3FB},
-    {0x1F91C, 0x1F3FC},
-    {0x1F91C, 0x1F3FD},
-    {0x1F91C, 0x1F3FE},
-    {0x1F91C, 0x1F3FF},
-    {0x1F91D},
-    {0x1F91D, 0x1F3FB},
-    {0x1F91D, 0x1F3FC},
-    {0x1F91D, 0x1F3FD},
-    {0x1F91D, 0x1F3FE},
-    {0x1F91D, 0x1F3FF},
-    {0x1F91E},
-    {0x1F91E, 0x1F3FB},
-    {0x1F91E, 0x1F3FC},
-    {0x1F91E, 0x1F3FD},
-    {0x1F91E, 0x1F3FE},
-    {0x1F91E, 0x1F3FF},
-    {0x1F91F},
-    {0x1F91F, 0x1F3FB},
-    {0x1F91F, 0x1F3FC},
-    {0x1F91F, 0x1F3FD},
-    {0x1F91F, 0x1F3FE},
-    {0x1F91F, 0x1F3FF},
-    {0x1F920},
-    {0x1F921},
-    {0x1F922},
-    {0x1F923},
-    {0x1F924},
-    {0x1F925},
-    {0x1F926},
-    {0x1F926, 0x200D, 0x2640},
-    {0x1F926, 0x200D, 0x2640, 0xFE0F},
-    {0x1F926, 0x200D, 0x2642},
-    {0x1F926, 0x200D, 0x2642, 0xFE0F},
-    {0x1F926, 0x1F3FB},
-    {0x1F926, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F926, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F926, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F926, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F926, 0x1F3FC},
-    {0x1F926, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F926, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F926, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F926, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F926, 0x1F3FD},
-    {0x1F926, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F926, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F926, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F926, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F926, 0x1F3FE},
-    {0x1F926, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F926, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F926, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F926, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F926, 0x1F3FF},
-    {0x1F926, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F926, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F926, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F926, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F927},
-    {0x1F928},
-    {0x1F929},
-    {0x1F92A},
-    {0x1F92B},
-    {0x1F92C},
-    {0x1F92D},
-    {0x1F92E},
-    {0x1F92F},
-    {0x1F930},
-    {0x1F930, 0x1F3FB},
-    {0x1F930, 0x1F3FC},
-    {0x1F930, 0x1F3FD},
-    {0x1F930, 0x1F3FE},
-    {0x1F930, 0x1F3FF},
-    {0x1F931},
-    {0x1F931, 0x1F3FB},
-    {0x1F931, 0x1F3FC},
-    {0x1F931, 0x1F3FD},
-    {0x1F931, 0x1F3FE},
-    {0x1F931, 0x1F3FF},
-    {0x1F932},
-    {0x1F932, 0x1F3FB},
-    {0x1F932, 0x1F3FC},
-    {0x1F932, 0x1F3FD},
-    {0x1F932, 0x1F3FE},
-    {0x1F932, 0x1F3FF},
-    {0x1F933},
-    {0x1F933, 0x1F3FB},
-    {0x1F933, 0x1F3FC},
-    {0x1F933, 0x1F3FD},
-    {0x1F933, 0x1F3FE},
-    {0x1F933, 0x1F3FF},
-    {0x1F934},
-    {0x1F934, 0x1F3FB},
-    {0x1F934, 0x1F3FC},
-    {0x1F934, 0x1F3FD},
-    {0x1F934, 0x1F3FE},
-    {0x1F934, 0x1F3FF},
-    {0x1F935},
-    {0x1F935, 0x200D, 0x2640},
-    {0x1F935, 0x200D, 0x2640, 0xFE0F},
-    {0x1F935, 0x200D, 0x2642},
-    {0x1F935, 0x200D, 0x2642, 0xFE0F},
-    {0x1F935, 0x1F3FB},
-    {0x1F935, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F935, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F935, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F935, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F935, 0x1F3FC},
-    {0x1F935, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F935, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F935, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F935, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F935, 0x1F3FD},
-    {0x1F935, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F935, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F935, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F935, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F935, 0x1F3FE},
-    {0x1F935, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F935, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F935, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F935, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F935, 0x1F3FF},
-    {0x1F935, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F935, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F935, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F935, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F936},
-    {0x1F936, 0x1F3FB},
-    {0x1F936, 0x1F3FC},
-    {0x1F936, 0x1F3FD},
-    {0x1F936, 0x1F3FE},
-    {0x1F936, 0x1F3FF},
-    {0x1F937},
-    {0x1F937, 0x200D, 0x2640},
-    {0x1F937, 0x200D, 0x2640, 0xFE0F},
-    {0x1F937, 0x200D, 0x2642},
-    {0x1F937, 0x200D, 0x2642, 0xFE0F},
-    {0x1F937, 0x1F3FB},
-    {0x1F937, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F937, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F937, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F937, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F937, 0x1F3FC},
-    {0x1F937, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F937, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F937, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F937, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F937, 0x1F3FD},
-    {0x1F937, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F937, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F937, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F937, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F937, 0x1F3FE},
-    {0x1F937, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F937, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F937, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F937, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F937, 0x1F3FF},
-    {0x1F937, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F937, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F937, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F937, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F938},
-    {0x1F938, 0x200D, 0x2640},
-    {0x1F938, 0x200D, 0x2640, 0xFE0F},
-    {0x1F938, 0x200D, 0x2642},
-    {0x1F938, 0x200D, 0x2642, 0xFE0F},
-    {0x1F938, 0x1F3FB},
-    {0x1F938, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F938, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F938, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F938, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F938, 0x1F3FC},
-    {0x1F938, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F938, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F938, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F938, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F938, 0x1F3FD},
-    {0x1F938, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F938, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F938, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F938, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F938, 0x1F3FE},
-    {0x1F938, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F938, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F938, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F938, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F938, 0x1F3FF},
-    {0x1F938, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F938, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F938, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F938, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F939},
-    {0x1F939, 0x200D, 0x2640},
-    {0x1F939, 0x200D, 0x2640, 0xFE0F},
-    {0x1F939, 0x200D, 0x2642},
-    {0x1F939, 0x200D, 0x2642, 0xFE0F},
-    {0x1F939, 0x1F3FB},
-    {0x1F939, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F939, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F939, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F939, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F939, 0x1F3FC},
-    {0x1F939, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F939, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F939, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F939, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F939, 0x1F3FD},
-    {0x1F939, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F939, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F939, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F939, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F939, 0x1F3FE},
-    {0x1F939, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F939, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F939, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F939, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F939, 0x1F3FF},
-    {0x1F939, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F939, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F939, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F939, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F93A},
-    {0x1F93C},
-    {0x1F93C, 0x200D, 0x2640},
-    {0x1F93C, 0x200D, 0x2640, 0xFE0F},
-    {0x1F93C, 0x200D, 0x2642},
-    {0x1F93C, 0x200D, 0x2642, 0xFE0F},
-    {0x1F93D},
-    {0x1F93D, 0x200D, 0x2640},
-    {0x1F93D, 0x200D, 0x2640, 0xFE0F},
-    {0x1F93D, 0x200D, 0x2642},
-    {0x1F93D, 0x200D, 0x2642, 0xFE0F},
-    {0x1F93D, 0x1F3FB},
-    {0x1F93D, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F93D, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F93D, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F93D, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F93D, 0x1F3FC},
-    {0x1F93D, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F93D, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F93D, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F93D, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F93D, 0x1F3FD},
-    {0x1F93D, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F93D, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F93D, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F93D, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F93D, 0x1F3FE},
-    {0x1F93D, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F93D, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F93D, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F93D, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F93D, 0x1F3FF},
-    {0x1F93D, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F93D, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F93D, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F93D, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F93E},
-    {0x1F93E, 0x200D, 0x2640},
-    {0x1F93E, 0x200D, 0x2640, 0xFE0F},
-    {0x1F93E, 0x200D, 0x2642},
-    {0x1F93E, 0x200D, 0x2642, 0xFE0F},
-    {0x1F93E, 0x1F3FB},
-    {0x1F93E, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F93E, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F93E, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F93E, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F93E, 0x1F3FC},
-    {0x1F93E, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F93E, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F93E, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F93E, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F93E, 0x1F3FD},
-    {0x1F93E, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F93E, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F93E, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F93E, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F93E, 0x1F3FE},
-    {0x1F93E, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F93E, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F93E, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F93E, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F93E, 0x1F3FF},
-    {0x1F93E, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F93E, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F93E, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F93E, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F93F},
-    {0x1F940},
-    {0x1F941},
-    {0x1F942},
-    {0x1F943},
-    {0x1F944},
-    {0x1F945},
-    {0x1F947},
-    {0x1F948},
-    {0x1F949},
-    {0x1F94A},
-    {0x1F94B},
-    {0x1F94C},
-    {0x1F94D},
-    {0x1F94E},
-    {0x1F94F},
-    {0x1F950},
-    {0x1F951},
-    {0x1F952},
-    {0x1F953},
-    {0x1F954},
-    {0x1F955},
-    {0x1F956},
-    {0x1F957},
-    {0x1F958},
-    {0x1F959},
-    {0x1F95A},
-    {0x1F95B},
-    {0x1F95C},
-    {0x1F95D},
-    {0x1F95E},
-    {0x1F95F},
-    {0x1F960},
-    {0x1F961},
-    {0x1F962},
-    {0x1F963},
-    {0x1F964},
-    {0x1F965},
-    {0x1F966},
-    {0x1F967},
-    {0x1F968},
-    {0x1F969},
-    {0x1F96A},
-    {0x1F96B},
-    {0x1F96C},
-    {0x1F96D},
-    {0x1F96E},
-    {0x1F96F},
-    {0x1F970},
-    {0x1F971},
-    {0x1F972},
-    {0x1F973},
-    {0x1F974},
-    {0x1F975},
-    {0x1F976},
-    {0x1F977},
-    {0x1F977, 0x1F3FB},
-    {0x1F977, 0x1F3FC},
-    {0x1F977, 0x1F3FD},
-    {0x1F977, 0x1F3FE},
-    {0x1F977, 0x1F3FF},
-    {0x1F978},
-    {0x1F979},
-    {0x1F97A},
-    {0x1F97B},
-    {0x1F97C},
-    {0x1F97D},
-    {0x1F97E},
-    {0x1F97F},
-    {0x1F980},
-    {0x1F981},
-    {0x1F982},
-    {0x1F983},
-    {0x1F984},
-    {0x1F985},
-    {0x1F986},
-    {0x1F987},
-    {0x1F988},
-    {0x1F989},
-    {0x1F98A},
-    {0x1F98B},
-    {0x1F98C},
-    {0x1F98D},
-    {0x1F98E},
-    {0x1F98F},
-    {0x1F990},
-    {0x1F991},
-    {0x1F992},
-    {0x1F993},
-    {0x1F994},
-    {0x1F995},
-    {0x1F996},
-    {0x1F997},
-    {0x1F998},
-    {0x1F999},
-    {0x1F99A},
-    {0x1F99B},
-    {0x1F99C},
-    {0x1F99D},
-    {0x1F99E},
-    {0x1F99F},
-    {0x1F9A0},
-    {0x1F9A1},
-    {0x1F9A2},
-    {0x1F9A3},
-    {0x1F9A4},
-    {0x1F9A5},
-    {0x1F9A6},
-    {0x1F9A7},
-    {0x1F9A8},
-    {0x1F9A9},
-    {0x1F9AA},
-    {0x1F9AB},
-    {0x1F9AC},
-    {0x1F9AD},
-    {0x1F9AE},
-    {0x1F9AF},
-    {0x1F9B4},
-    {0x1F9B5},
-    {0x1F9B5, 0x1F3FB},
-    {0x1F9B5, 0x1F3FC},
-    {0x1F9B5, 0x1F3FD},
-    {0x1F9B5, 0x1F3FE},
-    {0x1F9B5, 0x1F3FF},
-    {0x1F9B6},
-    {0x1F9B6, 0x1F3FB},
-    {0x1F9B6, 0x1F3FC},
-    {0x1F9B6, 0x1F3FD},
-    {0x1F9B6, 0x1F3FE},
-    {0x1F9B6, 0x1F3FF},
-    {0x1F9B7},
-    {0x1F9B8},
-    {0x1F9B8, 0x200D, 0x2640},
-    {0x1F9B8, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9B8, 0x200D, 0x2642},
-    {0x1F9B8, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9B8, 0x1F3FB},
-    {0x1F9B8, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F9B8, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9B8, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F9B8, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9B8, 0x1F3FC},
-    {0x1F9B8, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F9B8, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9B8, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F9B8, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9B8, 0x1F3FD},
-    {0x1F9B8, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F9B8, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9B8, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F9B8, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9B8, 0x1F3FE},
-    {0x1F9B8, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F9B8, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9B8, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F9B8, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9B8, 0x1F3FF},
-    {0x1F9B8, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F9B8, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9B8, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F9B8, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9B9},
-    {0x1F9B9, 0x200D, 0x2640},
-    {0x1F9B9, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9B9, 0x200D, 0x2642},
-    {0x1F9B9, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9B9, 0x1F3FB},
-    {0x1F9B9, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F9B9, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9B9, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F9B9, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9B9, 0x1F3FC},
-    {0x1F9B9, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F9B9, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9B9, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F9B9, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9B9, 0x1F3FD},
-    {0x1F9B9, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F9B9, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9B9, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F9B9, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9B9, 0x1F3FE},
-    {0x1F9B9, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F9B9, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9B9, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F9B9, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9B9, 0x1F3FF},
-    {0x1F9B9, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F9B9, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9B9, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F9B9, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9BA},
-    {0x1F9BB},
-    {0x1F9BB, 0x1F3FB},
-    {0x1F9BB, 0x1F3FC},
-    {0x1F9BB, 0x1F3FD},
-    {0x1F9BB, 0x1F3FE},
-    {0x1F9BB, 0x1F3FF},
-    {0x1F9BC},
-    {0x1F9BD},
-    {0x1F9BE},
-    {0x1F9BF},
-    {0x1F9C0},
-    {0x1F9C1},
-    {0x1F9C2},
-    {0x1F9C3},
-    {0x1F9C4},
-    {0x1F9C5},
-    {0x1F9C6},
-    {0x1F9C7},
-    {0x1F9C8},
-    {0x1F9C9},
-    {0x1F9CA},
-    {0x1F9CB},
-    {0x1F9CC},
-    {0x1F9CD},
-    {0x1F9CD, 0x200D, 0x2640},
-    {0x1F9CD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CD, 0x200D, 0x2642},
-    {0x1F9CD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CD, 0x1F3FB},
-    {0x1F9CD, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F9CD, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CD, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F9CD, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CD, 0x1F3FC},
-    {0x1F9CD, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F9CD, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CD, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F9CD, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CD, 0x1F3FD},
-    {0x1F9CD, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F9CD, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CD, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F9CD, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CD, 0x1F3FE},
-    {0x1F9CD, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F9CD, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CD, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F9CD, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CD, 0x1F3FF},
-    {0x1F9CD, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F9CD, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CD, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F9CD, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CE},
-    {0x1F9CE, 0x200D, 0x2640},
-    {0x1F9CE, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F9CE, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CE, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F9CE, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x200D, 0x2642},
-    {0x1F9CE, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F9CE, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CE, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F9CE, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x200D, 0x27A1},
-    {0x1F9CE, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FB},
-    {0x1F9CE, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F9CE, 0x1F3FB, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FB, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CE, 0x1F3FB, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FB, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F9CE, 0x1F3FB, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FB, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CE, 0x1F3FB, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FB, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FB, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FB, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FC},
-    {0x1F9CE, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F9CE, 0x1F3FC, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FC, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CE, 0x1F3FC, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FC, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F9CE, 0x1F3FC, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FC, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CE, 0x1F3FC, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FC, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FC, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FD},
-    {0x1F9CE, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F9CE, 0x1F3FD, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FD, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CE, 0x1F3FD, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FD, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F9CE, 0x1F3FD, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FD, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CE, 0x1F3FD, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FD, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FD, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FE},
-    {0x1F9CE, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F9CE, 0x1F3FE, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FE, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CE, 0x1F3FE, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FE, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F9CE, 0x1F3FE, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FE, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CE, 0x1F3FE, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FE, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FE, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FE, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FF},
-    {0x1F9CE, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F9CE, 0x1F3FF, 0x200D, 0x2640, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FF, 0x200D, 0x2640, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CE, 0x1F3FF, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FF, 0x200D, 0x2640, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F9CE, 0x1F3FF, 0x200D, 0x2642, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FF, 0x200D, 0x2642, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CE, 0x1F3FF, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FF, 0x200D, 0x2642, 0xFE0F, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CE, 0x1F3FF, 0x200D, 0x27A1},
-    {0x1F9CE, 0x1F3FF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9CF},
-    {0x1F9CF, 0x200D, 0x2640},
-    {0x1F9CF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CF, 0x200D, 0x2642},
-    {0x1F9CF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CF, 0x1F3FB},
-    {0x1F9CF, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F9CF, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CF, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F9CF, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CF, 0x1F3FC},
-    {0x1F9CF, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F9CF, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CF, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F9CF, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CF, 0x1F3FD},
-    {0x1F9CF, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F9CF, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CF, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F9CF, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CF, 0x1F3FE},
-    {0x1F9CF, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F9CF, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CF, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F9CF, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9CF, 0x1F3FF},
-    {0x1F9CF, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F9CF, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9CF, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F9CF, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D0},
-    {0x1F9D1},
-    {0x1F9D1, 0x200D, 0x2695},
-    {0x1F9D1, 0x200D, 0x2695, 0xFE0F},
-    {0x1F9D1, 0x200D, 0x2696},
-    {0x1F9D1, 0x200D, 0x2696, 0xFE0F},
-    {0x1F9D1, 0x200D, 0x2708},
-    {0x1F9D1, 0x200D, 0x2708, 0xFE0F},
-    {0x1F9D1, 0x200D, 0x1F33E},
-    {0x1F9D1, 0x200D, 0x1F373},
-    {0x1F9D1, 0x200D, 0x1F37C},
-    {0x1F9D1, 0x200D, 0x1F384},
-    {0x1F9D1, 0x200D, 0x1F393},
-    {0x1F9D1, 0x200D, 0x1F3A4},
-    {0x1F9D1, 0x200D, 0x1F3A8},
-    {0x1F9D1, 0x200D, 0x1F3EB},
-    {0x1F9D1, 0x200D, 0x1F3ED},
-    {0x1F9D1, 0x200D, 0x1F4BB},
-    {0x1F9D1, 0x200D, 0x1F4BC},
-    {0x1F9D1, 0x200D, 0x1F527},
-    {0x1F9D1, 0x200D, 0x1F52C},
-    {0x1F9D1, 0x200D, 0x1F680},
-    {0x1F9D1, 0x200D, 0x1F692},
-    {0x1F9D1, 0x200D, 0x1F91D, 0x200D, 0x1F9D1},
-    {0x1F9D1, 0x200D, 0x1F9AF},
-    {0x1F9D1, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F9D1, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x200D, 0x1F9B0},
-    {0x1F9D1, 0x200D, 0x1F9B1},
-    {0x1F9D1, 0x200D, 0x1F9B2},
-    {0x1F9D1, 0x200D, 0x1F9B3},
-    {0x1F9D1, 0x200D, 0x1F9BC},
-    {0x1F9D1, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F9D1, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x200D, 0x1F9BD},
-    {0x1F9D1, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F9D1, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x200D, 0x1F9D1, 0x200D, 0x1F9D2},
-    {0x1F9D1, 0x200D, 0x1F9D1, 0x200D, 0x1F9D2, 0x200D, 0x1F9D2},
-    {0x1F9D1, 0x200D, 0x1F9D2},
-    {0x1F9D1, 0x200D, 0x1F9D2, 0x200D, 0x1F9D2},
-    {0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2695},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2695, 0xFE0F},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2696},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2696, 0xFE0F},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2708},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2708, 0xFE0F},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F33E},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F373},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F37C},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F384},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F393},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F3A4},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F3A8},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F3EB},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F3ED},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F4BB},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F4BC},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F527},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F52C},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F680},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F692},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F9AF},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F9B0},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F9B1},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F9B2},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F9B3},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F9BC},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F9BD},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FB, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2695},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2695, 0xFE0F},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2696},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2696, 0xFE0F},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2708},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2708, 0xFE0F},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F33E},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F373},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F37C},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F384},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F393},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F3A4},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F3A8},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F3EB},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F3ED},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F4BB},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F4BC},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F527},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F52C},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F680},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F692},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F9AF},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F9B0},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F9B1},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F9B2},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F9B3},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F9BC},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F9BD},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FC, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2695},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2695, 0xFE0F},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2696},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2696, 0xFE0F},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2708},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2708, 0xFE0F},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F33E},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F373},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F37C},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F384},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F393},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F3A4},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F3A8},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F3EB},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F3ED},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F4BB},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F4BC},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F527},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F52C},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F680},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F692},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F9AF},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F9B0},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F9B1},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F9B2},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F9B3},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F9BC},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F9BD},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FD, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2695},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2695, 0xFE0F},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2696},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2696, 0xFE0F},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2708},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2708, 0xFE0F},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F33E},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F373},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F37C},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F384},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F393},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F3A4},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F3A8},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F3EB},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F3ED},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F4BB},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F4BC},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F527},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F52C},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F680},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F692},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F9AF},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F9B0},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F9B1},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F9B2},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F9B3},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F9BC},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F9BD},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FE, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2695},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2695, 0xFE0F},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2696},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2696, 0xFE0F},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2708},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2708, 0xFE0F},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0xFE0F, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F33E},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F373},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F37C},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F384},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F393},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F3A4},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F3A8},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F3EB},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F3ED},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F4BB},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F4BC},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F527},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F52C},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F680},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F692},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FB},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FC},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FD},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FE},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FF},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F9AF},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F9AF, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F9AF, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F9B0},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F9B1},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F9B2},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F9B3},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F9BC},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F9BC, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F9BC, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F9BD},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F9BD, 0x200D, 0x27A1},
-    {0x1F9D1, 0x1F3FF, 0x200D, 0x1F9BD, 0x200D, 0x27A1, 0xFE0F},
-    {0x1F9D2},
-    {0x1F9D2, 0x1F3FB},
-    {0x1F9D2, 0x1F3FC},
-    {0x1F9D2, 0x1F3FD},
-    {0x1F9D2, 0x1F3FE},
-    {0x1F9D2, 0x1F3FF},
-    {0x1F9D3},
-    {0x1F9D3, 0x1F3FB},
-    {0x1F9D3, 0x1F3FC},
-    {0x1F9D3, 0x1F3FD},
-    {0x1F9D3, 0x1F3FE},
-    {0x1F9D3, 0x1F3FF},
-    {0x1F9D4},
-    {0x1F9D4, 0x200D, 0x2640},
-    {0x1F9D4, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D4, 0x200D, 0x2642},
-    {0x1F9D4, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D4, 0x1F3FB},
-    {0x1F9D4, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F9D4, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D4, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F9D4, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D4, 0x1F3FC},
-    {0x1F9D4, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F9D4, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D4, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F9D4, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D4, 0x1F3FD},
-    {0x1F9D4, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F9D4, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D4, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F9D4, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D4, 0x1F3FE},
-    {0x1F9D4, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F9D4, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D4, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F9D4, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D4, 0x1F3FF},
-    {0x1F9D4, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F9D4, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D4, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F9D4, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D5},
-    {0x1F9D5, 0x1F3FB},
-    {0x1F9D5, 0x1F3FC},
-    {0x1F9D5, 0x1F3FD},
-    {0x1F9D5, 0x1F3FE},
-    {0x1F9D5, 0x1F3FF},
-    {0x1F9D6},
-    {0x1F9D6, 0x200D, 0x2640},
-    {0x1F9D6, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D6, 0x200D, 0x2642},
-    {0x1F9D6, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D6, 0x1F3FB},
-    {0x1F9D6, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F9D6, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D6, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F9D6, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D6, 0x1F3FC},
-    {0x1F9D6, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F9D6, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D6, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F9D6, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D6, 0x1F3FD},
-    {0x1F9D6, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F9D6, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D6, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F9D6, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D6, 0x1F3FE},
-    {0x1F9D6, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F9D6, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D6, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F9D6, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D6, 0x1F3FF},
-    {0x1F9D6, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F9D6, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D6, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F9D6, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D7},
-    {0x1F9D7, 0x200D, 0x2640},
-    {0x1F9D7, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D7, 0x200D, 0x2642},
-    {0x1F9D7, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D7, 0x1F3FB},
-    {0x1F9D7, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F9D7, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D7, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F9D7, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D7, 0x1F3FC},
-    {0x1F9D7, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F9D7, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D7, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F9D7, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D7, 0x1F3FD},
-    {0x1F9D7, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F9D7, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D7, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F9D7, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D7, 0x1F3FE},
-    {0x1F9D7, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F9D7, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D7, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F9D7, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D7, 0x1F3FF},
-    {0x1F9D7, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F9D7, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D7, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F9D7, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D8},
-    {0x1F9D8, 0x200D, 0x2640},
-    {0x1F9D8, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D8, 0x200D, 0x2642},
-    {0x1F9D8, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D8, 0x1F3FB},
-    {0x1F9D8, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F9D8, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D8, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F9D8, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D8, 0x1F3FC},
-    {0x1F9D8, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F9D8, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D8, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F9D8, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D8, 0x1F3FD},
-    {0x1F9D8, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F9D8, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D8, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F9D8, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D8, 0x1F3FE},
-    {0x1F9D8, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F9D8, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D8, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F9D8, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D8, 0x1F3FF},
-    {0x1F9D8, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F9D8, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D8, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F9D8, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D9},
-    {0x1F9D9, 0x200D, 0x2640},
-    {0x1F9D9, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D9, 0x200D, 0x2642},
-    {0x1F9D9, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D9, 0x1F3FB},
-    {0x1F9D9, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F9D9, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D9, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F9D9, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D9, 0x1F3FC},
-    {0x1F9D9, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F9D9, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D9, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F9D9, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D9, 0x1F3FD},
-    {0x1F9D9, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F9D9, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D9, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F9D9, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D9, 0x1F3FE},
-    {0x1F9D9, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F9D9, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D9, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F9D9, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9D9, 0x1F3FF},
-    {0x1F9D9, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F9D9, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9D9, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F9D9, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DA},
-    {0x1F9DA, 0x200D, 0x2640},
-    {0x1F9DA, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DA, 0x200D, 0x2642},
-    {0x1F9DA, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DA, 0x1F3FB},
-    {0x1F9DA, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F9DA, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DA, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F9DA, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DA, 0x1F3FC},
-    {0x1F9DA, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F9DA, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DA, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F9DA, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DA, 0x1F3FD},
-    {0x1F9DA, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F9DA, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DA, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F9DA, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DA, 0x1F3FE},
-    {0x1F9DA, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F9DA, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DA, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F9DA, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DA, 0x1F3FF},
-    {0x1F9DA, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F9DA, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DA, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F9DA, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DB},
-    {0x1F9DB, 0x200D, 0x2640},
-    {0x1F9DB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DB, 0x200D, 0x2642},
-    {0x1F9DB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DB, 0x1F3FB},
-    {0x1F9DB, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F9DB, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DB, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F9DB, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DB, 0x1F3FC},
-    {0x1F9DB, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F9DB, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DB, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F9DB, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DB, 0x1F3FD},
-    {0x1F9DB, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F9DB, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DB, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F9DB, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DB, 0x1F3FE},
-    {0x1F9DB, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F9DB, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DB, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F9DB, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DB, 0x1F3FF},
-    {0x1F9DB, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F9DB, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DB, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F9DB, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DC},
-    {0x1F9DC, 0x200D, 0x2640},
-    {0x1F9DC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DC, 0x200D, 0x2642},
-    {0x1F9DC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DC, 0x1F3FB},
-    {0x1F9DC, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F9DC, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DC, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F9DC, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DC, 0x1F3FC},
-    {0x1F9DC, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F9DC, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DC, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F9DC, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DC, 0x1F3FD},
-    {0x1F9DC, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F9DC, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DC, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F9DC, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DC, 0x1F3FE},
-    {0x1F9DC, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F9DC, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DC, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F9DC, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DC, 0x1F3FF},
-    {0x1F9DC, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F9DC, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DC, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F9DC, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DD},
-    {0x1F9DD, 0x200D, 0x2640},
-    {0x1F9DD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DD, 0x200D, 0x2642},
-    {0x1F9DD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DD, 0x1F3FB},
-    {0x1F9DD, 0x1F3FB, 0x200D, 0x2640},
-    {0x1F9DD, 0x1F3FB, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DD, 0x1F3FB, 0x200D, 0x2642},
-    {0x1F9DD, 0x1F3FB, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DD, 0x1F3FC},
-    {0x1F9DD, 0x1F3FC, 0x200D, 0x2640},
-    {0x1F9DD, 0x1F3FC, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DD, 0x1F3FC, 0x200D, 0x2642},
-    {0x1F9DD, 0x1F3FC, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DD, 0x1F3FD},
-    {0x1F9DD, 0x1F3FD, 0x200D, 0x2640},
-    {0x1F9DD, 0x1F3FD, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DD, 0x1F3FD, 0x200D, 0x2642},
-    {0x1F9DD, 0x1F3FD, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DD, 0x1F3FE},
-    {0x1F9DD, 0x1F3FE, 0x200D, 0x2640},
-    {0x1F9DD, 0x1F3FE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DD, 0x1F3FE, 0x200D, 0x2642},
-    {0x1F9DD, 0x1F3FE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DD, 0x1F3FF},
-    {0x1F9DD, 0x1F3FF, 0x200D, 0x2640},
-    {0x1F9DD, 0x1F3FF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DD, 0x1F3FF, 0x200D, 0x2642},
-    {0x1F9DD, 0x1F3FF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DE},
-    {0x1F9DE, 0x200D, 0x2640},
-    {0x1F9DE, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DE, 0x200D, 0x2642},
-    {0x1F9DE, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9DF},
-    {0x1F9DF, 0x200D, 0x2640},
-    {0x1F9DF, 0x200D, 0x2640, 0xFE0F},
-    {0x1F9DF, 0x200D, 0x2642},
-    {0x1F9DF, 0x200D, 0x2642, 0xFE0F},
-    {0x1F9E0},
-    {0x1F9E1},
-    {0x1F9E2},
-    {0x1F9E3},
-    {0x1F9E4},
-    {0x1F9E5},
-    {0x1F9E6},
-    {0x1F9E7},
-    {0x1F9E8},
-    {0x1F9E9},
-    {0x1F9EA},
-    {0x1F9EB},
-    {0x1F9EC},
-    {0x1F9ED},
-    {0x1F9EE},
-    {0x1F9EF},
-    {0x1F9F0},
-    {0x1F9F1},
-    {0x1F9F2},
-    {0x1F9F3},
-    {0x1F9F4},
-    {0x1F9F5},
-    {0x1F9F6},
-    {0x1F9F7},
-    {0x1F9F8},
-    {0x1F9F9},
-    {0x1F9FA},
-    {0x1F9FB},
-    {0x1F9FC},
-    {0x1F9FD},
-    {0x1F9FE},
-    {0x1F9FF},
-    {0x1FA70},
-    {0x1FA71},
-    {0x1FA72},
-    {0x1FA73},
-    {0x1FA74},
-    {0x1FA75},
-    {0x1FA76},
-    {0x1FA77},
-    {0x1FA78},
-    {0x1FA79},
-    {0x1FA7A},
-    {0x1FA7B},
-    {0x1FA7C},
-    {0x1FA80},
-    {0x1FA81},
-    {0x1FA82},
-    {0x1FA83},
-    {0x1FA84},
-    {0x1FA85},
-    {0x1FA86},
-    {0x1FA87},
-    {0x1FA88},
-    {0x1FA89},
-    {0x1FA8F},
-    {0x1FA90},
-    {0x1FA91},
-    {0x1FA92},
-    {0x1FA93},
-    {0x1FA94},
-    {0x1FA95},
-    {0x1FA96},
-    {0x1FA97},
-    {0x1FA98},
-    {0x1FA99},
-    {0x1FA9A},
-    {0x1FA9B},
-    {0x1FA9C},
-    {0x1FA9D},
-    {0x1FA9E},
-    {0x1FA9F},
-    {0x1FAA0},
-    {0x1FAA1},
-    {0x1FAA2},
-    {0x1FAA3},
-    {0x1FAA4},
-    {0x1FAA5},
-    {0x1FAA6},
-    {0x1FAA7},
-    {0x1FAA8},
-    {0x1FAA9},
-    {0x1FAAA},
-    {0x1FAAB},
-    {0x1FAAC},
-    {0x1FAAD},
-    {0x1FAAE},
-    {0x1FAAF},
-    {0x1FAB0},
-    {0x1FAB1},
-    {0x1FAB2},
-    {0x1FAB3},
-    {0x1FAB4},
-    {0x1FAB5},
-    {0x1FAB6},
-    {0x1FAB7},
-    {0x1FAB8},
-    {0x1FAB9},
-    {0x1FABA},
-    {0x1FABB},
-    {0x1FABC},
-    {0x1FABD},
-    {0x1FABE},
-    {0x1FABF},
-    {0x1FAC0},
-    {0x1FAC1},
-    {0x1FAC2},
-    {0x1FAC3},
-    {0x1FAC3, 0x1F3FB},
-    {0x1FAC3, 0x1F3FC},
-    {0x1FAC3, 0x1F3FD},
-    {0x1FAC3, 0x1F3FE},
-    {0x1FAC3, 0x1F3FF},
-    {0x1FAC4},
-    {0x1FAC4, 0x1F3FB},
-    {0x1FAC4, 0x1F3FC},
-    {0x1FAC4, 0x1F3FD},
-    {0x1FAC4, 0x1F3FE},
-    {0x1FAC4, 0x1F3FF},
-    {0x1FAC5},
-    {0x1FAC5, 0x1F3FB},
-    {0x1FAC5, 0x1F3FC},
-    {0x1FAC5, 0x1F3FD},
-    {0x1FAC5, 0x1F3FE},
-    {0x1FAC5, 0x1F3FF},
-    {0x1FAC6},
-    {0x1FACE},
-    {0x1FACF},
-    {0x1FAD0},
-    {0x1FAD1},
-    {0x1FAD2},
-    {0x1FAD3},
-    {0x1FAD4},
-    {0x1FAD5},
-    {0x1FAD6},
-    {0x1FAD7},
-    {0x1FAD8},
-    {0x1FAD9},
-    {0x1FADA},
-    {0x1FADB},
-    {0x1FADC},
-    {0x1FADF},
-    {0x1FAE0},
-    {0x1FAE1},
-    {0x1FAE2},
-    {0x1FAE3},
-    {0x1FAE4},
-    {0x1FAE5},
-    {0x1FAE6},
-    {0x1FAE7},
-    {0x1FAE8},
-    {0x1FAE9},
-    {0x1FAF0},
-    {0x1FAF0, 0x1F3FB},
-    {0x1FAF0, 0x1F3FC},
-    {0x1FAF0, 0x1F3FD},
-    {0x1FAF0, 0x1F3FE},
-    {0x1FAF0, 0x1F3FF},
-    {0x1FAF1},
-    {0x1FAF1, 0x1F3FB},
-    {0x1FAF1, 0x1F3FB, 0x200D, 0x1FAF2, 0x1F3FC},
-    {0x1FAF1, 0x1F3FB, 0x200D, 0x1FAF2, 0x1F3FD},
-    {0x1FAF1, 0x1F3FB, 0x200D, 0x1FAF2, 0x1F3FE},
-    {0x1FAF1, 0x1F3FB, 0x200D, 0x1FAF2, 0x1F3FF},
-    {0x1FAF1, 0x1F3FC},
-    {0x1FAF1, 0x1F3FC, 0x200D, 0x1FAF2, 0x1F3FB},
-    {0x1FAF1, 0x1F3FC, 0x200D, 0x1FAF2, 0x1F3FD},
-    {0x1FAF1, 0x1F3FC, 0x200D, 0x1FAF2, 0x1F3FE},
-    {0x1FAF1, 0x1F3FC, 0x200D, 0x1FAF2, 0x1F3FF},
-    {0x1FAF1, 0x1F3FD},
-    {0x1FAF1, 0x1F3FD, 0x200D, 0x1FAF2, 0x1F3FB},
-    {0x1FAF1, 0x1F3FD, 0x200D, 0x1FAF2, 0x1F3FC},
-    {0x1FAF1, 0x1F3FD, 0x200D, 0x1FAF2, 0x1F3FE},
-    {0x1FAF1, 0x1F3FD, 0x200D, 0x1FAF2, 0x1F3FF},
-    {0x1FAF1, 0x1F3FE},
-    {0x1FAF1, 0x1F3FE, 0x200D, 0x1FAF2, 0x1F3FB},
-    {0x1FAF1, 0x1F3FE, 0x200D, 0x1FAF2, 0x1F3FC},
-    {0x1FAF1, 0x1F3FE, 0x200D, 0x1FAF2, 0x1F3FD},
-    {0x1FAF1, 0x1F3FE, 0x200D, 0x1FAF2, 0x1F3FF},
-    {0x1FAF1, 0x1F3FF},
-    {0x1FAF1, 0x1F3FF, 0x200D, 0x1FAF2, 0x1F3FB},
-    {0x1FAF1, 0x1F3FF, 0x200D, 0x1FAF2, 0x1F3FC},
-    {0x1FAF1, 0x1F3FF, 0x200D, 0x1FAF2, 0x1F3FD},
-    {0x1FAF1, 0x1F3FF, 0x200D, 0x1FAF2, 0x1F3FE},
-    {0x1FAF2},
-    {0x1FAF2, 0x1F3FB},
-    {0x1FAF2, 0x1F3FC},
-    {0x1FAF2, 0x1F3FD},
-    {0x1FAF2, 0x1F3FE},
-    {0x1FAF2, 0x1F3FF},
-    {0x1FAF3},
-    {0x1FAF3, 0x1F3FB},
-    {0x1FAF3, 0x1F3FC},
-    {0x1FAF3, 0x1F3FD},
-    {0x1FAF3, 0x1F3FE},
-    {0x1FAF3, 0x1F3FF},
-    {0x1FAF4},
-    {0x1FAF4, 0x1F3FB},
-    {0x1FAF4, 0x1F3FC},
-    {0x1FAF4, 0x1F3FD},
-    {0x1FAF4, 0x1F3FE},
-    {0x1FAF4, 0x1F3FF},
-    {0x1FAF5},
-    {0x1FAF5, 0x1F3FB},
-    {0x1FAF5, 0x1F3FC},
-    {0x1FAF5, 0x1F3FD},
-    {0x1FAF5, 0x1F3FE},
-    {0x1FAF5, 0x1F3FF},
-    {0x1FAF6},
-    {0x1FAF6, 0x1F3FB},
-    {0x1FAF6, 0x1F3FC},
-    {0x1FAF6, 0x1F3FD},
-    {0x1FAF6, 0x1F3FE},
-    {0x1FAF6, 0x1F3FF},
-    {0x1FAF7},
-    {0x1FAF7, 0x1F3FB},
-    {0x1FAF7, 0x1F3FC},
-    {0x1FAF7, 0x1F3FD},
-    {0x1FAF7, 0x1F3FE},
-    {0x1FAF7, 0x1F3FF},
-    {0x1FAF8},
-    {0x1FAF8, 0x1F3FB},
-    {0x1FAF8, 0x1F3FC},
-    {0x1FAF8, 0x1F3FD},
-    {0x1FAF8, 0x1F3FE},
-    {0x1FAF8, 0x1F3FF}};
+// Code points that can begin an emoji sequence: bit (cp & 0xFF) of the 256-bit block
+// EMOJI_START_BITS[EMOJI_START_BLOCK_INDEX[cp >> 8] * 8 ...], for cp >> 8 within the index.
+constexpr uint8_t EMOJI_START_BLOCK_INDEX[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 3, 0, 4, 5, 6, 7, 8, 0, 9, 0, 10, 0, 0, 0, 0,
+    11, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 14, 15, 16, 17, 18, 19, 20, 0, 21, 22
+};
+
+constexpr uint32_t EMOJI_START_BITS[] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x03FF0408, 0x00000000, 0x00000000, 0x00000000, 0x00004200, 0x00000000, 0x00000000,
+    0x00000000, 0x10000000, 0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x02000004, 0x00000000, 0x00000000, 0x03F00000, 0x00000600, 0x00000000, 0x00000000,
+    0x0C000000, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x070FFE00,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00400C00, 0x00000001, 0x78000000,
+    0x2132401F, 0x0700C44D, 0x800FFF05, 0xC8000169, 0x1AFC0000, 0x60030C83, 0x001AC130, 0x27BF0600,
+    0x2054BF24, 0x00180102, 0x00B85090, 0x00000018, 0x00E00000, 0x80010002, 0x00000000, 0x00000000,
+    0x00000000, 0x00300000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x180000E0, 0x00000000, 0x00210000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x20010000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0xC0030000, 0x07FE4000, 0x00000000, 0x00000000, 0xFFFFFFC0,
+    0x04000006, 0x07FC8000, 0x00030000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xFFFFFFFF, 0xFFFFFFF3, 0xFFFFFFFF, 0xFFFFFFFF, 0xCECFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x07B9FFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xBFFFFFFF,
+    0xFFFFFFFF, 0x3FFFFFFF, 0xFFFF7E00, 0x07F980FF, 0x00613C80, 0x10060130, 0x700E001C, 0xFC08810A,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x0000FFFF, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xF0E7F83F, 0x1FF91A3F,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010FFF,
+    0xFFFFF000, 0xF7FFFFFF, 0xFFFFFFBF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFF0FFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00000000, 0x00000000, 0x00000000, 0x1FFF0000, 0xFFFF83FF, 0xFFFFFFFF, 0x9FFFC07F, 0x01FF03FF
+};
+
+constexpr uint16_t EMOJI_CODE_POINT_TRIE_EDGE_OFFSETS[] = {
+    0, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432,
+    1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444,
+    1445, 1446, 1447, 1448, 1448, 1448, 1449, 1450, 1450, 1450, 1450, 1450,
+    1451, 1452, 1453, 1453, 1454, 1455, 1455, 1456, 1457, 1458, 1459, 1460,
+    1461, 1462, 1463, 1464, 1465, 1465, 1465, 1466, 1467, 1468, 1469, 1470,
+    1471, 1472, 1472, 1472, 1473, 1479, 1480, 1481, 1482, 1483, 1484, 1485,
+    1486, 1487, 1488, 1489, 1490, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
+    1491, 1491, 1491, 1491, 1491, 1491, 1492, 1493, 1494, 1495, 1496, 1497,
+    1498, 1499, 1499, 1500, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507,
+    1508, 1508, 1509, 1509, 1509, 1510, 1511, 1511, 1511, 1511, 1511, 1512,
+    1512, 1513, 1514, 1515, 1515, 1516, 1516, 1517, 1518, 1518, 1518, 1519,
+    1519, 1520, 1521, 1527, 1527, 1527, 1528, 1528, 1529, 1530, 1535, 1540,
+    1546, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1558, 1559, 1560, 1561,
+    1562, 1562, 1562, 1562, 1562, 1562, 1562, 1563, 1564, 1564, 1564, 1564,
+    1565, 1565, 1565, 1566, 1567, 1568, 1569, 1570, 1570, 1570, 1570, 1570,
+    1571, 1572, 1573, 1574, 1574, 1574, 1575, 1576, 1577, 1578, 1578, 1578,
+    1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1595, 1616, 1637,
+    1644, 1653, 1659, 1678, 1684, 1695, 1699, 1710, 1721, 1744, 1756, 1757,
+    1771, 1772, 1777, 1798, 1815, 1822, 1829, 1831, 1832, 1834, 1837, 1837,
+    1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1839, 1839, 1839, 1839,
+    1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839,
+    1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839,
+    1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1840,
+    1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1849, 1849, 1849,
+    1849, 1849, 1849, 1849, 1849, 1849, 1850, 1850, 1850, 1850, 1850, 1850,
+    1850, 1850, 1850, 1850, 1850, 1850, 1850, 1850, 1851, 1851, 1851, 1851,
+    1851, 1851, 1851, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852,
+    1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852,
+    1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852,
+    1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852,
+    1852, 1852, 1852, 1852, 1852, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+    1853, 1858, 1858, 1858, 1858, 1858, 1858, 1858, 1858, 1858, 1858, 1858,
+    1858, 1858, 1858, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1865,
+    1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865,
+    1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865,
+    1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1870, 1876, 1882,
+    1882, 1882, 1887, 1887, 1887, 1893, 1899, 1905, 1906, 1907, 1907, 1907,
+    1907, 1907, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916,
+    1917, 1918, 1919, 1919, 1919, 1919, 1919, 1919, 1919, 1919, 1919, 1919,
+    1919, 1919, 1919, 1919, 1919, 1919, 1919, 1919, 1920, 1922, 1923, 1924,
+    1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924, 1925,
+    1925, 1925, 1925, 1925, 1925, 1925, 1925, 1925, 1925, 1925, 1925, 1925,
+    1926, 1926, 1926, 1926, 1926, 1926, 1926, 1926, 1926, 1926, 1926, 1926,
+    1926, 1926, 1926, 1926, 1926, 1927, 1927, 1927, 1927, 1927, 1927, 1927,
+    1927, 1927, 1927, 1927, 1927, 1927, 1927, 1927, 1927, 1927, 1927, 1927,
+    1927, 1927, 1928, 1928, 1928, 1928, 1929, 1929, 1930, 1935, 1940, 1940,
+    1940, 1945, 1950, 1955, 1960, 1965, 1970, 1975, 1980, 1985, 1990, 1995,
+    1995, 1995, 1995, 1995, 1995, 1995, 1995, 1995, 1995, 1995, 1995, 1995,
+    1995, 1995, 1995, 1995, 1995, 1995, 1995, 1995, 1995, 2000, 2005, 2011,
+    2017, 2017, 2022, 2027, 2032, 2038, 2039, 2045, 2051, 2056, 2062, 2067,
+    2072, 2077, 2083, 2088, 2088, 2088, 2088, 2093, 2093, 2093, 2093, 2093,
+    2099, 2105, 2110, 2110, 2115, 2121, 2127, 2127, 2127, 2127, 2127, 2127,
+    2127, 2127, 2132, 2132, 2137, 2137, 2137, 2137, 2137, 2137, 2137, 2137,
+    2137, 2137, 2137, 2137, 2137, 2137, 2137, 2137, 2137, 2137, 2137, 2137,
+    2137, 2137, 2137, 2137, 2137, 2142, 2142, 2142, 2142, 2142, 2142, 2142,
+    2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142,
+    2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142,
+    2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142,
+    2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142,
+    2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142,
+    2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142, 2142,
+    2142, 2142, 2142, 2142, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143,
+    2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143,
+    2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143,
+    2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143,
+    2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143,
+    2143, 2143, 2143, 2143, 2143, 2143, 2143, 2143, 2144, 2145, 2145, 2145,
+    2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145,
+    2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145, 2145,
+    2145, 2145, 2146, 2147, 2148, 2154, 2160, 2161, 2162, 2163, 2164, 2169,
+    2170, 2171, 2172, 2173, 2174, 2180, 2185, 2190, 2190, 2191, 2192, 2193,
+    2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205,
+    2206, 2207, 2208, 2209, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+    2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+    2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+    2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+    2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2211, 2211, 2211, 2211,
+    2211, 2211, 2211, 2212, 2213, 2213, 2213, 2213, 2213, 2213, 2213, 2213,
+    2213, 2213, 2213, 2213, 2214, 2214, 2214, 2220, 2226, 2232, 2232, 2232,
+    2232, 2238, 2243, 2249, 2255, 2260, 2260, 2260, 2260, 2260, 2260, 2260,
+    2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260,
+    2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260, 2260,
+    2260, 2260, 2260, 2260, 2260, 2266, 2266, 2266, 2266, 2266, 2266, 2266,
+    2266, 2266, 2266, 2266, 2266, 2266, 2266, 2266, 2266, 2266, 2272, 2278,
+    2284, 2284, 2284, 2284, 2284, 2284, 2284, 2284, 2284, 2284, 2289, 2289,
+    2289, 2289, 2289, 2289, 2290, 2295, 2296, 2297, 2298, 2298, 2298, 2298,
+    2298, 2298, 2298, 2298, 2298, 2298, 2298, 2299, 2300, 2301, 2302, 2303,
+    2304, 2305, 2305, 2305, 2306, 2307, 2307, 2307, 2307, 2307, 2307, 2307,
+    2307, 2307, 2307, 2307, 2307, 2307, 2307, 2307, 2307, 2307, 2307, 2307,
+    2307, 2307, 2307, 2307, 2312, 2312, 2312, 2317, 2317, 2317, 2317, 2317,
+    2317, 2317, 2317, 2317, 2322, 2327, 2332, 2337, 2342, 2347, 2352, 2357,
+    2357, 2357, 2357, 2357, 2357, 2357, 2363, 2363, 2363, 2363, 2363, 2363,
+    2363, 2363, 2363, 2363, 2368, 2373, 2378, 2383, 2388, 2394, 2399, 2405,
+    2411, 2417, 2417, 2418, 2424, 2430, 2430, 2430, 2430, 2430, 2430, 2430,
+    2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430,
+    2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430,
+    2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430,
+    2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430,
+    2430, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435,
+    2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435,
+    2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435,
+    2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435,
+    2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435, 2440,
+    2445, 2445, 2451, 2457, 2457, 2462, 2462, 2462, 2462, 2462, 2462, 2462,
+    2462, 2462, 2462, 2462, 2462, 2462, 2462, 2462, 2462, 2462, 2462, 2468,
+    2474, 2480, 2480, 2486, 2491, 2496, 2502, 2507, 2513, 2519, 2525, 2531,
+    2537, 2543, 2549, 2555, 2556, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
+    2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
+    2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
+    2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
+    2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
+    2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
+    2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
+    2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
+    2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
+    2557, 2557, 2557, 2557, 2557, 2562, 2567, 2572, 2572, 2572, 2572, 2572,
+    2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572,
+    2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2572, 2577,
+    2582, 2587, 2592, 2597, 2602, 2607, 2612, 2617, 2618, 2619, 2620, 2621,
+    2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629, 2629, 2629, 2629, 2629,
+    2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629,
+    2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629,
+    2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629,
+    2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629,
+    2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629,
+    2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629,
+    2629, 2629, 2629, 2629, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2631,
+    2632, 2633, 2634, 2635, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636,
+    2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636,
+    2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636, 2636,
+    2636, 2636, 2636, 2636, 2636, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
+    2637, 2637, 2637, 2637, 2638, 2639, 2639, 2639, 2639, 2639, 2639, 2639,
+    2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639,
+    2642, 2643, 2644, 2645, 2646, 2647, 2649, 2650, 2651, 2652, 2653, 2654,
+    2654, 2654, 2654, 2654, 2654, 2656, 2657, 2658, 2659, 2660, 2661, 2662,
+    2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2673,
+    2673, 2673, 2673, 2673, 2673, 2673, 2673, 2673, 2673, 2673, 2673, 2673,
+    2673, 2674, 2675, 2676, 2676, 2676, 2677, 2678, 2680, 2681, 2681, 2682,
+    2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682,
+    2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682,
+    2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682,
+    2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682,
+    2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682,
+    2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682, 2682,
+    2682, 2682, 2682, 2711, 2712, 2713, 2714, 2715, 2716, 2744, 2745, 2746,
+    2747, 2748, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749,
+    2749, 2749, 2749, 2749, 2749, 2749, 2751, 2752, 2753, 2754, 2755, 2756,
+    2758, 2760, 2761, 2762, 2763, 2764, 2765, 2767, 2768, 2769, 2770, 2771,
+    2772, 2772, 2772, 2772, 2772, 2772, 2774, 2775, 2776, 2777, 2778, 2779,
+    2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779,
+    2779, 2779, 2779, 2781, 2782, 2783, 2784, 2785, 2786, 2786, 2786, 2786,
+    2786, 2786, 2786, 2786, 2786, 2786, 2786, 2788, 2789, 2790, 2791, 2792,
+    2793, 2795, 2796, 2797, 2798, 2799, 2800, 2800, 2800, 2800, 2800, 2800,
+    2800, 2800, 2800, 2800, 2800, 2802, 2803, 2804, 2805, 2806, 2807, 2809,
+    2810, 2811, 2812, 2813, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814,
+    2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814,
+    2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2815, 2816, 2817, 2818,
+    2819, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820,
+    2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820,
+    2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820,
+    2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820,
+    2820, 2820, 2820, 2820, 2821, 2822, 2823, 2825, 2827, 2828, 2829, 2830,
+    2831, 2832, 2834, 2835, 2836, 2837, 2838, 2839, 2841, 2842, 2843, 2844,
+    2845, 2846, 2848, 2849, 2850, 2851, 2852, 2853, 2853, 2853, 2853, 2853,
+    2853, 2855, 2856, 2857, 2858, 2859, 2860, 2862, 2863, 2864, 2865, 2866,
+    2867, 2867, 2867, 2867, 2867, 2867, 2869, 2870, 2871, 2872, 2873, 2874,
+    2876, 2877, 2878, 2879, 2880, 2881, 2883, 2884, 2885, 2886, 2887, 2888,
+    2891, 2892, 2893, 2894, 2895, 2896, 2896, 2896, 2896, 2896, 2896, 2896,
+    2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896,
+    2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896,
+    2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896,
+    2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896,
+    2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896,
+    2896, 2896, 2896, 2896, 2896, 2896, 2896, 2898, 2899, 2900, 2901, 2902,
+    2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903,
+    2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903,
+    2903, 2903, 2905, 2906, 2907, 2908, 2909, 2910, 2910, 2910, 2910, 2910,
+    2910, 2912, 2913, 2914, 2915, 2916, 2917, 2919, 2920, 2921, 2922, 2923,
+    2924, 2926, 2927, 2928, 2929, 2930, 2931, 2933, 2935, 2936, 2937, 2938,
+    2939, 2940, 2942, 2943, 2944, 2945, 2946, 2947, 2947, 2947, 2947, 2947,
+    2947, 2947, 2947, 2947, 2947, 2947, 2947, 2947, 2947, 2947, 2947, 2949,
+    2950, 2951, 2952, 2953, 2954, 2956, 2957, 2958, 2959, 2960, 2961, 2961,
+    2961, 2961, 2961, 2961, 2963, 2964, 2965, 2966, 2967, 2968, 2971, 2972,
+    2973, 2974, 2975, 2976, 2978, 2979, 2980, 2981, 2982, 2983, 3011, 3012,
+    3013, 3014, 3015, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016,
+    3016, 3016, 3018, 3019, 3020, 3021, 3022, 3023, 3023, 3023, 3023, 3023,
+    3023, 3025, 3026, 3027, 3028, 3029, 3030, 3032, 3033, 3034, 3035, 3036,
+    3037, 3039, 3040, 3041, 3042, 3043, 3044, 3046, 3047, 3048, 3049, 3050,
+    3051, 3053, 3054, 3055, 3056, 3057, 3058, 3060, 3061, 3062, 3063, 3064,
+    3065, 3067, 3068, 3069, 3070, 3071, 3072, 3074, 3075, 3076, 3077, 3078,
+    3079, 3081, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083,
+    3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3083, 3084,
+    3085, 3086, 3087, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088,
+    3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088,
+    3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088,
+    3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088,
+    3088, 3088, 3088, 3089, 3091, 3093, 3095, 3097, 3099, 3101, 3103, 3103,
+    3103, 3105, 3107, 3108, 3111, 3114, 3117, 3120, 3123, 3124, 3125, 3127,
+    3129, 3131, 3133, 3135, 3136, 3137, 3139, 3141, 3143, 3145, 3147, 3149,
+    3151, 3153, 3155, 3157, 3159, 3161, 3163, 3165, 3167, 3169, 3171, 3173,
+    3174, 3177, 3177, 3177, 3177, 3177, 3178, 3179, 3180, 3181, 3182, 3184,
+    3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3185, 3186, 3187, 3188,
+    3188, 3188, 3188, 3188, 3188, 3188, 3189, 3189, 3189, 3189, 3189, 3190,
+    3191, 3217, 3243, 3269, 3295, 3321, 3322, 3323, 3324, 3326, 3326, 3326,
+    3326, 3326, 3326, 3326, 3326, 3326, 3327, 3328, 3329, 3329, 3329, 3329,
+    3329, 3329, 3329, 3330, 3330, 3330, 3330, 3330, 3331, 3332, 3358, 3384,
+    3410, 3436, 3462, 3463, 3464, 3466, 3468, 3470, 3472, 3474, 3475, 3476,
+    3477, 3478, 3480, 3482, 3484, 3486, 3488, 3489, 3490, 3492, 3494, 3496,
+    3498, 3500, 3501, 3502, 3504, 3506, 3508, 3510, 3512, 3513, 3514, 3516,
+    3518, 3520, 3522, 3524, 3525, 3526, 3528, 3530, 3532, 3534, 3536, 3537,
+    3538, 3540, 3542, 3544, 3546, 3548, 3549, 3550, 3552, 3554, 3556, 3558,
+    3560, 3561, 3562, 3564, 3566, 3568, 3570, 3572, 3574, 3576, 3578, 3580,
+    3582, 3584, 3584, 3584, 3585, 3586, 3587, 3588, 3589, 3591, 3593, 3595,
+    3597, 3599, 3600, 3601, 3603, 3605, 3607, 3609, 3611, 3612, 3613, 3615,
+    3617, 3619, 3621, 3623, 3624, 3625, 3627, 3629, 3631, 3633, 3635, 3636,
+    3637, 3639, 3641, 3643, 3645, 3647, 3648, 3649, 3651, 3653, 3655, 3657,
+    3659, 3660, 3661, 3663, 3665, 3667, 3669, 3671, 3672, 3673, 3675, 3677,
+    3679, 3681, 3683, 3684, 3685, 3687, 3689, 3691, 3693, 3695, 3697, 3699,
+    3700, 3703, 3706, 3709, 3712, 3715, 3716, 3717, 3719, 3721, 3723, 3725,
+    3727, 3728, 3729, 3731, 3733, 3735, 3737, 3739, 3740, 3741, 3743, 3745,
+    3747, 3749, 3751, 3752, 3753, 3755, 3757, 3759, 3761, 3763, 3764, 3765,
+    3767, 3769, 3771, 3773, 3775, 3776, 3777, 3778, 3779, 3781, 3783, 3785,
+    3787, 3789, 3790, 3791, 3793, 3795, 3797, 3799, 3801, 3802, 3803, 3805,
+    3807, 3809, 3811, 3813, 3814, 3815, 3817, 3819, 3821, 3823, 3825, 3826,
+    3827, 3829, 3831, 3833, 3835, 3837, 3839, 3841, 3842, 3845, 3848, 3851,
+    3854, 3857, 3858, 3859, 3861, 3863, 3865, 3867, 3869, 3870, 3871, 3872,
+    3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872,
+    3872, 3872, 3872, 3873, 3874, 3874, 3874, 3874, 3874, 3875, 3876, 3877,
+    3878, 3905, 3932, 3959, 3986, 4013, 4014, 4015, 4017, 4019, 4021, 4023,
+    4025, 4026, 4027, 4029, 4031, 4033, 4035, 4037, 4038, 4039, 4041, 4043,
+    4045, 4047, 4049, 4050, 4051, 4053, 4055, 4057, 4059, 4061, 4062, 4063,
+    4065, 4067, 4069, 4071, 4073, 4074, 4075, 4077, 4079, 4081, 4083, 4085,
+    4086, 4087, 4089, 4091, 4093, 4095, 4097, 4098, 4099, 4101, 4103, 4105,
+    4107, 4109, 4110, 4111, 4113, 4115, 4117, 4119, 4121, 4122, 4123, 4124,
+    4125, 4126, 4127, 4128, 4129, 4130, 4130, 4131, 4132, 4133, 4134, 4135,
+    4136, 4137, 4138, 4139, 4140, 4141, 4142, 4142, 4142, 4143, 4144, 4145,
+    4146, 4146, 4148, 4150, 4151, 4153, 4155, 4156, 4158, 4160, 4161, 4163,
+    4165, 4166, 4168, 4170, 4171, 4171, 4171, 4172, 4173, 4174, 4175, 4176,
+    4177, 4178, 4179, 4180, 4181, 4181, 4181, 4182, 4183, 4184, 4185, 4186,
+    4187, 4188, 4189, 4190, 4191, 4192, 4193, 4194, 4195, 4196, 4197, 4198,
+    4199, 4200, 4201, 4202, 4203, 4204, 4205, 4206, 4207, 4208, 4209, 4210,
+    4211, 4212, 4213, 4214, 4215, 4216, 4216, 4216, 4217, 4218, 4219, 4219,
+    4220, 4220, 4220, 4220, 4222, 4223, 4224, 4226, 4228, 4230, 4231, 4232,
+    4233, 4234, 4235, 4236, 4238, 4238, 4238, 4238, 4238, 4238, 4238, 4238,
+    4238, 4238, 4238, 4238, 4238, 4238, 4238, 4239, 4240, 4240, 4240, 4240,
+    4240, 4241, 4242, 4243, 4244, 4245, 4247, 4247, 4247, 4247, 4247, 4247,
+    4247, 4247, 4247, 4247, 4247, 4247, 4247, 4247, 4247, 4248, 4249, 4249,
+    4249, 4249, 4249, 4250, 4251, 4252, 4253, 4254, 4256, 4256, 4256, 4256,
+    4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4257,
+    4258, 4258, 4258, 4258, 4258, 4259, 4260, 4261, 4262, 4263, 4265, 4265,
+    4265, 4265, 4265, 4265, 4265, 4265, 4265, 4265, 4265, 4265, 4265, 4265,
+    4265, 4266, 4267, 4267, 4267, 4267, 4267, 4268, 4269, 4270, 4271, 4272,
+    4274, 4274, 4274, 4274, 4274, 4274, 4274, 4274, 4274, 4274, 4274, 4274,
+    4274, 4274, 4274, 4275, 4276, 4276, 4276, 4276, 4276, 4277, 4278, 4278,
+    4278, 4278, 4281, 4282, 4283, 4285, 4287, 4288, 4289, 4290, 4291, 4292,
+    4293, 4295, 4295, 4295, 4295, 4295, 4295, 4295, 4295, 4295, 4295, 4295,
+    4295, 4295, 4295, 4295, 4296, 4297, 4297, 4297, 4297, 4297, 4298, 4299,
+    4300, 4301, 4302, 4304, 4304, 4304, 4304, 4304, 4304, 4304, 4304, 4304,
+    4304, 4304, 4304, 4304, 4304, 4304, 4305, 4306, 4306, 4306, 4306, 4306,
+    4307, 4308, 4309, 4310, 4311, 4313, 4313, 4313, 4313, 4313, 4313, 4313,
+    4313, 4313, 4313, 4313, 4313, 4313, 4313, 4313, 4314, 4315, 4315, 4315,
+    4315, 4315, 4316, 4317, 4318, 4319, 4320, 4322, 4322, 4322, 4322, 4322,
+    4322, 4322, 4322, 4322, 4322, 4322, 4322, 4322, 4322, 4322, 4323, 4324,
+    4324, 4324, 4324, 4324, 4325, 4326, 4327, 4328, 4329, 4331, 4331, 4331,
+    4331, 4331, 4331, 4331, 4331, 4331, 4331, 4331, 4331, 4331, 4331, 4331,
+    4332, 4333, 4333, 4333, 4333, 4333, 4334, 4335, 4335, 4335, 4336, 4337,
+    4338, 4339, 4340, 4341, 4342, 4343, 4344, 4345, 4345, 4345, 4345, 4345,
+    4346, 4347, 4348, 4349, 4350, 4351, 4352, 4353, 4354, 4355, 4355, 4355,
+    4356, 4357, 4358, 4359, 4360, 4361, 4362, 4363, 4364, 4365, 4365, 4365,
+    4366, 4367, 4368, 4369, 4370, 4371, 4372, 4373, 4374, 4375, 4375, 4375,
+    4376, 4377, 4378, 4379, 4380, 4381, 4382, 4383, 4384, 4385, 4385, 4385,
+    4386, 4387, 4388, 4389, 4390, 4391, 4392, 4393, 4394, 4395, 4395, 4395,
+    4396, 4397, 4398, 4399, 4400, 4401, 4402, 4403, 4404, 4405, 4405, 4405,
+    4406, 4407, 4408, 4409, 4410, 4411, 4412, 4413, 4414, 4415, 4415, 4415,
+    4416, 4417, 4418, 4419, 4420, 4421, 4422, 4423, 4424, 4425, 4426, 4427,
+    4428, 4429, 4430, 4431, 4432, 4433, 4434, 4435, 4436, 4437, 4437, 4437,
+    4437, 4437, 4437, 4438, 4439, 4440, 4441, 4442, 4443, 4444, 4445, 4446,
+    4447, 4447, 4447, 4448, 4449, 4450, 4451, 4452, 4453, 4454, 4455, 4456,
+    4457, 4457, 4457, 4458, 4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466,
+    4467, 4467, 4467, 4468, 4469, 4470, 4471, 4472, 4473, 4474, 4475, 4476,
+    4477, 4477, 4477, 4478, 4479, 4480, 4481, 4482, 4483, 4484, 4485, 4486,
+    4487, 4487, 4487, 4488, 4489, 4490, 4491, 4492, 4493, 4494, 4495, 4496,
+    4497, 4497, 4497, 4498, 4499, 4500, 4501, 4502, 4503, 4504, 4505, 4506,
+    4507, 4507, 4507, 4508, 4509, 4510, 4511, 4512, 4513, 4514, 4515, 4516,
+    4517, 4517, 4517, 4518, 4519, 4520, 4521, 4522, 4523, 4524, 4525, 4526,
+    4527, 4528, 4529, 4530, 4531, 4531, 4533, 4535, 4536, 4538, 4540, 4541,
+    4543, 4545, 4546, 4548, 4550, 4551, 4553, 4555, 4556, 4556, 4556, 4557,
+    4558, 4559, 4560, 4561, 4562, 4563, 4564, 4565, 4566, 4566, 4566, 4567,
+    4568, 4569, 4570, 4571, 4572, 4573, 4574, 4575, 4576, 4576, 4576, 4577,
+    4578, 4579, 4580, 4581, 4582, 4583, 4584, 4585, 4586, 4586, 4586, 4587,
+    4588, 4589, 4590, 4591, 4592, 4593, 4594, 4595, 4596, 4596, 4596, 4597,
+    4598, 4599, 4600, 4601, 4602, 4603, 4604, 4605, 4606, 4606, 4606, 4606,
+    4606, 4607, 4608, 4609, 4610, 4611, 4612, 4613, 4614, 4615, 4616, 4616,
+    4616, 4617, 4618, 4619, 4620, 4621, 4622, 4623, 4624, 4625, 4626, 4626,
+    4626, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 4634, 4635, 4636, 4636,
+    4636, 4637, 4638, 4639, 4640, 4641, 4642, 4643, 4644, 4645, 4646, 4646,
+    4646, 4647, 4648, 4649, 4650, 4651, 4652, 4653, 4654, 4655, 4656, 4657,
+    4658, 4659, 4660, 4660, 4662, 4664, 4665, 4667, 4669, 4670, 4672, 4674,
+    4675, 4677, 4679, 4680, 4682, 4684, 4685, 4685, 4685, 4686, 4687, 4688,
+    4689, 4690, 4691, 4692, 4693, 4694, 4695, 4695, 4695, 4695, 4696, 4697,
+    4698, 4699, 4700, 4701, 4702, 4703, 4704, 4706, 4706, 4706, 4706, 4706,
+    4706, 4706, 4706, 4706, 4706, 4706, 4706, 4706, 4706, 4706, 4706, 4707,
+    4708, 4708, 4708, 4708, 4708, 4709, 4710, 4711, 4712, 4713, 4715, 4715,
+    4715, 4715, 4715, 4715, 4715, 4715, 4715, 4715, 4715, 4715, 4715, 4715,
+    4715, 4715, 4716, 4717, 4717, 4717, 4717, 4717, 4718, 4719, 4720, 4721,
+    4722, 4724, 4724, 4724, 4724, 4724, 4724, 4724, 4724, 4724, 4724, 4724,
+    4724, 4724, 4724, 4724, 4724, 4725, 4726, 4726, 4726, 4726, 4726, 4727,
+    4728, 4729, 4730, 4731, 4733, 4733, 4733, 4733, 4733, 4733, 4733, 4733,
+    4733, 4733, 4733, 4733, 4733, 4733, 4733, 4733, 4734, 4735, 4735, 4735,
+    4735, 4735, 4736, 4737, 4738, 4739, 4740, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4743,
+    4744, 4744, 4744, 4744, 4744, 4745, 4746, 4746, 4746, 4747, 4748, 4749,
+    4750, 4751, 4752, 4753, 4754, 4755, 4756, 4756, 4756, 4757, 4758, 4759,
+    4760, 4761, 4762, 4763, 4764, 4765, 4766, 4766, 4766, 4767, 4768, 4769,
+    4770, 4771, 4772, 4773, 4774, 4775, 4776, 4776, 4776, 4777, 4778, 4779,
+    4780, 4781, 4782, 4783, 4784, 4785, 4786, 4786, 4786, 4787, 4788, 4789,
+    4790, 4791, 4792, 4793, 4794, 4795, 4796, 4796, 4796, 4797, 4798, 4799,
+    4800, 4801, 4802, 4803, 4804, 4805, 4806, 4806, 4806, 4807, 4808, 4809,
+    4810, 4811, 4812, 4813, 4814, 4815, 4816, 4816, 4816, 4817, 4818, 4819,
+    4820, 4821, 4822, 4823, 4824, 4825, 4826, 4826, 4826, 4827, 4828, 4829,
+    4830, 4831, 4832, 4833, 4834, 4835, 4836, 4836, 4836, 4836, 4836, 4840,
+    4844, 4848, 4852, 4856, 4856, 4856, 4856, 4856, 4856, 4856, 4856, 4856,
+    4856, 4856, 4856, 4856, 4857, 4858, 4859, 4860, 4861, 4862, 4863, 4864,
+    4864, 4865, 4866, 4867, 4868, 4868, 4869, 4870, 4871, 4872, 4872, 4873,
+    4874, 4875, 4876, 4876, 4877, 4878, 4879, 4880, 4880, 4880, 4880, 4880,
+    4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880,
+    4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880,
+    4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880, 4880,
+    4880, 4880, 4880, 4880, 4880, 4880, 4881, 4882, 4883, 4883, 4883, 4884,
+    4886, 4886, 4886, 4886, 4887, 4888, 4889, 4890, 4891, 4892, 4893, 4893,
+    4893, 4893, 4895, 4896, 4897, 4898, 4899, 4900, 4900, 4900, 4900, 4902,
+    4903, 4904, 4905, 4906, 4907, 4907, 4907, 4907, 4909, 4910, 4911, 4912,
+    4913, 4914, 4914, 4914, 4914, 4916, 4917, 4918, 4919, 4920, 4921, 4921,
+    4921, 4921, 4923, 4924, 4925, 4926, 4927, 4928, 4928, 4928, 4929, 4932,
+    4932, 4932, 4932, 4933, 4934, 4935, 4936, 4937, 4937, 4937, 4937, 4940,
+    4941, 4943, 4944, 4945, 4946, 4946, 4946, 4946, 4949, 4950, 4952, 4953,
+    4954, 4955, 4955, 4955, 4955, 4958, 4959, 4961, 4962, 4963, 4964, 4964,
+    4964, 4964, 4967, 4968, 4970, 4971, 4972, 4973, 4973, 4973, 4973, 4976,
+    4977, 4979, 4980, 4981, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982, 4982,
+    4982, 4982, 4982, 4982, 4982, 4983, 4984, 4985, 4986, 4987, 4988, 4989,
+    4990, 4990, 4991, 4992, 4993, 4994, 4994, 4995, 4996, 4997, 4998, 4998,
+    4999, 5000, 5001, 5002, 5002, 5003, 5004, 5005, 5006, 5006, 5006, 5006,
+    5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006,
+    5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006,
+    5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006,
+    5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006,
+    5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006,
+    5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006,
+    5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006,
+    5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006, 5006,
+    5006, 5006, 5007, 5008, 5009, 5010, 5011, 5012, 5013, 5014, 5014, 5015,
+    5016, 5017, 5018, 5018, 5019, 5020, 5021, 5022, 5022, 5023, 5024, 5025,
+    5026, 5026, 5027, 5028, 5029, 5030, 5030, 5030, 5030, 5030, 5030, 5030,
+    5030, 5030, 5030, 5030, 5030, 5030, 5031, 5032, 5033, 5034, 5034, 5034,
+    5034, 5034, 5036, 5037, 5038, 5039, 5040, 5041, 5041, 5041, 5041, 5043,
+    5044, 5045, 5046, 5047, 5048, 5048, 5048, 5048, 5050, 5051, 5052, 5053,
+    5054, 5055, 5055, 5055, 5055, 5057, 5058, 5059, 5060, 5061, 5062, 5062,
+    5062, 5062, 5064, 5065, 5066, 5067, 5068, 5069, 5069, 5069, 5069, 5069,
+    5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069,
+    5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069,
+    5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069,
+    5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069,
+    5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069,
+    5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069,
+    5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069,
+    5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069,
+    5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5069, 5070,
+    5070, 5071, 5072, 5073, 5074, 5075, 5076, 5077, 5078, 5079, 5080, 5081,
+    5082, 5083, 5084, 5085, 5086, 5087, 5088, 5089, 5090, 5091, 5092, 5093,
+    5094, 5095, 5095, 5096, 5097, 5099, 5100, 5102, 5102, 5102, 5102, 5107,
+    5108, 5110, 5114, 5115, 5116, 5117, 5122, 5123, 5125, 5129, 5130, 5131,
+    5132, 5137, 5138, 5140, 5144, 5145, 5146, 5147, 5152, 5153, 5155, 5159,
+    5160, 5161, 5162, 5167, 5168, 5170, 5174, 5175, 5176, 5177, 5179, 5179,
+    5179, 5180, 5181, 5183, 5183, 5183, 5183, 5188, 5193, 5194, 5197, 5201,
+    5205, 5206, 5207, 5208, 5213, 5218, 5219, 5222, 5226, 5230, 5231, 5232,
+    5233, 5238, 5243, 5244, 5247, 5251, 5255, 5256, 5257, 5258, 5263, 5268,
+    5269, 5272, 5276, 5280, 5281, 5282, 5283, 5288, 5293, 5294, 5297, 5301,
+    5305, 5306, 5307, 5308, 5308, 5309, 5309, 5310, 5311, 5312, 5313, 5314,
+    5315, 5316, 5317, 5318, 5319, 5320, 5321, 5322, 5323, 5324, 5325, 5326,
+    5327, 5328, 5329, 5330, 5330, 5331, 5331, 5332, 5333, 5334, 5335, 5336,
+    5337, 5338, 5339, 5340, 5341, 5342, 5343, 5344, 5345, 5346, 5347, 5348,
+    5349, 5350, 5351, 5352, 5352, 5352, 5352, 5353, 5354, 5358, 5360, 5365,
+    5366, 5367, 5368, 5369, 5373, 5375, 5380, 5381, 5382, 5383, 5384, 5388,
+    5390, 5395, 5396, 5397, 5398, 5399, 5403, 5405, 5410, 5411, 5412, 5413,
+    5414, 5418, 5420, 5425, 5426, 5427, 5428, 5428, 5428, 5428, 5429, 5429,
+    5430, 5430, 5431, 5431, 5432, 5432, 5433, 5433, 5434, 5434, 5435, 5435,
+    5436, 5436, 5437, 5437, 5438, 5438, 5438, 5438, 5438, 5439, 5439, 5439,
+    5439, 5439, 5439, 5439, 5439, 5439, 5439, 5439, 5439, 5440, 5445, 5446,
+    5446, 5446, 5446, 5446, 5446, 5446, 5446, 5446, 5446, 5446, 5446, 5446,
+    5447, 5452, 5453, 5453, 5453, 5453, 5453, 5453, 5453, 5453, 5453, 5453,
+    5453, 5453, 5453, 5454, 5459, 5460, 5460, 5460, 5460, 5460, 5460, 5460,
+    5460, 5460, 5460, 5460, 5460, 5460, 5461, 5466, 5467, 5467, 5467, 5467,
+    5467, 5467, 5467, 5467, 5467, 5467, 5467, 5467, 5467, 5468, 5473, 5474,
+    5474, 5474, 5474, 5474, 5474, 5474, 5474, 5474, 5474, 5476, 5476, 5476,
+    5476, 5476, 5476, 5476, 5476, 5476, 5476, 5476, 5476, 5476, 5476, 5478,
+    5483, 5488, 5489, 5489, 5489, 5489, 5489, 5489, 5489, 5489, 5489, 5489,
+    5489, 5489, 5489, 5489, 5489, 5489, 5489, 5489, 5489, 5489, 5489, 5489,
+    5491, 5496, 5501, 5502, 5502, 5502, 5502, 5502, 5502, 5502, 5502, 5502,
+    5502, 5502, 5502, 5502, 5502, 5502, 5502, 5502, 5502, 5502, 5502, 5502,
+    5502, 5504, 5509, 5514, 5515, 5515, 5515, 5515, 5515, 5515, 5515, 5515,
+    5515, 5515, 5515, 5515, 5515, 5515, 5515, 5515, 5515, 5515, 5515, 5515,
+    5515, 5515, 5517, 5522, 5527, 5528, 5528, 5528, 5528, 5528, 5528, 5528,
+    5528, 5528, 5528, 5528, 5528, 5528, 5528, 5528, 5528, 5528, 5528, 5528,
+    5528, 5528, 5528, 5530, 5535, 5540, 5541, 5541, 5541, 5541, 5541, 5541,
+    5541, 5541, 5541, 5541, 5541, 5541, 5541, 5541, 5541, 5542, 5542, 5543,
+    5543, 5544, 5544, 5545, 5545, 5546, 5546, 5547, 5547, 5548, 5548, 5549,
+    5549, 5550, 5550, 5551, 5551, 5551, 5551, 5552, 5552, 5553, 5553, 5554,
+    5554, 5555, 5555, 5556, 5556, 5557, 5557, 5558, 5558, 5559, 5559, 5560,
+    5560, 5561, 5561, 5562, 5562, 5562, 5562, 5562, 5563, 5567, 5567, 5567,
+    5567, 5567, 5567, 5567, 5567, 5567, 5568, 5568, 5568, 5568, 5568, 5569,
+    5573, 5573, 5573, 5573, 5573, 5573, 5573, 5573, 5573, 5574, 5574, 5574,
+    5574, 5574, 5575, 5579, 5579, 5579, 5579, 5579, 5579, 5579, 5579, 5579,
+    5580, 5580, 5580, 5580, 5580, 5581, 5585, 5585, 5585, 5585, 5585, 5585,
+    5585, 5585, 5585, 5586, 5586, 5586, 5586, 5586, 5587, 5591, 5591, 5591,
+    5591, 5591, 5591, 5591, 5591, 5591, 5591, 5591, 5591, 5591, 5591, 5591,
+    5591, 5591, 5591, 5591, 5591, 5596, 5596, 5596, 5596, 5596, 5596, 5597,
+    5602, 5602, 5602, 5602, 5602, 5602, 5603, 5608, 5608, 5608, 5608, 5608,
+    5608, 5609, 5614, 5614, 5614, 5614, 5614, 5614, 5615, 5620, 5620, 5620,
+    5620, 5620, 5620, 5621, 5621, 5621, 5626, 5631, 5631, 5631, 5631, 5631,
+    5631, 5631, 5631, 5631, 5631, 5631, 5633, 5638, 5643, 5643, 5643, 5643,
+    5643, 5643, 5643, 5643, 5643, 5643, 5643, 5645, 5650, 5655, 5655, 5655,
+    5655, 5655, 5655, 5655, 5655, 5655, 5655, 5655, 5657, 5662, 5667, 5667,
+    5667, 5667, 5667, 5667, 5667, 5667, 5667, 5667, 5667, 5669, 5674, 5679,
+    5679, 5679, 5679, 5679, 5679, 5679, 5679, 5679, 5679, 5679, 5681, 5681,
+    5681, 5681, 5681, 5681, 5681, 5681, 5681, 5681, 5681, 5681, 5681, 5681,
+    5681, 5681, 5681, 5681, 5681, 5681, 5681, 5685, 5686, 5686, 5686, 5686,
+    5686, 5690, 5691, 5691, 5691, 5691, 5691, 5695, 5696, 5696, 5696, 5696,
+    5696, 5700, 5701, 5701, 5701, 5701, 5701, 5705, 5706, 5706, 5706, 5706,
+    5706, 5706, 5706, 5706, 5706, 5706, 5711, 5711, 5711, 5711, 5711, 5711,
+    5716, 5716, 5716, 5716, 5716, 5716, 5721, 5721, 5721, 5721, 5721, 5721,
+    5726, 5726, 5726, 5726, 5726, 5726, 5731, 5731, 5731, 5731, 5731, 5731,
+    5731, 5731, 5731, 5731, 5731, 5736, 5741, 5741, 5741, 5741, 5741, 5741,
+    5741, 5741, 5741, 5741, 5741, 5746, 5751, 5751, 5751, 5751, 5751, 5751,
+    5751, 5751, 5751, 5751, 5751, 5756, 5761, 5761, 5761, 5761, 5761, 5761,
+    5761, 5761, 5761, 5761, 5761, 5766, 5771, 5771, 5771, 5771, 5771, 5771,
+    5771, 5771, 5771, 5771, 5771, 5776, 5781, 5781, 5781, 5781, 5781, 5785,
+    5785, 5785, 5785, 5785, 5789, 5789, 5789, 5789, 5789, 5793, 5793, 5793,
+    5793, 5793, 5797, 5797, 5797, 5797, 5797, 5801, 5801, 5801, 5801, 5801,
+    5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801,
+    5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801,
+    5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801,
+    5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801,
+    5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801,
+    5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801,
+    5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801, 5801,
+    5801, 5801, 5801, 5801, 5801, 5801, 5801
+};
+
+constexpr uint32_t EMOJI_CODE_POINT_TRIE_SYMBOLS[] = {
+    0x0023, 0x002A, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035,
+    0x0036, 0x0037, 0x0038, 0x0039, 0x00A9, 0x00AE, 0x203C, 0x2049,
+    0x2122, 0x2139, 0x2194, 0x2195, 0x2196, 0x2197, 0x2198, 0x2199,
+    0x21A9, 0x21AA, 0x231A, 0x231B, 0x2328, 0x23CF, 0x23E9, 0x23EA,
+    0x23EB, 0x23EC, 0x23ED, 0x23EE, 0x23EF, 0x23F0, 0x23F1, 0x23F2,
+    0x23F3, 0x23F8, 0x23F9, 0x23FA, 0x24C2, 0x25AA, 0x25AB, 0x25B6,
+    0x25C0, 0x25FB, 0x25FC, 0x25FD, 0x25FE, 0x2600, 0x2601, 0x2602,
+    0x2603, 0x2604, 0x260E, 0x2611, 0x2614, 0x2615, 0x2618, 0x261D,
+    0x2620, 0x2622, 0x2623, 0x2626, 0x262A, 0x262E, 0x262F, 0x2638,
+    0x2639, 0x263A, 0x2640, 0x2642, 0x2648, 0x2649, 0x264A, 0x264B,
+    0x264C, 0x264D, 0x264E, 0x264F, 0x2650, 0x2651, 0x2652, 0x2653,
+    0x265F, 0x2660, 0x2663, 0x2665, 0x2666, 0x2668, 0x267B, 0x267E,
+    0x267F, 0x2692, 0x2693, 0x2694, 0x2695, 0x2696, 0x2697, 0x2699,
+    0x269B, 0x269C, 0x26A0, 0x26A1, 0x26A7, 0x26AA, 0x26AB, 0x26B0,
+    0x26B1, 0x26BD, 0x26BE, 0x26C4, 0x26C5, 0x26C8, 0x26CE, 0x26CF,
+    0x26D1, 0x26D3, 0x26D4, 0x26E9, 0x26EA, 0x26F0, 0x26F1, 0x26F2,
+    0x26F3, 0x26F4, 0x26F5, 0x26F7, 0x26F8, 0x26F9, 0x26FA, 0x26FD,
+    0x2702, 0x2705, 0x2708, 0x2709, 0x270A, 0x270B, 0x270C, 0x270D,
+    0x270F, 0x2712, 0x2714, 0x2716, 0x271D, 0x2721, 0x2728, 0x2733,
+    0x2734, 0x2744, 0x2747, 0x274C, 0x274E, 0x2753, 0x2754, 0x2755,
+    0x2757, 0x2763, 0x2764, 0x2795, 0x2796, 0x2797, 0x27A1, 0x27B0,
+    0x27BF, 0x2934, 0x2935, 0x2B05, 0x2B06, 0x2B07, 0x2B1B, 0x2B1C,
+    0x2B50, 0x2B55, 0x3030, 0x303D, 0x3297, 0x3299, 0x1F004, 0x1F0CF,
+    0x1F170, 0x1F171, 0x1F17E, 0x1F17F, 0x1F18E, 0x1F191, 0x1F192, 0x1F193,
+    0x1F194, 0x1F195, 0x1F196, 0x1F197, 0x1F198, 0x1F199, 0x1F19A, 0x1F1E6,
+    0x1F1E7, 0x1F1E8, 0x1F1E9, 0x1F1EA, 0x1F1EB, 0x1F1EC, 0x1F1ED, 0x1F1EE,
+    0x1F1EF, 0x1F1F0, 0x1F1F1, 0x1F1F2, 0x1F1F3, 0x1F1F4, 0x1F1F5, 0x1F1F6,
+    0x1F1F7, 0x1F1F8, 0x1F1F9, 0x1F1FA, 0x1F1FB, 0x1F1FC, 0x1F1FD, 0x1F1FE,
+    0x1F1FF, 0x1F201, 0x1F202, 0x1F21A, 0x1F22F, 0x1F232, 0x1F233, 0x1F234,
+    0x1F235, 0x1F236, 0x1F237, 0x1F238, 0x1F239, 0x1F23A, 0x1F250, 0x1F251,
+    0x1F300, 0x1F301, 0x1F302, 0x1F303, 0x1F304, 0x1F305, 0x1F306, 0x1F307,
+    0x1F308, 0x1F309, 0x1F30A, 0x1F30B, 0x1F30C, 0x1F30D, 0x1F30E, 0x1F30F,
+    0x1F310, 0x1F311, 0x1F312, 0x1F313, 0x1F314, 0x1F315, 0x1F316, 0x1F317,
+    0x1F318, 0x1F319, 0x1F31A, 0x1F31B, 0x1F31C, 0x1F31D, 0x1F31E, 0x1F31F,
+    0x1F320, 0x1F321, 0x1F324, 0x1F325, 0x1F326, 0x1F327, 0x1F328, 0x1F329,
+    0x1F32A, 0x1F32B, 0x1F32C, 0x1F32D, 0x1F32E, 0x1F32F, 0x1F330, 0x1F331,
+    0x1F332, 0x1F333, 0x1F334, 0x1F335, 0x1F336, 0x1F337, 0x1F338, 0x1F339,
+    0x1F33A, 0x1F33B, 0x1F33C, 0x1F33D, 0x1F33E, 0x1F33F, 0x1F340, 0x1F341,
+    0x1F342, 0x1F343, 0x1F344, 0x1F345, 0x1F346, 0x1F347, 0x1F348, 0x1F349,
+    0x1F34A, 0x1F34B, 0x1F34C, 0x1F34D, 0x1F34E, 0x1F34F, 0x1F350, 0x1F351,
+    0x1F352, 0x1F353, 0x1F354, 0x1F355, 0x1F356, 0x1F357, 0x1F358, 0x1F359,
+    0x1F35A, 0x1F35B, 0x1F35C, 0x1F35D, 0x1F35E, 0x1F35F, 0x1F360, 0x1F361,
+    0x1F362, 0x1F363, 0x1F364, 0x1F365, 0x1F366, 0x1F367, 0x1F368, 0x1F369,
+    0x1F36A, 0x1F36B, 0x1F36C, 0x1F36D, 0x1F36E, 0x1F36F, 0x1F370, 0x1F371,
+    0x1F372, 0x1F373, 0x1F374, 0x1F375, 0x1F376, 0x1F377, 0x1F378, 0x1F379,
+    0x1F37A, 0x1F37B, 0x1F37C, 0x1F37D, 0x1F37E, 0x1F37F, 0x1F380, 0x1F381,
+    0x1F382, 0x1F383, 0x1F384, 0x1F385, 0x1F386, 0x1F387, 0x1F388, 0x1F389,
+    0x1F38A, 0x1F38B, 0x1F38C, 0x1F38D, 0x1F38E, 0x1F38F, 0x1F390, 0x1F391,
+    0x1F392, 0x1F393, 0x1F396, 0x1F397, 0x1F399, 0x1F39A, 0x1F39B, 0x1F39E,
+    0x1F39F, 0x1F3A0, 0x1F3A1, 0x1F3A2, 0x1F3A3, 0x1F3A4, 0x1F3A5, 0x1F3A6,
+    0x1F3A7, 0x1F3A8, 0x1F3A9, 0x1F3AA, 0x1F3AB, 0x1F3AC, 0x1F3AD, 0x1F3AE,
+    0x1F3AF, 0x1F3B0, 0x1F3B1, 0x1F3B2, 0x1F3B3, 0x1F3B4, 0x1F3B5, 0x1F3B6,
+    0x1F3B7, 0x1F3B8, 0x1F3B9, 0x1F3BA, 0x1F3BB, 0x1F3BC, 0x1F3BD, 0x1F3BE,
+    0x1F3BF, 0x1F3C0, 0x1F3C1, 0x1F3C2, 0x1F3C3, 0x1F3C4, 0x1F3C5, 0x1F3C6,
+    0x1F3C7, 0x1F3C8, 0x1F3C9, 0x1F3CA, 0x1F3CB, 0x1F3CC, 0x1F3CD, 0x1F3CE,
+    0x1F3CF, 0x1F3D0, 0x1F3D1, 0x1F3D2, 0x1F3D3, 0x1F3D4, 0x1F3D5, 0x1F3D6,
+    0x1F3D7, 0x1F3D8, 0x1F3D9, 0x1F3DA, 0x1F3DB, 0x1F3DC, 0x1F3DD, 0x1F3DE,
+    0x1F3DF, 0x1F3E0, 0x1F3E1, 0x1F3E2, 0x1F3E3, 0x1F3E4, 0x1F3E5, 0x1F3E6,
+    0x1F3E7, 0x1F3E8, 0x1F3E9, 0x1F3EA, 0x1F3EB, 0x1F3EC, 0x1F3ED, 0x1F3EE,
+    0x1F3EF, 0x1F3F0, 0x1F3F3, 0x1F3F4, 0x1F3F5, 0x1F3F7, 0x1F3F8, 0x1F3F9,
+    0x1F3FA, 0x1F400, 0x1F401, 0x1F402, 0x1F403, 0x1F404, 0x1F405, 0x1F406,
+    0x1F407, 0x1F408, 0x1F409, 0x1F40A, 0x1F40B, 0x1F40C, 0x1F40D, 0x1F40E,
+    0x1F40F, 0x1F410, 0x1F411, 0x1F412, 0x1F413, 0x1F414, 0x1F415, 0x1F416,
+    0x1F417, 0x1F418, 0x1F419, 0x1F41A, 0x1F41B, 0x1F41C, 0x1F41D, 0x1F41E,
+    0x1F41F, 0x1F420, 0x1F421, 0x1F422, 0x1F423, 0x1F424, 0x1F425, 0x1F426,
+    0x1F427, 0x1F428, 0x1F429, 0x1F42A, 0x1F42B, 0x1F42C, 0x1F42D, 0x1F42E,
+    0x1F42F, 0x1F430, 0x1F431, 0x1F432, 0x1F433, 0x1F434, 0x1F435, 0x1F436,
+    0x1F437, 0x1F438, 0x1F439, 0x1F43A, 0x1F43B, 0x1F43C, 0x1F43D, 0x1F43E,
+    0x1F43F, 0x1F440, 0x1F441, 0x1F442, 0x1F443, 0x1F444, 0x1F445, 0x1F446,
+    0x1F447, 0x1F448, 0x1F449, 0x1F44A, 0x1F44B, 0x1F44C, 0x1F44D, 0x1F44E,
+    0x1F44F, 0x1F450, 0x1F451, 0x1F452, 0x1F453, 0x1F454, 0x1F455, 0x1F456,
+    0x1F457, 0x1F458, 0x1F459, 0x1F45A, 0x1F45B, 0x1F45C, 0x1F45D, 0x1F45E,
+    0x1F45F, 0x1F460, 0x1F461, 0x1F462, 0x1F463, 0x1F464, 0x1F465, 0x1F466,
+    0x1F467, 0x1F468, 0x1F469, 0x1F46A, 0x1F46B, 0x1F46C, 0x1F46D, 0x1F46E,
+    0x1F46F, 0x1F470, 0x1F471, 0x1F472, 0x1F473, 0x1F474, 0x1F475, 0x1F476,
+    0x1F477, 0x1F478, 0x1F479, 0x1F47A, 0x1F47B, 0x1F47C, 0x1F47D, 0x1F47E,
+    0x1F47F, 0x1F480, 0x1F481, 0x1F482, 0x1F483, 0x1F484, 0x1F485, 0x1F486,
+    0x1F487, 0x1F488, 0x1F489, 0x1F48A, 0x1F48B, 0x1F48C, 0x1F48D, 0x1F48E,
+    0x1F48F, 0x1F490, 0x1F491, 0x1F492, 0x1F493, 0x1F494, 0x1F495, 0x1F496,
+    0x1F497, 0x1F498, 0x1F499, 0x1F49A, 0x1F49B, 0x1F49C, 0x1F49D, 0x1F49E,
+    0x1F49F, 0x1F4A0, 0x1F4A1, 0x1F4A2, 0x1F4A3, 0x1F4A4, 0x1F4A5, 0x1F4A6,
+    0x1F4A7, 0x1F4A8, 0x1F4A9, 0x1F4AA, 0x1F4AB, 0x1F4AC, 0x1F4AD, 0x1F4AE,
+    0x1F4AF, 0x1F4B0, 0x1F4B1, 0x1F4B2, 0x1F4B3, 0x1F4B4, 0x1F4B5, 0x1F4B6,
+    0x1F4B7, 0x1F4B8, 0x1F4B9, 0x1F4BA, 0x1F4BB, 0x1F4BC, 0x1F4BD, 0x1F4BE,
+    0x1F4BF, 0x1F4C0, 0x1F4C1, 0x1F4C2, 0x1F4C3, 0x1F4C4, 0x1F4C5, 0x1F4C6,
+    0x1F4C7, 0x1F4C8, 0x1F4C9, 0x1F4CA, 0x1F4CB, 0x1F4CC, 0x1F4CD, 0x1F4CE,
+    0x1F4CF, 0x1F4D0, 0x1F4D1, 0x1F4D2, 0x1F4D3, 0x1F4D4, 0x1F4D5, 0x1F4D6,
+    0x1F4D7, 0x1F4D8, 0x1F4D9, 0x1F4DA, 0x1F4DB, 0x1F4DC, 0x1F4DD, 0x1F4DE,
+    0x1F4DF, 0x1F4E0, 0x1F4E1, 0x1F4E2, 0x1F4E3, 0x1F4E4, 0x1F4E5, 0x1F4E6,
+    0x1F4E7, 0x1F4E8, 0x1F4E9, 0x1F4EA, 0x1F4EB, 0x1F4EC, 0x1F4ED, 0x1F4EE,
+    0x1F4EF, 0x1F4F0, 0x1F4F1, 0x1F4F2, 0x1F4F3, 0x1F4F4, 0x1F4F5, 0x1F4F6,
+    0x1F4F7, 0x1F4F8, 0x1F4F9, 0x1F4FA, 0x1F4FB, 0x1F4FC, 0x1F4FD, 0x1F4FF,
+    0x1F500, 0x1F501, 0x1F502, 0x1F503, 0x1F504, 0x1F505, 0x1F506, 0x1F507,
+    0x1F508, 0x1F509, 0x1F50A, 0x1F50B, 0x1F50C, 0x1F50D, 0x1F50E, 0x1F50F,
+    0x1F510, 0x1F511, 0x1F512, 0x1F513, 0x1F514, 0x1F515, 0x1F516, 0x1F517,
+    0x1F518, 0x1F519, 0x1F51A, 0x1F51B, 0x1F51C, 0x1F51D, 0x1F51E, 0x1F51F,
+    0x1F520, 0x1F521, 0x1F522, 0x1F523, 0x1F524, 0x1F525, 0x1F526, 0x1F527,
+    0x1F528, 0x1F529, 0x1F52A, 0x1F52B, 0x1F52C, 0x1F52D, 0x1F52E, 0x1F52F,
+    0x1F530, 0x1F531, 0x1F532, 0x1F533, 0x1F534, 0x1F535, 0x1F536, 0x1F537,
+    0x1F538, 0x1F539, 0x1F53A, 0x1F53B, 0x1F53C, 0x1F53D, 0x1F549, 0x1F54A,
+    0x1F54B, 0x1F54C, 0x1F54D, 0x1F54E, 0x1F550, 0x1F551, 0x1F552, 0x1F553,
+    0x1F554, 0x1F555, 0x1F556, 0x1F557, 0x1F558, 0x1F559, 0x1F55A, 0x1F55B,
+    0x1F55C, 0x1F55D, 0x1F55E, 0x1F55F, 0x1F560, 0x1F561, 0x1F562, 0x1F563,
+    0x1F564, 0x1F565, 0x1F566, 0x1F567, 0x1F56F, 0x1F570, 0x1F573, 0x1F574,
+    0x1F575, 0x1F576, 0x1F577, 0x1F578, 0x1F579, 0x1F57A, 0x1F587, 0x1F58A,
+    0x1F58B, 0x1F58C, 0x1F58D, 0x1F590, 0x1F595, 0x1F596, 0x1F5A4, 0x1F5A5,
+    0x1F5A8, 0x1F5B1, 0x1F5B2, 0x1F5BC, 0x1F5C2, 0x1F5C3, 0x1F5C4, 0x1F5D1,
+    0x1F5D2, 0x1F5D3, 0x1F5DC, 0x1F5DD, 0x1F5DE, 0x1F5E1, 0x1F5E3, 0x1F5E8,
+    0x1F5EF, 0x1F5F3, 0x1F5FA, 0x1F5FB, 0x1F5FC, 0x1F5FD, 0x1F5FE, 0x1F5FF,
+    0x1F600, 0x1F601, 0x1F602, 0x1F603, 0x1F604, 0x1F605, 0x1F606, 0x1F607,
+    0x1F608, 0x1F609, 0x1F60A, 0x1F60B, 0x1F60C, 0x1F60D, 0x1F60E, 0x1F60F,
+    0x1F610, 0x1F611, 0x1F612, 0x1F613, 0x1F614, 0x1F615, 0x1F616, 0x1F617,
+    0x1F618, 0x1F619, 0x1F61A, 0x1F61B, 0x1F61C, 0x1F61D, 0x1F61E, 0x1F61F,
+    0x1F620, 0x1F621, 0x1F622, 0x1F623, 0x1F624, 0x1F625, 0x1F626, 0x1F627,
+    0x1F628, 0x1F629, 0x1F62A, 0x1F62B, 0x1F62C, 0x1F62D, 0x1F62E, 0x1F62F,
+    0x1F630, 0x1F631, 0x1F632, 0x1F633, 0x1F634, 0x1F635, 0x1F636, 0x1F637,
+    0x1F638, 0x1F639, 0x1F63A, 0x1F63B, 0x1F63C, 0x1F63D, 0x1F63E, 0x1F63F,
+    0x1F640, 0x1F641, 0x1F642, 0x1F643, 0x1F644, 0x1F645, 0x1F646, 0x1F647,
+    0x1F648, 0x1F649, 0x1F64A, 0x1F64B, 0x1F64C, 0x1F64D, 0x1F64E, 0x1F64F,
+    0x1F680, 0x1F681, 0x1F682, 0x1F683, 0x1F684, 0x1F685, 0x1F686, 0x1F687,
+    0x1F688, 0x1F689, 0x1F68A, 0x1F68B, 0x1F68C, 0x1F68D, 0x1F68E, 0x1F68F,
+    0x1F690, 0x1F691, 0x1F692, 0x1F693, 0x1F694, 0x1F695, 0x1F696, 0x1F697,
+    0x1F698, 0x1F699, 0x1F69A, 0x1F69B, 0x1F69C, 0x1F69D, 0x1F69E, 0x1F69F,
+    0x1F6A0, 0x1F6A1, 0x1F6A2, 0x1F6A3, 0x1F6A4, 0x1F6A5, 0x1F6A6, 0x1F6A7,
+    0x1F6A8, 0x1F6A9, 0x1F6AA, 0x1F6AB, 0x1F6AC, 0x1F6AD, 0x1F6AE, 0x1F6AF,
+    0x1F6B0, 0x1F6B1, 0x1F6B2, 0x1F6B3, 0x1F6B4, 0x1F6B5, 0x1F6B6, 0x1F6B7,
+    0x1F6B8, 0x1F6B9, 0x1F6BA, 0x1F6BB, 0x1F6BC, 0x1F6BD, 0x1F6BE, 0x1F6BF,
+    0x1F6C0, 0x1F6C1, 0x1F6C2, 0x1F6C3, 0x1F6C4, 0x1F6C5, 0x1F6CB, 0x1F6CC,
+    0x1F6CD, 0x1F6CE, 0x1F6CF, 0x1F6D0, 0x1F6D1, 0x1F6D2, 0x1F6D5, 0x1F6D6,
+    0x1F6D7, 0x1F6DC, 0x1F6DD, 0x1F6DE, 0x1F6DF, 0x1F6E0, 0x1F6E1, 0x1F6E2,
+    0x1F6E3, 0x1F6E4, 0x1F6E5, 0x1F6E9, 0x1F6EB, 0x1F6EC, 0x1F6F0, 0x1F6F3,
+    0x1F6F4, 0x1F6F5, 0x1F6F6, 0x1F6F7, 0x1F6F8, 0x1F6F9, 0x1F6FA, 0x1F6FB,
+    0x1F6FC, 0x1F7E0, 0x1F7E1, 0x1F7E2, 0x1F7E3, 0x1F7E4, 0x1F7E5, 0x1F7E6,
+    0x1F7E7, 0x1F7E8, 0x1F7E9, 0x1F7EA, 0x1F7EB, 0x1F7F0, 0x1F90C, 0x1F90D,
+    0x1F90E, 0x1F90F, 0x1F910, 0x1F911, 0x1F912, 0x1F913, 0x1F914, 0x1F915,
+    0x1F916, 0x1F917, 0x1F918, 0x1F919, 0x1F91A, 0x1F91B, 0x1F91C, 0x1F91D,
+    0x1F91E, 0x1F91F, 0x1F920, 0x1F921, 0x1F922, 0x1F923, 0x1F924, 0x1F925,
+    0x1F926, 0x1F927, 0x1F928, 0x1F929, 0x1F92A, 0x1F92B, 0x1F92C, 0x1F92D,
+    0x1F92E, 0x1F92F, 0x1F930, 0x1F931, 0x1F932, 0x1F933, 0x1F934, 0x1F935,
+    0x1F936, 0x1F937, 0x1F938, 0x1F939, 0x1F93A, 0x1F93C, 0x1F93D, 0x1F93E,
+    0x1F93F, 0x1F940, 0x1F941, 0x1F942, 0x1F943, 0x1F944, 0x1F945, 0x1F947,
+    0x1F948, 0x1F949, 0x1F94A, 0x1F94B, 0x1F94C, 0x1F94D, 0x1F94E, 0x1F94F,
+    0x1F950, 0x1F951, 0x1F952, 0x1F953, 0x1F954, 0x1F955, 0x1F956, 0x1F957,
+    0x1F958, 0x1F959, 0x1F95A, 0x1F95B, 0x1F95C, 0x1F95D, 0x1F95E, 0x1F95F,
+    0x1F960, 0x1F961, 0x1F962, 0x1F963, 0x1F964, 0x1F965, 0x1F966, 0x1F967,
+    0x1F968, 0x1F969, 0x1F96A, 0x1F96B, 0x1F96C, 0x1F96D, 0x1F96E, 0x1F96F,
+    0x1F970, 0x1F971, 0x1F972, 0x1F973, 0x1F974, 0x1F975, 0x1F976, 0x1F977,
+    0x1F978, 0x1F979, 0x1F97A, 0x1F97B, 0x1F97C, 0x1F97D, 0x1F97E, 0x1F97F,
+    0x1F980, 0x1F981, 0x1F982, 0x1F983, 0x1F984, 0x1F985, 0x1F986, 0x1F987,
+    0x1F988, 0x1F989, 0x1F98A, 0x1F98B, 0x1F98C, 0x1F98D, 0x1F98E, 0x1F98F,
+    0x1F990, 0x1F991, 0x1F992, 0x1F993, 0x1F994, 0x1F995, 0x1F996, 0x1F997,
+    0x1F998, 0x1F999, 0x1F99A, 0x1F99B, 0x1F99C, 0x1F99D, 0x1F99E, 0x1F99F,
+    0x1F9A0, 0x1F9A1, 0x1F9A2, 0x1F9A3, 0x1F9A4, 0x1F9A5, 0x1F9A6, 0x1F9A7,
+    0x1F9A8, 0x1F9A9, 0x1F9AA, 0x1F9AB, 0x1F9AC, 0x1F9AD, 0x1F9AE, 0x1F9AF,
+    0x1F9B4, 0x1F9B5, 0x1F9B6, 0x1F9B7, 0x1F9B8, 0x1F9B9, 0x1F9BA, 0x1F9BB,
+    0x1F9BC, 0x1F9BD, 0x1F9BE, 0x1F9BF, 0x1F9C0, 0x1F9C1, 0x1F9C2, 0x1F9C3,
+    0x1F9C4, 0x1F9C5, 0x1F9C6, 0x1F9C7, 0x1F9C8, 0x1F9C9, 0x1F9CA, 0x1F9CB,
+    0x1F9CC, 0x1F9CD, 0x1F9CE, 0x1F9CF, 0x1F9D0, 0x1F9D1, 0x1F9D2, 0x1F9D3,
+    0x1F9D4, 0x1F9D5, 0x1F9D6, 0x1F9D7, 0x1F9D8, 0x1F9D9, 0x1F9DA, 0x1F9DB,
+    0x1F9DC, 0x1F9DD, 0x1F9DE, 0x1F9DF, 0x1F9E0, 0x1F9E1, 0x1F9E2, 0x1F9E3,
+    0x1F9E4, 0x1F9E5, 0x1F9E6, 0x1F9E7, 0x1F9E8, 0x1F9E9, 0x1F9EA, 0x1F9EB,
+    0x1F9EC, 0x1F9ED, 0x1F9EE, 0x1F9EF, 0x1F9F0, 0x1F9F1, 0x1F9F2, 0x1F9F3,
+    0x1F9F4, 0x1F9F5, 0x1F9F6, 0x1F9F7, 0x1F9F8, 0x1F9F9, 0x1F9FA, 0x1F9FB,
+    0x1F9FC, 0x1F9FD, 0x1F9FE, 0x1F9FF, 0x1FA70, 0x1FA71, 0x1FA72, 0x1FA73,
+    0x1FA74, 0x1FA75, 0x1FA76, 0x1FA77, 0x1FA78, 0x1FA79, 0x1FA7A, 0x1FA7B,
+    0x1FA7C, 0x1FA80, 0x1FA81, 0x1FA82, 0x1FA83, 0x1FA84, 0x1FA85, 0x1FA86,
+    0x1FA87, 0x1FA88, 0x1FA89, 0x1FA8F, 0x1FA90, 0x1FA91, 0x1FA92, 0x1FA93,
+    0x1FA94, 0x1FA95, 0x1FA96, 0x1FA97, 0x1FA98, 0x1FA99, 0x1FA9A, 0x1FA9B,
+    0x1FA9C, 0x1FA9D, 0x1FA9E, 0x1FA9F, 0x1FAA0, 0x1FAA1, 0x1FAA2, 0x1FAA3,
+    0x1FAA4, 0x1FAA5, 0x1FAA6, 0x1FAA7, 0x1FAA8, 0x1FAA9, 0x1FAAA, 0x1FAAB,
+    0x1FAAC, 0x1FAAD, 0x1FAAE, 0x1FAAF, 0x1FAB0, 0x1FAB1, 0x1FAB2, 0x1FAB3,
+    0x1FAB4, 0x1FAB5, 0x1FAB6, 0x1FAB7, 0x1FAB8, 0x1FAB9, 0x1FABA, 0x1FABB,
+    0x1FABC, 0x1FABD, 0x1FABE, 0x1FABF, 0x1FAC0, 0x1FAC1, 0x1FAC2, 0x1FAC3,
+    0x1FAC4, 0x1FAC5, 0x1FAC6, 0x1FACE, 0x1FACF, 0x1FAD0, 0x1FAD1, 0x1FAD2,
+    0x1FAD3, 0x1FAD4, 0x1FAD5, 0x1FAD6, 0x1FAD7, 0x1FAD8, 0x1FAD9, 0x1FADA,
+    0x1FADB, 0x1FADC, 0x1FADF, 0x1FAE0, 0x1FAE1, 0x1FAE2, 0x1FAE3, 0x1FAE4,
+    0x1FAE5, 0x1FAE6, 0x1FAE7, 0x1FAE8, 0x1FAE9, 0x1FAF0, 0x1FAF1, 0x1FAF2,
+    0x1FAF3, 0x1FAF4, 0x1FAF5, 0x1FAF6, 0x1FAF7, 0x1FAF8, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0xFE0F,
+    0xFE0F, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0x1F1E8, 0x1F1E9, 0x1F1EA, 0x1F1EB, 0x1F1EC, 0x1F1EE,
+    0x1F1F1, 0x1F1F2, 0x1F1F4, 0x1F1F6, 0x1F1F7, 0x1F1F8, 0x1F1F9, 0x1F1FA,
+    0x1F1FC, 0x1F1FD, 0x1F1FF, 0x1F1E6, 0x1F1E7, 0x1F1E9, 0x1F1EA, 0x1F1EB,
+    0x1F1EC, 0x1F1ED, 0x1F1EE, 0x1F1EF, 0x1F1F1, 0x1F1F2, 0x1F1F3, 0x1F1F4,
+    0x1F1F6, 0x1F1F7, 0x1F1F8, 0x1F1F9, 0x1F1FB, 0x1F1FC, 0x1F1FE, 0x1F1FF,
+    0x1F1E6, 0x1F1E8, 0x1F1E9, 0x1F1EB, 0x1F1EC, 0x1F1ED, 0x1F1EE, 0x1F1F0,
+    0x1F1F1, 0x1F1F2, 0x1F1F3, 0x1F1F4, 0x1F1F5, 0x1F1F6, 0x1F1F7, 0x1F1FA,
+    0x1F1FB, 0x1F1FC, 0x1F1FD, 0x1F1FE, 0x1F1FF, 0x1F1EA, 0x1F1EC, 0x1F1EF,
+    0x1F1F0, 0x1F1F2, 0x1F1F4, 0x1F1FF, 0x1F1E6, 0x1F1E8, 0x1F1EA, 0x1F1EC,
+    0x1F1ED, 0x1F1F7, 0x1F1F8, 0x1F1F9, 0x1F1FA, 0x1F1EE, 0x1F1EF, 0x1F1F0,
+    0x1F1F2, 0x1F1F4, 0x1F1F7, 0x1F1E6, 0x1F1E7, 0x1F1E9, 0x1F1EA, 0x1F1EB,
+    0x1F1EC, 0x1F1ED, 0x1F1EE, 0x1F1F1, 0x1F1F2, 0x1F1F3, 0x1F1F5, 0x1F1F6,
+    0x1F1F7, 0x1F1F8, 0x1F1F9, 0x1F1FA, 0x1F1FC, 0x1F1FE, 0x1F1F0, 0x1F1F2,
+    0x1F1F3, 0x1F1F7, 0x1F1F9, 0x1F1FA, 0x1F1E8, 0x1F1E9, 0x1F1EA, 0x1F1F1,
+    0x1F1F2, 0x1F1F3, 0x1F1F4, 0x1F1F6, 0x1F1F7, 0x1F1F8, 0x1F1F9, 0x1F1EA,
+    0x1F1F2, 0x1F1F4, 0x1F1F5, 0x1F1EA, 0x1F1EC, 0x1F1ED, 0x1F1EE, 0x1F1F2,
+    0x1F1F3, 0x1F1F5, 0x1F1F7, 0x1F1FC, 0x1F1FE, 0x1F1FF, 0x1F1E6, 0x1F1E7,
+    0x1F1E8, 0x1F1EE, 0x1F1F0, 0x1F1F7, 0x1F1F8, 0x1F1F9, 0x1F1FA, 0x1F1FB,
+    0x1F1FE, 0x1F1E6, 0x1F1E8, 0x1F1E9, 0x1F1EA, 0x1F1EB, 0x1F1EC, 0x1F1ED,
+    0x1F1F0, 0x1F1F1, 0x1F1F2, 0x1F1F3, 0x1F1F4, 0x1F1F5, 0x1F1F6, 0x1F1F7,
+    0x1F1F8, 0x1F1F9, 0x1F1FA, 0x1F1FB, 0x1F1FC, 0x1F1FD, 0x1F1FE, 0x1F1FF,
+    0x1F1E6, 0x1F1E8, 0x1F1EA, 0x1F1EB, 0x1F1EC, 0x1F1EE, 0x1F1F1, 0x1F1F4,
+    0x1F1F5, 0x1F1F7, 0x1F1FA, 0x1F1FF, 0x1F1F2, 0x1F1E6, 0x1F1EA, 0x1F1EB,
+    0x1F1EC, 0x1F1ED, 0x1F1F0, 0x1F1F1, 0x1F1F2, 0x1F1F3, 0x1F1F7, 0x1F1F8,
+    0x1F1F9, 0x1F1FC, 0x1F1FE, 0x1F1E6, 0x1F1EA, 0x1F1F4, 0x1F1F8, 0x1F1FA,
+    0x1F1FC, 0x1F1E6, 0x1F1E7, 0x1F1E8, 0x1F1E9, 0x1F1EA, 0x1F1EC, 0x1F1ED,
+    0x1F1EE, 0x1F1EF, 0x1F1F0, 0x1F1F1, 0x1F1F2, 0x1F1F3, 0x1F1F4, 0x1F1F7,
+    0x1F1F8, 0x1F1F9, 0x1F1FB, 0x1F1FD, 0x1F1FE, 0x1F1FF, 0x1F1E6, 0x1F1E8,
+    0x1F1E9, 0x1F1EB, 0x1F1EC, 0x1F1ED, 0x1F1EF, 0x1F1F0, 0x1F1F1, 0x1F1F2,
+    0x1F1F3, 0x1F1F4, 0x1F1F7, 0x1F1F9, 0x1F1FB, 0x1F1FC, 0x1F1FF, 0x1F1E6,
+    0x1F1EC, 0x1F1F2, 0x1F1F3, 0x1F1F8, 0x1F1FE, 0x1F1FF, 0x1F1E6, 0x1F1E8,
+    0x1F1EA, 0x1F1EC, 0x1F1EE, 0x1F1F3, 0x1F1FA, 0x1F1EB, 0x1F1F8, 0x1F1F0,
+    0x1F1EA, 0x1F1F9, 0x1F1E6, 0x1F1F2, 0x1F1FC, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0x200D, 0x200D, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0xFE0F, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0x200D, 0xE0067, 0xFE0F, 0xFE0F, 0x200D, 0x200D, 0x200D, 0x200D,
+    0xFE0F, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x200D,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x200D, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3,
+    0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x200D, 0x200D, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x1F7EB, 0x1F7E9, 0x2640,
+    0x2642, 0x27A1, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640,
+    0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x200D, 0x200D, 0x2620, 0xE0062, 0x2B1B, 0x1F9BA, 0x2B1B, 0x1F525,
+    0x2744, 0x200D, 0x2695, 0x2696, 0x2708, 0x2764, 0x1F33E, 0x1F373,
+    0x1F37C, 0x1F393, 0x1F3A4, 0x1F3A8, 0x1F3EB, 0x1F3ED, 0x1F466, 0x1F467,
+    0x1F468, 0x1F469, 0x1F4BB, 0x1F4BC, 0x1F527, 0x1F52C, 0x1F680, 0x1F692,
+    0x1F9AF, 0x1F9B0, 0x1F9B1, 0x1F9B2, 0x1F9B3, 0x1F9BC, 0x1F9BD, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x2695, 0x2696, 0x2708, 0x2764,
+    0x1F33E, 0x1F373, 0x1F37C, 0x1F393, 0x1F3A4, 0x1F3A8, 0x1F3EB, 0x1F3ED,
+    0x1F466, 0x1F467, 0x1F469, 0x1F4BB, 0x1F4BC, 0x1F527, 0x1F52C, 0x1F680,
+    0x1F692, 0x1F9AF, 0x1F9B0, 0x1F9B1, 0x1F9B2, 0x1F9B3, 0x1F9BC, 0x1F9BD,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x2640, 0x2642,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x200D, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x200D, 0x200D, 0x200D,
+    0x200D, 0x200D, 0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x200D, 0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640,
+    0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x1F4A8, 0x1F4AB, 0x1F32B, 0x2194,
+    0x2195, 0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640,
+    0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x200D, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x200D, 0x200D, 0x200D,
+    0x200D, 0x200D, 0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x200D, 0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x2640, 0x2642, 0x27A1, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640,
+    0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x200D, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x2640, 0x2642, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x200D, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x200D, 0x200D, 0x200D,
+    0x200D, 0x200D, 0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x200D, 0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x2640, 0x2642, 0x27A1, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2695,
+    0x2696, 0x2708, 0x1F33E, 0x1F373, 0x1F37C, 0x1F384, 0x1F393, 0x1F3A4,
+    0x1F3A8, 0x1F3EB, 0x1F3ED, 0x1F4BB, 0x1F4BC, 0x1F527, 0x1F52C, 0x1F680,
+    0x1F692, 0x1F91D, 0x1F9AF, 0x1F9B0, 0x1F9B1, 0x1F9B2, 0x1F9B3, 0x1F9BC,
+    0x1F9BD, 0x1F9D1, 0x1F9D2, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640,
+    0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x200D, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x2640, 0x2642, 0x200D, 0x200D, 0x200D,
+    0x200D, 0x200D, 0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x200D, 0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D,
+    0x1F4A5, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x1F525, 0x1FA79, 0x200D,
+    0xFE0F, 0x200D, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x27A1, 0x2640,
+    0x2642, 0x27A1, 0x2640, 0x2642, 0x27A1, 0x2640, 0x2642, 0x27A1,
+    0x2640, 0x2642, 0x27A1, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F,
+    0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x26A7, 0x1F308, 0xFE0F, 0xE0065, 0xE0073,
+    0xE0077, 0xFE0F, 0x1F5E8, 0xFE0F, 0xFE0F, 0xFE0F, 0x200D, 0xFE0F,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2695,
+    0x2696, 0x2708, 0x2764, 0x1F33E, 0x1F373, 0x1F37C, 0x1F393, 0x1F3A4,
+    0x1F3A8, 0x1F3EB, 0x1F3ED, 0x1F4BB, 0x1F4BC, 0x1F527, 0x1F52C, 0x1F680,
+    0x1F692, 0x1F91D, 0x1F9AF, 0x1F9B0, 0x1F9B1, 0x1F9B2, 0x1F9B3, 0x1F9BC,
+    0x1F9BD, 0x2695, 0x2696, 0x2708, 0x2764, 0x1F33E, 0x1F373, 0x1F37C,
+    0x1F393, 0x1F3A4, 0x1F3A8, 0x1F3EB, 0x1F3ED, 0x1F4BB, 0x1F4BC, 0x1F527,
+    0x1F52C, 0x1F680, 0x1F692, 0x1F91D, 0x1F9AF, 0x1F9B0, 0x1F9B1, 0x1F9B2,
+    0x1F9B3, 0x1F9BC, 0x1F9BD, 0x2695, 0x2696, 0x2708, 0x2764, 0x1F33E,
+    0x1F373, 0x1F37C, 0x1F393, 0x1F3A4, 0x1F3A8, 0x1F3EB, 0x1F3ED, 0x1F4BB,
+    0x1F4BC, 0x1F527, 0x1F52C, 0x1F680, 0x1F692, 0x1F91D, 0x1F9AF, 0x1F9B0,
+    0x1F9B1, 0x1F9B2, 0x1F9B3, 0x1F9BC, 0x1F9BD, 0x2695, 0x2696, 0x2708,
+    0x2764, 0x1F33E, 0x1F373, 0x1F37C, 0x1F393, 0x1F3A4, 0x1F3A8, 0x1F3EB,
+    0x1F3ED, 0x1F4BB, 0x1F4BC, 0x1F527, 0x1F52C, 0x1F680, 0x1F692, 0x1F91D,
+    0x1F9AF, 0x1F9B0, 0x1F9B1, 0x1F9B2, 0x1F9B3, 0x1F9BC, 0x1F9BD, 0x2695,
+    0x2696, 0x2708, 0x2764, 0x1F33E, 0x1F373, 0x1F37C, 0x1F393, 0x1F3A4,
+    0x1F3A8, 0x1F3EB, 0x1F3ED, 0x1F4BB, 0x1F4BC, 0x1F527, 0x1F52C, 0x1F680,
+    0x1F692, 0x1F91D, 0x1F9AF, 0x1F9B0, 0x1F9B1, 0x1F9B2, 0x1F9B3, 0x1F9BC,
+    0x1F9BD, 0xFE0F, 0xFE0F, 0xFE0F, 0x200D, 0xFE0F, 0x200D, 0x200D,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x2695, 0x2696, 0x2708, 0x2764,
+    0x1F33E, 0x1F373, 0x1F37C, 0x1F393, 0x1F3A4, 0x1F3A8, 0x1F3EB, 0x1F3ED,
+    0x1F4BB, 0x1F4BC, 0x1F527, 0x1F52C, 0x1F680, 0x1F692, 0x1F91D, 0x1F9AF,
+    0x1F9B0, 0x1F9B1, 0x1F9B2, 0x1F9B3, 0x1F9BC, 0x1F9BD, 0x2695, 0x2696,
+    0x2708, 0x2764, 0x1F33E, 0x1F373, 0x1F37C, 0x1F393, 0x1F3A4, 0x1F3A8,
+    0x1F3EB, 0x1F3ED, 0x1F4BB, 0x1F4BC, 0x1F527, 0x1F52C, 0x1F680, 0x1F692,
+    0x1F91D, 0x1F9AF, 0x1F9B0, 0x1F9B1, 0x1F9B2, 0x1F9B3, 0x1F9BC, 0x1F9BD,
+    0x2695, 0x2696, 0x2708, 0x2764, 0x1F33E, 0x1F373, 0x1F37C, 0x1F393,
+    0x1F3A4, 0x1F3A8, 0x1F3EB, 0x1F3ED, 0x1F4BB, 0x1F4BC, 0x1F527, 0x1F52C,
+    0x1F680, 0x1F692, 0x1F91D, 0x1F9AF, 0x1F9B0, 0x1F9B1, 0x1F9B2, 0x1F9B3,
+    0x1F9BC, 0x1F9BD, 0x2695, 0x2696, 0x2708, 0x2764, 0x1F33E, 0x1F373,
+    0x1F37C, 0x1F393, 0x1F3A4, 0x1F3A8, 0x1F3EB, 0x1F3ED, 0x1F4BB, 0x1F4BC,
+    0x1F527, 0x1F52C, 0x1F680, 0x1F692, 0x1F91D, 0x1F9AF, 0x1F9B0, 0x1F9B1,
+    0x1F9B2, 0x1F9B3, 0x1F9BC, 0x1F9BD, 0x2695, 0x2696, 0x2708, 0x2764,
+    0x1F33E, 0x1F373, 0x1F37C, 0x1F393, 0x1F3A4, 0x1F3A8, 0x1F3EB, 0x1F3ED,
+    0x1F4BB, 0x1F4BC, 0x1F527, 0x1F52C, 0x1F680, 0x1F692, 0x1F91D, 0x1F9AF,
+    0x1F9B0, 0x1F9B1, 0x1F9B2, 0x1F9B3, 0x1F9BC, 0x1F9BD, 0xFE0F, 0xFE0F,
+    0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642,
+    0x2640, 0x2642, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0x2640, 0x2642,
+    0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642,
+    0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642,
+    0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642,
+    0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642,
+    0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642,
+    0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642,
+    0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642,
+    0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642,
+    0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642,
+    0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642,
+    0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642,
+    0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642,
+    0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F,
+    0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F,
+    0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F,
+    0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F,
+    0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x200D,
+    0xFE0F, 0x200D, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x27A1, 0x2640,
+    0x2642, 0x27A1, 0x2640, 0x2642, 0x27A1, 0x2640, 0x2642, 0x27A1,
+    0x2640, 0x2642, 0x27A1, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F,
+    0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F,
+    0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x200D, 0xFE0F, 0x200D,
+    0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x27A1, 0x2640, 0x2642, 0x27A1,
+    0x2640, 0x2642, 0x27A1, 0x2640, 0x2642, 0x27A1, 0x2640, 0x2642,
+    0x27A1, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0xFE0F,
+    0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x200D, 0x2695, 0x2696,
+    0x2708, 0x2764, 0x1F33E, 0x1F373, 0x1F37C, 0x1F384, 0x1F393, 0x1F3A4,
+    0x1F3A8, 0x1F3EB, 0x1F3ED, 0x1F4BB, 0x1F4BC, 0x1F527, 0x1F52C, 0x1F680,
+    0x1F692, 0x1F91D, 0x1F9AF, 0x1F9B0, 0x1F9B1, 0x1F9B2, 0x1F9B3, 0x1F9BC,
+    0x1F9BD, 0x2695, 0x2696, 0x2708, 0x2764, 0x1F33E, 0x1F373, 0x1F37C,
+    0x1F384, 0x1F393, 0x1F3A4, 0x1F3A8, 0x1F3EB, 0x1F3ED, 0x1F4BB, 0x1F4BC,
+    0x1F527, 0x1F52C, 0x1F680, 0x1F692, 0x1F91D, 0x1F9AF, 0x1F9B0, 0x1F9B1,
+    0x1F9B2, 0x1F9B3, 0x1F9BC, 0x1F9BD, 0x2695, 0x2696, 0x2708, 0x2764,
+    0x1F33E, 0x1F373, 0x1F37C, 0x1F384, 0x1F393, 0x1F3A4, 0x1F3A8, 0x1F3EB,
+    0x1F3ED, 0x1F4BB, 0x1F4BC, 0x1F527, 0x1F52C, 0x1F680, 0x1F692, 0x1F91D,
+    0x1F9AF, 0x1F9B0, 0x1F9B1, 0x1F9B2, 0x1F9B3, 0x1F9BC, 0x1F9BD, 0x2695,
+    0x2696, 0x2708, 0x2764, 0x1F33E, 0x1F373, 0x1F37C, 0x1F384, 0x1F393,
+    0x1F3A4, 0x1F3A8, 0x1F3EB, 0x1F3ED, 0x1F4BB, 0x1F4BC, 0x1F527, 0x1F52C,
+    0x1F680, 0x1F692, 0x1F91D, 0x1F9AF, 0x1F9B0, 0x1F9B1, 0x1F9B2, 0x1F9B3,
+    0x1F9BC, 0x1F9BD, 0x2695, 0x2696, 0x2708, 0x2764, 0x1F33E, 0x1F373,
+    0x1F37C, 0x1F384, 0x1F393, 0x1F3A4, 0x1F3A8, 0x1F3EB, 0x1F3ED, 0x1F4BB,
+    0x1F4BC, 0x1F527, 0x1F52C, 0x1F680, 0x1F692, 0x1F91D, 0x1F9AF, 0x1F9B0,
+    0x1F9B1, 0x1F9B2, 0x1F9B3, 0x1F9BC, 0x1F9BD, 0xFE0F, 0xFE0F, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0xFE0F, 0xFE0F, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0xFE0F, 0xFE0F, 0x2640,
+    0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640, 0x2642, 0x2640,
+    0x2642, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0x1FAF2, 0x1FAF2, 0x1FAF2,
+    0x1FAF2, 0x1FAF2, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0x27A1, 0x200D,
+    0x27A1, 0x200D, 0x200D, 0xFE0F, 0x200D, 0xFE0F, 0xFE0F, 0x200D,
+    0xFE0F, 0x200D, 0xFE0F, 0xFE0F, 0x200D, 0xFE0F, 0x200D, 0xFE0F,
+    0xFE0F, 0x200D, 0xFE0F, 0x200D, 0xFE0F, 0xFE0F, 0x200D, 0xFE0F,
+    0x200D, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xE006E, 0xE0063, 0xE006C, 0xFE0F, 0x1F468, 0x1F48B, 0x200D, 0x1F466,
+    0x1F466, 0x1F467, 0x1F466, 0x1F467, 0x1F466, 0x1F467, 0x27A1, 0x27A1,
+    0x27A1, 0xFE0F, 0xFE0F, 0xFE0F, 0x200D, 0xFE0F, 0x200D, 0x200D,
+    0x200D, 0x200D, 0xFE0F, 0xFE0F, 0xFE0F, 0x200D, 0xFE0F, 0x200D,
+    0x200D, 0x200D, 0x200D, 0xFE0F, 0xFE0F, 0xFE0F, 0x200D, 0xFE0F,
+    0x200D, 0x200D, 0x200D, 0x200D, 0xFE0F, 0xFE0F, 0xFE0F, 0x200D,
+    0xFE0F, 0x200D, 0x200D, 0x200D, 0x200D, 0xFE0F, 0xFE0F, 0xFE0F,
+    0x200D, 0xFE0F, 0x200D, 0x200D, 0x200D, 0x200D, 0x1F468, 0x1F469,
+    0x1F48B, 0x200D, 0x1F466, 0x1F466, 0x1F467, 0x1F466, 0x1F467, 0x27A1,
+    0x27A1, 0x27A1, 0xFE0F, 0xFE0F, 0xFE0F, 0x200D, 0xFE0F, 0x200D,
+    0x200D, 0x200D, 0x200D, 0xFE0F, 0xFE0F, 0xFE0F, 0x200D, 0xFE0F,
+    0x200D, 0x200D, 0x200D, 0x200D, 0xFE0F, 0xFE0F, 0xFE0F, 0x200D,
+    0xFE0F, 0x200D, 0x200D, 0x200D, 0x200D, 0xFE0F, 0xFE0F, 0xFE0F,
+    0x200D, 0xFE0F, 0x200D, 0x200D, 0x200D, 0x200D, 0xFE0F, 0xFE0F,
+    0xFE0F, 0x200D, 0xFE0F, 0x200D, 0x200D, 0x200D, 0x200D, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0x27A1,
+    0x200D, 0x27A1, 0x200D, 0x200D, 0xFE0F, 0x200D, 0xFE0F, 0xFE0F,
+    0x200D, 0xFE0F, 0x200D, 0xFE0F, 0xFE0F, 0x200D, 0xFE0F, 0x200D,
+    0xFE0F, 0xFE0F, 0x200D, 0xFE0F, 0x200D, 0xFE0F, 0xFE0F, 0x200D,
+    0xFE0F, 0x200D, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0x27A1, 0x200D, 0x27A1, 0x200D, 0x200D, 0xFE0F, 0x200D, 0xFE0F,
+    0xFE0F, 0x200D, 0xFE0F, 0x200D, 0xFE0F, 0xFE0F, 0x200D, 0xFE0F,
+    0x200D, 0xFE0F, 0xFE0F, 0x200D, 0xFE0F, 0x200D, 0xFE0F, 0xFE0F,
+    0x200D, 0xFE0F, 0x200D, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0x1F9D1,
+    0x27A1, 0x27A1, 0x27A1, 0x1F9D2, 0x1F9D2, 0xFE0F, 0xFE0F, 0xFE0F,
+    0x200D, 0xFE0F, 0x200D, 0x200D, 0x200D, 0x200D, 0xFE0F, 0xFE0F,
+    0xFE0F, 0x200D, 0xFE0F, 0x200D, 0x200D, 0x200D, 0x200D, 0xFE0F,
+    0xFE0F, 0xFE0F, 0x200D, 0xFE0F, 0x200D, 0x200D, 0x200D, 0x200D,
+    0xFE0F, 0xFE0F, 0xFE0F, 0x200D, 0xFE0F, 0x200D, 0x200D, 0x200D,
+    0x200D, 0xFE0F, 0xFE0F, 0xFE0F, 0x200D, 0xFE0F, 0x200D, 0x200D,
+    0x200D, 0x200D, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0xFE0F, 0x27A1, 0xFE0F, 0x27A1, 0x27A1, 0x200D, 0x27A1, 0x200D,
+    0x27A1, 0x200D, 0x27A1, 0x200D, 0x27A1, 0x200D, 0x27A1, 0x200D,
+    0x27A1, 0x200D, 0x27A1, 0x200D, 0x27A1, 0x200D, 0x27A1, 0x200D,
+    0xE0067, 0xE0074, 0xE0073, 0x200D, 0x1F468, 0x1F48B, 0x200D, 0x200D,
+    0x200D, 0x200D, 0xFE0F, 0xFE0F, 0xFE0F, 0x1F468, 0x1F48B, 0x200D,
+    0x1F468, 0x27A1, 0x27A1, 0x27A1, 0x1F468, 0x1F48B, 0x200D, 0x1F468,
+    0x27A1, 0x27A1, 0x27A1, 0x1F468, 0x1F48B, 0x200D, 0x1F468, 0x27A1,
+    0x27A1, 0x27A1, 0x1F468, 0x1F48B, 0x200D, 0x1F468, 0x27A1, 0x27A1,
+    0x27A1, 0x1F468, 0x1F48B, 0x200D, 0x1F468, 0x27A1, 0x27A1, 0x27A1,
+    0x200D, 0x1F468, 0x1F469, 0x1F48B, 0x200D, 0x200D, 0xFE0F, 0xFE0F,
+    0xFE0F, 0x1F468, 0x1F469, 0x1F48B, 0x200D, 0x1F468, 0x1F469, 0x27A1,
+    0x27A1, 0x27A1, 0x1F468, 0x1F469, 0x1F48B, 0x200D, 0x1F468, 0x1F469,
+    0x27A1, 0x27A1, 0x27A1, 0x1F468, 0x1F469, 0x1F48B, 0x200D, 0x1F468,
+    0x1F469, 0x27A1, 0x27A1, 0x27A1, 0x1F468, 0x1F469, 0x1F48B, 0x200D,
+    0x1F468, 0x1F469, 0x27A1, 0x27A1, 0x27A1, 0x1F468, 0x1F469, 0x1F48B,
+    0x200D, 0x1F468, 0x1F469, 0x27A1, 0x27A1, 0x27A1, 0xFE0F, 0x27A1,
+    0xFE0F, 0x27A1, 0x27A1, 0x200D, 0x27A1, 0x200D, 0x27A1, 0x200D,
+    0x27A1, 0x200D, 0x27A1, 0x200D, 0x27A1, 0x200D, 0x27A1, 0x200D,
+    0x27A1, 0x200D, 0x27A1, 0x200D, 0x27A1, 0x200D, 0xFE0F, 0x27A1,
+    0xFE0F, 0x27A1, 0x27A1, 0x200D, 0x27A1, 0x200D, 0x27A1, 0x200D,
+    0x27A1, 0x200D, 0x27A1, 0x200D, 0x27A1, 0x200D, 0x27A1, 0x200D,
+    0x27A1, 0x200D, 0x27A1, 0x200D, 0x27A1, 0x200D, 0xFE0F, 0xFE0F,
+    0xFE0F, 0x200D, 0x1F48B, 0x1F9D1, 0x200D, 0x1F9D1, 0x27A1, 0x27A1,
+    0x27A1, 0x1F48B, 0x1F9D1, 0x200D, 0x1F9D1, 0x27A1, 0x27A1, 0x27A1,
+    0x1F48B, 0x1F9D1, 0x200D, 0x1F9D1, 0x27A1, 0x27A1, 0x27A1, 0x1F48B,
+    0x1F9D1, 0x200D, 0x1F9D1, 0x27A1, 0x27A1, 0x27A1, 0x1F48B, 0x1F9D1,
+    0x200D, 0x1F9D1, 0x27A1, 0x27A1, 0x27A1, 0xFE0F, 0xFE0F, 0xFE0F,
+    0x27A1, 0xFE0F, 0x27A1, 0xFE0F, 0x27A1, 0xFE0F, 0x27A1, 0xFE0F,
+    0x27A1, 0xFE0F, 0x27A1, 0xFE0F, 0x27A1, 0xFE0F, 0x27A1, 0xFE0F,
+    0x27A1, 0xFE0F, 0x27A1, 0xE007F, 0xE007F, 0xE007F, 0x1F468, 0x200D,
+    0x1F466, 0x1F466, 0x1F467, 0x1F466, 0x1F466, 0x1F467, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F468, 0x1F48B, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0xFE0F, 0xFE0F, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x200D, 0x1F468, 0x1F48B, 0x1F3FB, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0xFE0F, 0xFE0F, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x200D, 0x1F468, 0x1F48B, 0x1F3FB, 0x1F3FC, 0x1F3FE, 0x1F3FF,
+    0xFE0F, 0xFE0F, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x200D, 0x1F468, 0x1F48B, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FF, 0xFE0F,
+    0xFE0F, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D,
+    0x1F468, 0x1F48B, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0xFE0F, 0xFE0F,
+    0xFE0F, 0x1F468, 0x1F469, 0x200D, 0x1F466, 0x1F466, 0x1F467, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x200D, 0x1F468, 0x1F469, 0x1F48B, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0xFE0F, 0xFE0F, 0xFE0F,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x200D, 0x1F468, 0x1F469, 0x1F48B, 0x1F3FB, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0xFE0F, 0xFE0F,
+    0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F468, 0x1F469, 0x1F48B, 0x1F3FB,
+    0x1F3FC, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FE, 0x1F3FF, 0xFE0F,
+    0xFE0F, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F468, 0x1F469, 0x1F48B,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FF,
+    0xFE0F, 0xFE0F, 0xFE0F, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F468, 0x1F469,
+    0x1F48B, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0x27A1,
+    0xFE0F, 0x27A1, 0xFE0F, 0x27A1, 0xFE0F, 0x27A1, 0xFE0F, 0x27A1,
+    0xFE0F, 0x27A1, 0xFE0F, 0x27A1, 0xFE0F, 0x27A1, 0xFE0F, 0x27A1,
+    0xFE0F, 0x27A1, 0xFE0F, 0xFE0F, 0xFE0F, 0x27A1, 0xFE0F, 0x27A1,
+    0xFE0F, 0x27A1, 0xFE0F, 0x27A1, 0xFE0F, 0x27A1, 0xFE0F, 0x27A1,
+    0xFE0F, 0x27A1, 0xFE0F, 0x27A1, 0xFE0F, 0x27A1, 0xFE0F, 0x27A1,
+    0x1F9D2, 0x200D, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F48B, 0x1F9D1,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0xFE0F, 0xFE0F, 0xFE0F,
+    0x200D, 0x1F3FB, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F48B, 0x1F9D1, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0xFE0F, 0xFE0F, 0xFE0F, 0x200D,
+    0x1F3FB, 0x1F3FC, 0x1F3FE, 0x1F3FF, 0x1F48B, 0x1F9D1, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0xFE0F, 0xFE0F, 0xFE0F, 0x200D, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FF, 0x1F48B, 0x1F9D1, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0xFE0F, 0xFE0F, 0xFE0F, 0x200D, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F48B, 0x1F9D1, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0x1F468, 0x1F468,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F468, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F468, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F468, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x200D, 0x1F468, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x200D, 0x1F468, 0x1F469, 0x1F468, 0x1F469, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x200D, 0x1F468, 0x1F469, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0x1F468, 0x1F469,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x200D, 0x1F468, 0x1F469, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D,
+    0x1F468, 0x1F469, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x200D, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F, 0xFE0F,
+    0xFE0F, 0x1F9D1, 0x200D, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F9D1,
+    0x200D, 0x1F3FB, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F9D1, 0x200D, 0x1F3FB,
+    0x1F3FC, 0x1F3FE, 0x1F3FF, 0x1F9D1, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FF, 0x1F9D1, 0x200D, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F468, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F468, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F468, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F468, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F468, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F468,
+    0x1F469, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F468, 0x1F469, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F468,
+    0x1F469, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F468, 0x1F469, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F468,
+    0x1F469, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F9D1, 0x1F3FB, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F9D1, 0x1F3FB, 0x1F3FC, 0x1F3FE, 0x1F3FF, 0x1F9D1,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FF, 0x1F9D1, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F9D1, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB,
+    0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC,
+    0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF,
+    0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FC, 0x1F3FD, 0x1F3FE,
+    0x1F3FF, 0x1F3FB, 0x1F3FD, 0x1F3FE, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FE,
+    0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FF, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE
+};
+
+constexpr bool EMOJI_CODE_POINT_TRIE_TERMINAL[] = {
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, true, true, false, false, true, true, true, true, false,
+    false, false, true, false, false, true, false, false, false, false, false, false,
+    false, false, false, false, true, true, false, false, false, false, false, false,
+    false, true, true, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, false, false, false, false, false, false, false,
+    false, true, false, true, false, false, false, false, false, false, false, false,
+    true, false, true, true, false, false, true, true, true, true, false, true,
+    false, false, false, true, false, true, false, false, true, true, false, true,
+    false, false, false, true, true, false, true, false, false, true, true, false,
+    false, false, false, false, false, false, false, true, false, false, false, false,
+    true, true, true, true, true, true, false, false, true, true, true, false,
+    true, true, false, false, false, false, false, true, true, true, true, false,
+    false, false, false, true, true, false, false, false, false, true, true, true,
+    true, true, true, true, true, true, true, true, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, true, false,
+    true, true, true, true, true, true, true, false, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, false,
+    false, false, false, false, false, false, false, false, true, true, true, true,
+    true, true, true, true, true, false, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, false, false, false, false, false, false, false, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, false, false, false, false, true, true, true,
+    true, true, false, false, false, false, false, false, false, false, false, false,
+    false, false, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, false, true, false, false, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, false, true, false, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, false, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, false, false, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, false, false, false, false, false, false, false, false, false, true, false,
+    false, false, false, false, false, true, true, true, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, false, true, false, false, false, true, true, true, true,
+    true, true, true, true, true, true, false, false, false, false, false, false,
+    false, true, true, false, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, false, false, false, false, false,
+    false, false, false, false, false, false, false, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, false, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, false,
+    true, true, true, true, true, false, true, true, true, true, true, true,
+    true, true, true, true, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, false, false, true, true, false, false, false, false, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, true, true, true, true, true, false, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, false, true, true, true, true, true, false,
+    false, true, true, true, true, true, false, true, true, true, true, true,
+    true, true, true, true, true, false, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, false, true, true, true, true, true,
+    false, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, false, true, true, true, true, true, false, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, false, false, false, false, false, true, true, true, true,
+    true, false, true, true, true, true, true, false, true, true, true, true,
+    true, false, true, true, true, true, true, true, true, true, true, true,
+    false, true, true, true, true, true, false, true, true, true, true, true,
+    true, true, true, true, true, false, true, true, true, true, true, false,
+    true, true, true, true, true, false, true, true, true, true, true, false,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, false, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, false, true, true, true, true, true, true, true, true, true, true,
+    false, true, true, true, true, true, false, true, true, true, true, true,
+    false, true, true, true, true, true, false, false, true, true, true, true,
+    true, false, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, true,
+    true, true, true, true, false, true, true, true, true, true, true, true,
+    true, true, true, false, true, true, true, true, true, false, true, true,
+    true, true, true, false, true, true, true, true, true, false, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, false, true, true, true, true, true, true, true, true, true, true,
+    false, true, true, true, true, true, false, true, true, true, true, true,
+    false, true, true, true, true, true, false, true, true, true, true, true,
+    false, true, true, true, true, true, false, true, true, true, true, true,
+    false, true, true, true, true, true, false, true, true, true, true, true,
+    false, false, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, false, false, false, false, false, false, false, true, true,
+    true, true, true, false, false, false, false, false, true, true, false, false,
+    false, false, false, true, true, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, true,
+    false, true, true, true, true, true, false, true, true, true, false, true,
+    true, true, true, true, true, true, true, true, true, false, false, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    false, false, false, false, false, true, true, true, false, true, true, true,
+    true, true, true, true, true, true, true, false, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, false, false, false,
+    false, false, true, true, false, false, false, false, false, true, true, true,
+    true, false, false, false, false, false, true, true, false, false, false, false,
+    false, true, true, false, false, false, false, false, true, true, false, false,
+    false, false, false, true, true, false, false, false, false, false, true, true,
+    false, false, false, false, false, true, true, false, false, false, false, false,
+    true, true, false, false, false, false, false, false, false, false, false, false,
+    false, true, true, true, true, true, true, true, false, false, false, false,
+    false, true, true, false, false, false, false, false, true, true, false, false,
+    false, false, false, true, true, false, false, false, false, false, true, true,
+    false, false, false, false, false, true, true, false, false, false, false, false,
+    true, true, false, false, false, false, false, true, true, false, false, false,
+    false, false, true, true, false, false, false, false, false, true, true, true,
+    false, false, false, false, false, true, true, false, false, false, false, false,
+    true, true, false, false, false, false, false, true, true, false, false, false,
+    false, false, true, true, false, false, false, false, false, true, true, false,
+    false, false, false, false, true, true, true, true, false, false, false, false,
+    false, true, true, false, false, false, false, false, true, true, false, false,
+    false, false, false, true, true, false, false, false, false, false, true, true,
+    false, false, false, false, false, true, true, true, false, false, false, false,
+    false, true, true, false, false, false, false, false, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, true, true, true, true, true, true, true, false, true,
+    false, false, false, false, false, true, true, false, false, false, false, false,
+    true, true, false, false, false, false, false, true, true, false, false, false,
+    false, false, true, true, false, false, false, false, false, true, true, false,
+    false, false, false, false, true, true, false, false, false, false, false, true,
+    true, false, false, false, false, false, true, true, false, false, false, false,
+    false, true, true, false, false, false, false, false, true, true, true, true,
+    false, false, false, false, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, false, true, false, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, false, false, false, true, true,
+    true, true, true, false, false, false, false, false, false, false, false, false,
+    true, true, true, false, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, false, true, true, true, true, true,
+    true, true, true, true, true, false, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, false, true, true, true,
+    true, true, true, true, true, true, true, false, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, true,
+    true, true, true, true, true, true, true, true, true, false, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    false, true, true, true, true, true, true, true, true, true, true, false,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, true, true, true, true, true, true, true, true, true,
+    true, false, false, false, false, false, false, false, false, true, true, true,
+    false, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, false, true, true, true, true, true, true, true, true,
+    true, true, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, false, true, true, true, true, true, true,
+    true, true, true, true, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, false, true, true, true, true,
+    true, true, true, true, true, true, false, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, false, true, true,
+    true, true, true, true, true, true, true, true, false, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, false,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    false, true, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, true,
+    false, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, false, false, false,
+    false, false, false, true, true, true, false, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, true,
+    true, true, true, true, true, true, true, true, true, false, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, false, true, true, true, true, true, true, true, true, true, true,
+    false, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, false, true, true, true, true, true, true, true,
+    true, true, true, false, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, false, true, true, true, true,
+    true, true, true, true, true, true, false, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, false,
+    false, false, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, false, true, false, false, true, false, true, true,
+    false, true, false, true, true, false, true, false, true, true, false, true,
+    false, true, true, false, true, false, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, false, false, false, true, true, false, false,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, false, false, false, false, false, false, true, true, true, false, false,
+    false, false, false, false, true, true, true, false, false, false, false, false,
+    false, true, true, true, false, false, false, false, false, false, true, true,
+    true, false, false, false, false, false, false, true, true, false, false, true,
+    true, true, true, true, true, true, true, true, true, true, false, false,
+    false, false, false, false, true, true, true, false, false, false, false, false,
+    false, true, true, true, false, false, false, false, false, false, true, true,
+    true, false, false, false, false, false, false, true, true, true, false, false,
+    false, false, false, false, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, false, true, false, false, true, false, true,
+    true, false, true, false, true, true, false, true, false, true, true, false,
+    true, false, true, true, false, true, false, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, true, false, false, true, false, true, true, false, true,
+    false, true, true, false, true, false, true, true, false, true, false, true,
+    true, false, true, false, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, false, false, false, false, false, false, true, true, true, false, false,
+    false, false, false, false, true, true, true, false, false, false, false, false,
+    false, true, true, true, false, false, false, false, false, false, true, true,
+    true, false, false, false, false, false, false, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, true, false, true, false, true, false, true, false, true,
+    false, true, false, true, false, true, false, true, false, false, false, false,
+    false, true, false, false, false, false, false, true, true, true, false, false,
+    false, false, true, true, true, false, false, false, false, true, true, true,
+    false, false, false, false, true, true, true, false, false, false, false, true,
+    true, true, false, false, false, false, true, true, true, false, true, true,
+    false, false, false, true, true, true, false, false, false, false, false, false,
+    true, true, true, false, false, false, false, false, false, true, true, true,
+    false, false, false, false, false, false, true, true, true, false, false, false,
+    false, false, false, true, true, true, false, false, false, false, false, false,
+    true, true, true, true, true, true, true, true, false, true, false, true,
+    false, true, false, true, false, true, false, true, false, true, false, true,
+    false, true, false, true, true, true, true, true, false, true, false, true,
+    false, true, false, true, false, true, false, true, false, true, false, true,
+    false, true, false, true, true, true, false, false, false, false, false, true,
+    true, true, false, false, false, false, true, true, true, false, false, false,
+    false, true, true, true, false, false, false, false, true, true, true, false,
+    false, false, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, false, true, true, true,
+    true, true, true, true, true, true, true, true, false, false, false, true,
+    true, true, true, true, true, true, true, true, true, true, true, false,
+    false, false, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, false, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, false, false, false, true, true, true, true,
+    true, true, true, true, true, true, true, true, false, false, false, true,
+    true, true, true, true, true, true, true, true, false, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, false,
+    false, false, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, false,
+    false, false, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    false, false, false, false, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, false, false, false, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, false, false, false, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, true, true, true, true, false, false, true, true, true,
+    true, true, true, true, true, false, true, true, true, true, false, false,
+    true, true, true, true, true, true, true, true, false, true, true, true,
+    true, false, false, true, true, true, true, true, true, true, true, false,
+    true, true, true, true, false, false, true, true, true, true, true, true,
+    true, true, false, true, true, true, true, false, false, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, false, true, true, true, true, true, false, false,
+    true, true, true, true, true, false, false, true, true, true, true, true,
+    false, false, true, true, true, true, true, false, false, true, true, true,
+    true, true, false, true, true, false, false, true, true, true, true, true,
+    true, true, true, true, true, false, false, false, true, true, true, true,
+    true, true, true, true, true, true, false, false, false, true, true, true,
+    true, true, true, true, true, true, true, false, false, false, true, true,
+    true, true, true, true, true, true, true, true, false, false, false, true,
+    true, true, true, true, true, true, true, true, true, false, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, false, false, true, true, true, true,
+    false, false, true, true, true, true, false, false, true, true, true, true,
+    false, false, true, true, true, true, false, false, true, true, true, true,
+    true, true, true, true, true, false, true, true, true, true, true, false,
+    true, true, true, true, true, false, true, true, true, true, true, false,
+    true, true, true, true, true, false, true, true, true, true, true, true,
+    true, true, true, true, false, false, true, true, true, true, true, true,
+    true, true, true, true, false, false, true, true, true, true, true, true,
+    true, true, true, true, false, false, true, true, true, true, true, true,
+    true, true, true, true, false, false, true, true, true, true, true, true,
+    true, true, true, true, false, false, true, true, true, true, false, true,
+    true, true, true, false, true, true, true, true, false, true, true, true,
+    true, false, true, true, true, true, false, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true
+};
+
+constexpr uint16_t EMOJI_BYTE_TRIE_EDGE_OFFSETS[] = {
+    0, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+    27, 28, 30, 49, 51, 52, 53, 54, 55, 56, 57, 58,
+    59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 70, 78,
+    81, 96, 97, 100, 105, 126, 149, 167, 188, 205, 215, 221,
+    223, 228, 230, 232, 234, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+    284, 285, 286, 287, 288, 289, 290, 291, 291, 291, 292, 293,
+    293, 293, 293, 293, 294, 295, 296, 296, 297, 298, 298, 299,
+    300, 301, 302, 303, 304, 305, 306, 307, 308, 308, 308, 309,
+    310, 311, 312, 313, 314, 315, 315, 315, 316, 318, 319, 320,
+    321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 330, 330,
+    330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 331, 332,
+    333, 334, 335, 336, 337, 338, 338, 339, 339, 340, 341, 342,
+    343, 344, 345, 346, 347, 347, 348, 348, 348, 349, 350, 350,
+    350, 350, 350, 351, 351, 352, 353, 354, 354, 355, 355, 356,
+    357, 357, 357, 358, 358, 359, 360, 362, 362, 362, 363, 363,
+    364, 365, 366, 367, 369, 371, 372, 373, 374, 375, 376, 377,
+    377, 378, 379, 380, 381, 381, 381, 381, 381, 381, 381, 382,
+    383, 383, 383, 383, 384, 384, 384, 385, 386, 387, 388, 389,
+    389, 389, 389, 389, 390, 391, 392, 393, 394, 395, 399, 410,
+    436, 449, 451, 513, 577, 636, 692, 756, 820, 884, 947, 1009,
+    1049, 1063, 1083, 1147, 1163, 1227, 1268, 1281, 1332, 1395, 1455, 1519,
+    1532, 1591, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642,
+    1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654,
+    1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666,
+    1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678,
+    1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690,
+    1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702,
+    1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714,
+    1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726,
+    1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738,
+    1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750,
+    1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1761,
+    1761, 1762, 1763, 1764, 1765, 1765, 1765, 1765, 1765, 1765, 1765, 1765,
+    1765, 1765, 1765, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773,
+    1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785,
+    1786, 1787, 1788, 1789, 1790, 1791, 1791, 1792, 1792, 1792, 1792, 1792,
+    1792, 1792, 1792, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793,
+    1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793,
+    1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793,
+    1793, 1793, 1793, 1793, 1793, 1793, 1794, 1795, 1796, 1797, 1798, 1799,
+    1800, 1801, 1802, 1803, 1803, 1803, 1803, 1803, 1803, 1803, 1803, 1803,
+    1803, 1804, 1804, 1804, 1804, 1804, 1804, 1804, 1804, 1804, 1804, 1804,
+    1804, 1804, 1804, 1805, 1805, 1805, 1805, 1805, 1805, 1805, 1806, 1806,
+    1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806,
+    1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806,
+    1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806,
+    1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806,
+    1807, 1807, 1807, 1807, 1807, 1807, 1807, 1807, 1808, 1808, 1808, 1808,
+    1808, 1808, 1808, 1808, 1808, 1808, 1808, 1808, 1808, 1808, 1808, 1809,
+    1810, 1811, 1812, 1813, 1814, 1815, 1815, 1815, 1815, 1815, 1815, 1815,
+    1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815,
+    1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815,
+    1815, 1815, 1815, 1815, 1816, 1818, 1820, 1820, 1820, 1821, 1821, 1821,
+    1823, 1825, 1827, 1828, 1829, 1829, 1829, 1829, 1829, 1829, 1830, 1831,
+    1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1841, 1841,
+    1841, 1841, 1841, 1841, 1841, 1841, 1841, 1841, 1841, 1841, 1841, 1841,
+    1841, 1841, 1841, 1842, 1844, 1845, 1846, 1846, 1846, 1846, 1846, 1846,
+    1846, 1846, 1846, 1846, 1846, 1846, 1847, 1847, 1847, 1847, 1847, 1847,
+    1847, 1847, 1847, 1847, 1847, 1847, 1847, 1848, 1848, 1848, 1848, 1848,
+    1848, 1848, 1848, 1848, 1848, 1848, 1848, 1848, 1848, 1848, 1848, 1848,
+    1849, 1849, 1849, 1849, 1849, 1849, 1849, 1849, 1849, 1849, 1849, 1849,
+    1849, 1849, 1849, 1849, 1849, 1849, 1849, 1849, 1849, 1850, 1850, 1850,
+    1850, 1851, 1851, 1852, 1853, 1854, 1854, 1854, 1855, 1856, 1857, 1858,
+    1859, 1860, 1861, 1862, 1863, 1864, 1865, 1865, 1865, 1865, 1865, 1865,
+    1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865,
+    1865, 1865, 1865, 1865, 1866, 1867, 1869, 1871, 1871, 1872, 1873, 1874,
+    1876, 1877, 1879, 1881, 1882, 1884, 1885, 1886, 1887, 1889, 1890, 1890,
+    1890, 1890, 1891, 1891, 1891, 1891, 1891, 1893, 1895, 1896, 1896, 1897,
+    1899, 1901, 1901, 1901, 1901, 1901, 1901, 1901, 1901, 1902, 1902, 1903,
+    1903, 1903, 1903, 1903, 1903, 1903, 1903, 1903, 1903, 1903, 1903, 1903,
+    1903, 1903, 1903, 1903, 1903, 1903, 1903, 1903, 1903, 1903, 1903, 1903,
+    1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+    1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+    1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+    1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+    1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+    1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904,
+    1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1904, 1905,
+    1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905,
+    1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905,
+    1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905,
+    1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905,
+    1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905, 1905,
+    1905, 1905, 1905, 1906, 1907, 1907, 1907, 1907, 1907, 1907, 1907, 1907,
+    1907, 1907, 1907, 1907, 1907, 1907, 1907, 1907, 1907, 1907, 1907, 1907,
+    1907, 1907, 1907, 1907, 1907, 1907, 1907, 1907, 1907, 1908, 1909, 1910,
+    1912, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924,
+    1926, 1927, 1928, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936,
+    1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948,
+    1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948,
+    1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948,
+    1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948,
+    1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948,
+    1948, 1948, 1948, 1949, 1949, 1949, 1949, 1949, 1949, 1949, 1950, 1951,
+    1951, 1951, 1951, 1951, 1951, 1951, 1951, 1951, 1951, 1951, 1951, 1952,
+    1952, 1952, 1954, 1956, 1958, 1958, 1958, 1958, 1960, 1961, 1963, 1965,
+    1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966,
+    1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966,
+    1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966,
+    1968, 1968, 1968, 1968, 1968, 1968, 1968, 1968, 1968, 1968, 1968, 1968,
+    1968, 1968, 1968, 1968, 1968, 1970, 1972, 1974, 1974, 1974, 1974, 1974,
+    1974, 1974, 1974, 1974, 1974, 1975, 1975, 1975, 1975, 1975, 1975, 1976,
+    1977, 1978, 1979, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980,
+    1980, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1987, 1987, 1988,
+    1989, 1989, 1989, 1989, 1989, 1989, 1989, 1989, 1989, 1989, 1989, 1989,
+    1989, 1989, 1989, 1989, 1989, 1989, 1989, 1989, 1989, 1989, 1989, 1990,
+    1990, 1990, 1991, 1991, 1991, 1991, 1991, 1991, 1991, 1991, 1991, 1992,
+    1993, 1994, 1995, 1996, 1997, 1998, 1999, 1999, 1999, 1999, 1999, 1999,
+    1999, 2001, 2001, 2001, 2001, 2001, 2001, 2001, 2001, 2001, 2001, 2002,
+    2003, 2004, 2005, 2006, 2008, 2009, 2011, 2013, 2015, 2015, 2016, 2018,
+    2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020,
+    2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020,
+    2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020,
+    2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020,
+    2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2021, 2021, 2021, 2021,
+    2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021,
+    2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021,
+    2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021,
+    2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021,
+    2021, 2021, 2021, 2021, 2021, 2021, 2022, 2023, 2023, 2025, 2027, 2027,
+    2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028,
+    2028, 2028, 2028, 2028, 2028, 2028, 2030, 2032, 2034, 2034, 2036, 2037,
+    2038, 2040, 2041, 2043, 2045, 2047, 2049, 2051, 2053, 2055, 2057, 2058,
+    2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059,
+    2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059,
+    2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059,
+    2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059,
+    2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059,
+    2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059,
+    2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059,
+    2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059,
+    2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059,
+    2060, 2061, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062,
+    2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062,
+    2062, 2062, 2062, 2062, 2062, 2062, 2063, 2064, 2065, 2066, 2067, 2068,
+    2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080,
+    2081, 2082, 2083, 2083, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090,
+    2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102,
+    2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114,
+    2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126,
+    2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138,
+    2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150,
+    2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162,
+    2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174,
+    2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186,
+    2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198,
+    2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210,
+    2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222,
+    2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234,
+    2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246,
+    2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258,
+    2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270,
+    2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282,
+    2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294,
+    2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306,
+    2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318,
+    2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330,
+    2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342,
+    2343, 2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354,
+    2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366,
+    2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378,
+    2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390,
+    2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2400, 2401, 2402,
+    2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414,
+    2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426,
+    2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438,
+    2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450,
+    2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462,
+    2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474,
+    2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486,
+    2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498,
+    2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510,
+    2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2519, 2519, 2519,
+    2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519,
+    2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519,
+    2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2524,
+    2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524,
+    2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524,
+    2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2525,
+    2525, 2525, 2525, 2525, 2525, 2525, 2526, 2531, 2531, 2531, 2531, 2536,
+    2541, 2541, 2546, 2546, 2551, 2551, 2551, 2551, 2551, 2551, 2551, 2551,
+    2551, 2551, 2551, 2551, 2552, 2552, 2552, 2552, 2552, 2552, 2552, 2552,
+    2552, 2552, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561,
+    2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573,
+    2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585,
+    2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597,
+    2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609,
+    2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621,
+    2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633,
+    2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645,
+    2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657,
+    2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669,
+    2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681,
+    2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693,
+    2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705,
+    2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717,
+    2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729,
+    2730, 2731, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741,
+    2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753,
+    2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765,
+    2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777,
+    2778, 2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789,
+    2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801,
+    2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813,
+    2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825,
+    2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837,
+    2838, 2839, 2840, 2841, 2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849,
+    2850, 2851, 2852, 2853, 2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861,
+    2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862,
+    2862, 2862, 2862, 2862, 2862, 2862, 2863, 2864, 2865, 2866, 2867, 2868,
+    2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869,
+    2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2869, 2870, 2870, 2870,
+    2870, 2870, 2887, 2908, 2929, 2936, 2945, 2951, 2970, 2976, 2987, 2991,
+    3002, 3013, 3036, 3048, 3049, 3063, 3064, 3069, 3090, 3107, 3114, 3121,
+    3123, 3124, 3126, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129, 3129,
+    3129, 3129, 3129, 3129, 3129, 3130, 3131, 3131, 3136, 3136, 3136, 3136,
+    3136, 3136, 3136, 3136, 3141, 3142, 3147, 3148, 3153, 3158, 3159, 3164,
+    3165, 3170, 3171, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176,
+    3176, 3176, 3176, 3176, 3176, 3176, 3177, 3178, 3179, 3179, 3179, 3180,
+    3181, 3183, 3184, 3184, 3185, 3190, 3195, 3200, 3205, 3210, 3215, 3220,
+    3225, 3230, 3235, 3240, 3245, 3250, 3255, 3260, 3262, 3267, 3269, 3274,
+    3279, 3284, 3289, 3290, 3295, 3296, 3297, 3302, 3303, 3308, 3313, 3314,
+    3319, 3324, 3329, 3334, 3335, 3340, 3345, 3350, 3351, 3356, 3357, 3362,
+    3367, 3372, 3373, 3378, 3379, 3384, 3389, 3394, 3399, 3399, 3399, 3399,
+    3399, 3399, 3399, 3399, 3404, 3405, 3410, 3410, 3410, 3410, 3410, 3415,
+    3415, 3415, 3415, 3415, 3415, 3415, 3420, 3425, 3430, 3430, 3430, 3430,
+    3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430, 3430,
+    3430, 3430, 3430, 3430, 3430, 3431, 3432, 3433, 3434, 3435, 3440, 3441,
+    3446, 3447, 3452, 3453, 3458, 3463, 3464, 3469, 3470, 3475, 3480, 3481,
+    3486, 3487, 3492, 3493, 3498, 3499, 3504, 3509, 3509, 3514, 3514, 3514,
+    3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3514, 3519, 3524,
+    3529, 3534, 3539, 3544, 3549, 3554, 3559, 3564, 3565, 3570, 3575, 3580,
+    3585, 3590, 3595, 3596, 3601, 3606, 3607, 3612, 3613, 3618, 3619, 3624,
+    3625, 3626, 3631, 3632, 3637, 3642, 3647, 3652, 3653, 3658, 3659, 3664,
+    3669, 3670, 3675, 3676, 3681, 3682, 3687, 3689, 3694, 3699, 3704, 3705,
+    3710, 3715, 3716, 3721, 3722, 3727, 3728, 3733, 3734, 3739, 3740, 3745,
+    3746, 3751, 3752, 3757, 3758, 3763, 3764, 3765, 3770, 3775, 3780, 3785,
+    3790, 3795, 3800, 3805, 3810, 3815, 3820, 3825, 3826, 3827, 3828, 3829,
+    3830, 3831, 3832, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833,
+    3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3833, 3834,
+    3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3835, 3837,
+    3838, 3839, 3840, 3841, 3842, 3843, 3844, 3845, 3846, 3847, 3848, 3848,
+    3848, 3848, 3848, 3848, 3849, 3850, 3851, 3852, 3853, 3854, 3855, 3856,
+    3857, 3858, 3859, 3860, 3861, 3862, 3863, 3864, 3865, 3866, 3867, 3868,
+    3869, 3870, 3871, 3872, 3873, 3874, 3875, 3875, 3875, 3875, 3875, 3875,
+    3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875,
+    3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875,
+    3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875,
+    3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875,
+    3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875,
+    3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3875, 3878, 3879,
+    3880, 3881, 3882, 3883, 3884, 3887, 3888, 3889, 3890, 3891, 3892, 3893,
+    3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893, 3893,
+    3893, 3893, 3893, 3894, 3895, 3896, 3897, 3898, 3899, 3900, 3901, 3902,
+    3903, 3904, 3905, 3906, 3907, 3908, 3909, 3910, 3911, 3912, 3912, 3912,
+    3912, 3912, 3912, 3913, 3914, 3915, 3916, 3917, 3918, 3918, 3918, 3918,
+    3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918, 3918,
+    3919, 3920, 3921, 3922, 3923, 3924, 3924, 3924, 3924, 3924, 3924, 3924,
+    3924, 3924, 3924, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932,
+    3933, 3934, 3935, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936,
+    3936, 3936, 3937, 3938, 3939, 3940, 3941, 3942, 3943, 3944, 3945, 3946,
+    3947, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948,
+    3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3948, 3949, 3950,
+    3951, 3952, 3953, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954,
+    3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954, 3954,
+    3955, 3956, 3957, 3958, 3959, 3960, 3961, 3962, 3963, 3964, 3965, 3966,
+    3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978,
+    3979, 3980, 3981, 3982, 3982, 3982, 3982, 3982, 3982, 3983, 3984, 3985,
+    3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994, 3994, 3994, 3994,
+    3994, 3994, 3995, 3996, 3997, 3998, 3999, 4000, 4001, 4002, 4003, 4004,
+    4005, 4006, 4007, 4008, 4009, 4010, 4011, 4012, 4014, 4015, 4016, 4017,
+    4018, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019,
+    4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019,
+    4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019,
+    4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019,
+    4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019, 4019,
+    4019, 4019, 4020, 4021, 4022, 4023, 4024, 4025, 4025, 4025, 4025, 4025,
+    4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025,
+    4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4025, 4026, 4027, 4028,
+    4029, 4030, 4031, 4031, 4031, 4031, 4031, 4031, 4032, 4033, 4034, 4035,
+    4036, 4037, 4038, 4039, 4040, 4041, 4042, 4043, 4044, 4045, 4046, 4047,
+    4048, 4049, 4050, 4051, 4052, 4053, 4054, 4055, 4056, 4057, 4058, 4059,
+    4060, 4061, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062, 4062,
+    4062, 4062, 4062, 4062, 4062, 4062, 4063, 4064, 4065, 4066, 4067, 4068,
+    4069, 4070, 4071, 4072, 4073, 4074, 4074, 4074, 4074, 4074, 4074, 4075,
+    4076, 4077, 4078, 4079, 4080, 4082, 4083, 4084, 4085, 4086, 4087, 4088,
+    4089, 4090, 4091, 4092, 4093, 4095, 4096, 4097, 4098, 4099, 4100, 4101,
+    4101, 4101, 4101, 4101, 4101, 4101, 4101, 4101, 4101, 4101, 4102, 4103,
+    4104, 4105, 4106, 4107, 4107, 4107, 4107, 4107, 4107, 4108, 4109, 4110,
+    4111, 4112, 4113, 4114, 4115, 4116, 4117, 4118, 4119, 4120, 4121, 4122,
+    4123, 4124, 4125, 4126, 4127, 4128, 4129, 4130, 4131, 4132, 4133, 4134,
+    4135, 4136, 4137, 4138, 4139, 4140, 4141, 4142, 4143, 4144, 4145, 4146,
+    4147, 4148, 4149, 4150, 4151, 4152, 4153, 4154, 4155, 4156, 4157, 4157,
+    4157, 4157, 4157, 4157, 4157, 4157, 4157, 4157, 4157, 4157, 4157, 4157,
+    4157, 4157, 4157, 4157, 4157, 4157, 4157, 4158, 4159, 4160, 4161, 4162,
+    4162, 4162, 4162, 4162, 4162, 4162, 4162, 4162, 4162, 4162, 4162, 4162,
+    4162, 4162, 4162, 4162, 4162, 4162, 4162, 4162, 4162, 4162, 4162, 4162,
+    4162, 4162, 4162, 4162, 4162, 4162, 4162, 4162, 4162, 4162, 4162, 4163,
+    4164, 4165, 4166, 4167, 4168, 4169, 4170, 4171, 4172, 4174, 4175, 4176,
+    4177, 4178, 4179, 4180, 4182, 4183, 4184, 4185, 4186, 4187, 4189, 4190,
+    4191, 4192, 4193, 4194, 4195, 4196, 4197, 4198, 4199, 4200, 4201, 4202,
+    4203, 4204, 4205, 4206, 4207, 4208, 4209, 4210, 4211, 4212, 4213, 4214,
+    4215, 4217, 4218, 4219, 4228, 4229, 4230, 4231, 4232, 4233, 4235, 4236,
+    4237, 4246, 4247, 4248, 4249, 4250, 4251, 4253, 4254, 4255, 4256, 4257,
+    4258, 4260, 4262, 4263, 4264, 4265, 4266, 4267, 4269, 4270, 4271, 4272,
+    4273, 4274, 4276, 4277, 4278, 4279, 4280, 4281, 4283, 4284, 4285, 4286,
+    4287, 4288, 4290, 4291, 4292, 4293, 4294, 4295, 4297, 4298, 4299, 4300,
+    4301, 4302, 4304, 4305, 4306, 4307, 4308, 4309, 4311, 4312, 4313, 4314,
+    4315, 4316, 4317, 4318, 4319, 4320, 4321, 4322, 4323, 4324, 4325, 4327,
+    4329, 4330, 4331, 4332, 4333, 4334, 4336, 4337, 4338, 4339, 4340, 4341,
+    4343, 4344, 4345, 4346, 4347, 4348, 4350, 4351, 4352, 4353, 4354, 4355,
+    4357, 4358, 4359, 4360, 4361, 4362, 4364, 4365, 4366, 4367, 4368, 4369,
+    4371, 4372, 4373, 4374, 4375, 4376, 4378, 4379, 4380, 4381, 4382, 4383,
+    4385, 4386, 4387, 4388, 4389, 4390, 4392, 4393, 4394, 4395, 4396, 4397,
+    4398, 4400, 4401, 4402, 4403, 4404, 4405, 4407, 4408, 4409, 4410, 4411,
+    4412, 4414, 4415, 4416, 4417, 4418, 4419, 4421, 4422, 4423, 4424, 4425,
+    4426, 4428, 4429, 4430, 4431, 4432, 4433, 4435, 4437, 4438, 4439, 4440,
+    4441, 4442, 4444, 4445, 4446, 4447, 4448, 4449, 4451, 4452, 4453, 4454,
+    4455, 4456, 4458, 4459, 4460, 4461, 4462, 4463, 4465, 4466, 4467, 4468,
+    4469, 4470, 4472, 4473, 4474, 4475, 4476, 4477, 4478, 4480, 4481, 4482,
+    4483, 4484, 4485, 4487, 4488, 4498, 4499, 4500, 4501, 4502, 4503, 4505,
+    4506, 4507, 4508, 4509, 4510, 4512, 4513, 4514, 4515, 4516, 4517, 4519,
+    4520, 4521, 4522, 4523, 4524, 4526, 4527, 4528, 4529, 4530, 4531, 4533,
+    4534, 4535, 4536, 4537, 4538, 4540, 4541, 4542, 4543, 4544, 4545, 4547,
+    4548, 4549, 4550, 4551, 4552, 4554, 4555, 4556, 4557, 4558, 4559, 4561,
+    4562, 4563, 4564, 4565, 4566, 4568, 4570, 4571, 4572, 4573, 4574, 4575,
+    4576, 4577, 4578, 4579, 4580, 4581, 4582, 4583, 4584, 4585, 4587, 4589,
+    4590, 4591, 4592, 4593, 4594, 4595, 4596, 4597, 4598, 4599, 4600, 4601,
+    4602, 4603, 4604, 4605, 4606, 4607, 4608, 4609, 4610, 4611, 4612, 4613,
+    4614, 4615, 4616, 4617, 4618, 4619, 4620, 4621, 4623, 4624, 4625, 4625,
+    4626, 4626, 4627, 4628, 4629, 4630, 4631, 4632, 4634, 4635, 4637, 4640,
+    4642, 4646, 4648, 4650, 4652, 4659, 4660, 4661, 4662, 4663, 4664, 4665,
+    4666, 4667, 4669, 4670, 4672, 4675, 4677, 4680, 4682, 4684, 4686, 4693,
+    4694, 4695, 4696, 4697, 4698, 4699, 4700, 4701, 4702, 4703, 4704, 4705,
+    4706, 4707, 4708, 4709, 4710, 4711, 4712, 4713, 4714, 4715, 4716, 4717,
+    4718, 4719, 4720, 4721, 4722, 4723, 4724, 4725, 4726, 4727, 4728, 4729,
+    4730, 4731, 4732, 4733, 4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741,
+    4742, 4743, 4744, 4745, 4746, 4747, 4748, 4749, 4750, 4751, 4752, 4753,
+    4754, 4755, 4756, 4757, 4758, 4759, 4760, 4761, 4762, 4763, 4764, 4765,
+    4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774, 4775, 4776, 4777,
+    4778, 4779, 4780, 4781, 4782, 4783, 4784, 4785, 4786, 4787, 4788, 4789,
+    4790, 4791, 4792, 4793, 4794, 4795, 4796, 4797, 4798, 4799, 4800, 4801,
+    4802, 4803, 4804, 4805, 4806, 4807, 4808, 4809, 4810, 4811, 4812, 4813,
+    4814, 4815, 4816, 4817, 4818, 4819, 4820, 4821, 4822, 4823, 4824, 4825,
+    4826, 4827, 4828, 4829, 4830, 4831, 4832, 4833, 4834, 4835, 4836, 4837,
+    4839, 4841, 4842, 4843, 4844, 4845, 4846, 4847, 4848, 4849, 4850, 4851,
+    4852, 4853, 4854, 4855, 4856, 4857, 4858, 4859, 4860, 4861, 4862, 4863,
+    4864, 4865, 4866, 4867, 4868, 4869, 4870, 4871, 4872, 4873, 4874, 4875,
+    4876, 4877, 4878, 4879, 4880, 4881, 4882, 4883, 4884, 4885, 4886, 4887,
+    4888, 4889, 4890, 4891, 4892, 4893, 4894, 4895, 4896, 4897, 4898, 4899,
+    4900, 4901, 4902, 4903, 4904, 4905, 4906, 4907, 4908, 4909, 4910, 4911,
+    4912, 4913, 4914, 4915, 4916, 4917, 4918, 4919, 4921, 4923, 4924, 4925,
+    4926, 4927, 4928, 4929, 4930, 4931, 4932, 4933, 4934, 4935, 4936, 4937,
+    4938, 4939, 4940, 4942, 4946, 4948, 4950, 4952, 4954, 4955, 4962, 4964,
+    4965, 4966, 4967, 4968, 4969, 4970, 4971, 4972, 4973, 4974, 4975, 4976,
+    4977, 4978, 4979, 4980, 4981, 4982, 4983, 4984, 4985, 4986, 4987, 4988,
+    4989, 4990, 4991, 4992, 4993, 4994, 4995, 4996, 4997, 4998, 4999, 5000,
+    5001, 5002, 5003, 5004, 5005, 5006, 5007, 5008, 5009, 5010, 5011, 5012,
+    5013, 5014, 5015, 5016, 5017, 5018, 5019, 5020, 5021, 5022, 5023, 5024,
+    5025, 5026, 5027, 5028, 5029, 5030, 5031, 5032, 5033, 5034, 5035, 5036,
+    5037, 5038, 5039, 5040, 5041, 5042, 5044, 5045, 5046, 5047, 5048, 5049,
+    5051, 5051, 5051, 5052, 5053, 5054, 5055, 5056, 5057, 5058, 5059, 5060,
+    5061, 5062, 5063, 5064, 5065, 5066, 5067, 5068, 5069, 5070, 5071, 5072,
+    5073, 5074, 5075, 5076, 5077, 5078, 5079, 5080, 5081, 5082, 5083, 5084,
+    5085, 5086, 5087, 5088, 5089, 5090, 5091, 5091, 5091, 5092, 5093, 5094,
+    5095, 5096, 5097, 5098, 5098, 5098, 5098, 5098, 5098, 5098, 5098, 5098,
+    5099, 5100, 5101, 5102, 5102, 5102, 5102, 5102, 5102, 5102, 5103, 5103,
+    5103, 5103, 5103, 5104, 5105, 5107, 5109, 5111, 5113, 5115, 5116, 5117,
+    5118, 5119, 5120, 5120, 5120, 5120, 5120, 5120, 5120, 5120, 5120, 5121,
+    5122, 5123, 5123, 5123, 5123, 5123, 5123, 5123, 5124, 5124, 5124, 5124,
+    5124, 5125, 5126, 5128, 5130, 5132, 5134, 5136, 5137, 5138, 5139, 5140,
+    5141, 5142, 5143, 5144, 5145, 5146, 5147, 5148, 5149, 5150, 5151, 5152,
+    5153, 5154, 5155, 5156, 5157, 5158, 5159, 5160, 5161, 5162, 5163, 5164,
+    5165, 5166, 5167, 5168, 5169, 5170, 5171, 5172, 5173, 5174, 5175, 5176,
+    5177, 5178, 5179, 5180, 5181, 5182, 5183, 5184, 5185, 5186, 5187, 5188,
+    5189, 5190, 5191, 5192, 5193, 5194, 5195, 5196, 5197, 5198, 5199, 5200,
+    5201, 5202, 5203, 5204, 5205, 5206, 5207, 5207, 5207, 5208, 5209, 5210,
+    5211, 5212, 5213, 5214, 5215, 5216, 5217, 5218, 5219, 5220, 5221, 5222,
+    5223, 5224, 5225, 5226, 5227, 5228, 5229, 5230, 5231, 5232, 5233, 5234,
+    5235, 5236, 5237, 5238, 5239, 5240, 5241, 5242, 5243, 5244, 5245, 5246,
+    5247, 5248, 5249, 5250, 5251, 5252, 5253, 5254, 5255, 5256, 5257, 5258,
+    5259, 5260, 5261, 5262, 5263, 5264, 5265, 5266, 5267, 5268, 5269, 5270,
+    5271, 5272, 5273, 5274, 5275, 5276, 5277, 5278, 5279, 5280, 5281, 5282,
+    5283, 5284, 5285, 5286, 5287, 5288, 5289, 5290, 5291, 5292, 5293, 5294,
+    5295, 5296, 5297, 5298, 5299, 5300, 5301, 5302, 5303, 5304, 5305, 5306,
+    5307, 5308, 5309, 5310, 5311, 5312, 5313, 5314, 5315, 5316, 5317, 5318,
+    5319, 5320, 5321, 5322, 5323, 5324, 5325, 5326, 5327, 5328, 5329, 5330,
+    5331, 5332, 5333, 5334, 5335, 5336, 5337, 5338, 5339, 5340, 5341, 5342,
+    5343, 5344, 5345, 5346, 5347, 5348, 5349, 5350, 5351, 5352, 5353, 5354,
+    5355, 5356, 5357, 5358, 5359, 5360, 5361, 5362, 5363, 5364, 5365, 5366,
+    5367, 5368, 5369, 5370, 5371, 5372, 5373, 5374, 5375, 5375, 5375, 5375,
+    5375, 5375, 5375, 5375, 5375, 5375, 5375, 5375, 5375, 5375, 5375, 5375,
+    5376, 5377, 5377, 5377, 5377, 5377, 5378, 5379, 5380, 5381, 5383, 5385,
+    5387, 5389, 5391, 5392, 5393, 5394, 5395, 5396, 5397, 5398, 5399, 5400,
+    5401, 5402, 5403, 5404, 5405, 5406, 5407, 5408, 5409, 5410, 5411, 5412,
+    5413, 5414, 5415, 5416, 5417, 5418, 5419, 5420, 5421, 5422, 5423, 5424,
+    5425, 5426, 5427, 5428, 5429, 5430, 5431, 5432, 5433, 5434, 5435, 5436,
+    5437, 5438, 5439, 5440, 5441, 5442, 5443, 5444, 5445, 5446, 5447, 5448,
+    5449, 5450, 5451, 5452, 5453, 5454, 5455, 5456, 5457, 5458, 5459, 5460,
+    5461, 5462, 5463, 5464, 5465, 5466, 5468, 5470, 5472, 5474, 5476, 5477,
+    5478, 5479, 5480, 5481, 5482, 5483, 5485, 5487, 5489, 5491, 5493, 5494,
+    5495, 5496, 5497, 5498, 5499, 5500, 5501, 5502, 5503, 5504, 5505, 5506,
+    5507, 5509, 5510, 5511, 5512, 5513, 5514, 5516, 5517, 5518, 5519, 5520,
+    5521, 5522, 5523, 5524, 5525, 5526, 5527, 5528, 5529, 5530, 5531, 5532,
+    5533, 5534, 5535, 5536, 5537, 5538, 5539, 5542, 5543, 5546, 5547, 5550,
+    5551, 5554, 5555, 5558, 5559, 5560, 5561, 5562, 5563, 5564, 5565, 5566,
+    5567, 5568, 5569, 5570, 5573, 5574, 5577, 5578, 5581, 5582, 5585, 5586,
+    5589, 5590, 5591, 5592, 5593, 5594, 5595, 5596, 5597, 5598, 5599, 5600,
+    5601, 5602, 5603, 5604, 5605, 5606, 5607, 5608, 5609, 5610, 5611, 5612,
+    5613, 5614, 5615, 5616, 5617, 5618, 5619, 5620, 5621, 5622, 5623, 5624,
+    5625, 5626, 5627, 5628, 5629, 5630, 5631, 5632, 5633, 5634, 5635, 5636,
+    5637, 5638, 5639, 5640, 5641, 5642, 5643, 5644, 5645, 5646, 5647, 5648,
+    5649, 5650, 5651, 5652, 5653, 5654, 5655, 5657, 5658, 5659, 5660, 5661,
+    5662, 5663, 5664, 5665, 5666, 5667, 5668, 5669, 5670, 5671, 5672, 5673,
+    5674, 5675, 5676, 5677, 5678, 5679, 5680, 5681, 5682, 5683, 5684, 5685,
+    5686, 5687, 5688, 5689, 5690, 5691, 5692, 5693, 5694, 5695, 5696, 5697,
+    5698, 5699, 5700, 5701, 5702, 5703, 5704, 5705, 5706, 5707, 5708, 5709,
+    5710, 5711, 5712, 5713, 5714, 5715, 5716, 5717, 5718, 5719, 5720, 5721,
+    5722, 5723, 5724, 5725, 5726, 5727, 5728, 5729, 5730, 5731, 5732, 5733,
+    5735, 5737, 5739, 5741, 5743, 5744, 5745, 5746, 5747, 5748, 5749, 5750,
+    5751, 5752, 5753, 5754, 5755, 5756, 5757, 5758, 5759, 5760, 5761, 5762,
+    5763, 5764, 5765, 5766, 5767, 5768, 5769, 5770, 5771, 5772, 5773, 5774,
+    5775, 5776, 5777, 5778, 5779, 5780, 5781, 5782, 5783, 5784, 5785, 5786,
+    5787, 5788, 5789, 5790, 5791, 5792, 5793, 5794, 5795, 5796, 5797, 5798,
+    5799, 5800, 5801, 5802, 5803, 5804, 5805, 5806, 5807, 5808, 5809, 5810,
+    5811, 5812, 5813, 5814, 5815, 5816, 5817, 5818, 5819, 5820, 5822, 5824,
+    5826, 5828, 5830, 5831, 5832, 5833, 5834, 5835, 5836, 5837, 5838, 5839,
+    5840, 5841, 5842, 5843, 5844, 5845, 5846, 5849, 5850, 5853, 5854, 5857,
+    5858, 5861, 5862, 5865, 5866, 5867, 5868, 5869, 5870, 5871, 5872, 5873,
+    5874, 5875, 5876, 5877, 5878, 5879, 5880, 5881, 5882, 5883, 5884, 5885,
+    5886, 5887, 5888, 5889, 5890, 5891, 5892, 5893, 5894, 5895, 5896, 5897,
+    5898, 5899, 5900, 5901, 5902, 5903, 5904, 5905, 5906, 5907, 5908, 5909,
+    5910, 5911, 5912, 5913, 5914, 5915, 5916, 5917, 5918, 5919, 5920, 5921,
+    5922, 5923, 5924, 5925, 5926, 5927, 5928, 5929, 5930, 5931, 5932, 5933,
+    5934, 5935, 5936, 5937, 5938, 5938, 5939, 5940, 5941, 5942, 5943, 5944,
+    5945, 5946, 5947, 5948, 5949, 5950, 5950, 5950, 5951, 5952, 5953, 5954,
+    5954, 5956, 5957, 5959, 5960, 5962, 5963, 5965, 5966, 5968, 5969, 5969,
+    5969, 5971, 5973, 5975, 5977, 5979, 5979, 5979, 5981, 5983, 5985, 5987,
+    5989, 5990, 5991, 5993, 5995, 5997, 5999, 6001, 6002, 6003, 6005, 6007,
+    6009, 6011, 6013, 6014, 6015, 6015, 6016, 6016, 6017, 6017, 6017, 6017,
+    6018, 6019, 6020, 6021, 6022, 6023, 6024, 6025, 6026, 6028, 6029, 6030,
+    6039, 6041, 6042, 6043, 6052, 6054, 6055, 6056, 6065, 6067, 6068, 6069,
+    6078, 6080, 6081, 6082, 6091, 6091, 6091, 6091, 6092, 6093, 6094, 6095,
+    6096, 6097, 6098, 6099, 6101, 6102, 6103, 6112, 6114, 6115, 6116, 6125,
+    6127, 6128, 6129, 6138, 6140, 6141, 6142, 6151, 6153, 6154, 6155, 6164,
+    6164, 6164, 6166, 6168, 6170, 6172, 6174, 6174, 6174, 6174, 6174, 6176,
+    6178, 6180, 6182, 6184, 6184, 6184, 6186, 6188, 6190, 6192, 6194, 6194,
+    6194, 6196, 6198, 6200, 6202, 6204, 6204, 6204, 6206, 6208, 6210, 6212,
+    6214, 6214, 6214, 6216, 6218, 6220, 6222, 6224, 6224, 6224, 6226, 6228,
+    6230, 6232, 6234, 6234, 6234, 6236, 6238, 6240, 6242, 6244, 6244, 6244,
+    6246, 6248, 6250, 6252, 6254, 6255, 6256, 6258, 6260, 6262, 6264, 6266,
+    6267, 6267, 6267, 6267, 6267, 6269, 6271, 6273, 6275, 6277, 6277, 6277,
+    6279, 6281, 6283, 6285, 6287, 6287, 6287, 6289, 6291, 6293, 6295, 6297,
+    6297, 6297, 6299, 6301, 6303, 6305, 6307, 6307, 6307, 6309, 6311, 6313,
+    6315, 6317, 6317, 6317, 6319, 6321, 6323, 6325, 6327, 6327, 6327, 6329,
+    6331, 6333, 6335, 6337, 6337, 6337, 6339, 6341, 6343, 6345, 6347, 6347,
+    6347, 6349, 6351, 6353, 6355, 6357, 6358, 6359, 6360, 6361, 6361, 6363,
+    6364, 6366, 6367, 6369, 6370, 6372, 6373, 6375, 6376, 6376, 6376, 6378,
+    6380, 6382, 6384, 6386, 6386, 6386, 6388, 6390, 6392, 6394, 6396, 6396,
+    6396, 6398, 6400, 6402, 6404, 6406, 6406, 6406, 6408, 6410, 6412, 6414,
+    6416, 6416, 6416, 6418, 6420, 6422, 6424, 6426, 6426, 6426, 6426, 6426,
+    6428, 6430, 6432, 6434, 6436, 6436, 6436, 6438, 6440, 6442, 6444, 6446,
+    6446, 6446, 6448, 6450, 6452, 6454, 6456, 6456, 6456, 6458, 6460, 6462,
+    6464, 6466, 6466, 6466, 6468, 6470, 6472, 6474, 6476, 6477, 6478, 6479,
+    6480, 6480, 6482, 6483, 6485, 6486, 6488, 6489, 6491, 6492, 6494, 6495,
+    6495, 6495, 6497, 6499, 6501, 6503, 6505, 6505, 6505, 6505, 6506, 6507,
+    6508, 6509, 6510, 6511, 6513, 6514, 6515, 6524, 6526, 6527, 6528, 6537,
+    6539, 6540, 6541, 6550, 6552, 6553, 6554, 6563, 6565, 6566, 6567, 6576,
+    6576, 6576, 6578, 6580, 6582, 6584, 6586, 6586, 6586, 6588, 6590, 6592,
+    6594, 6596, 6596, 6596, 6598, 6600, 6602, 6604, 6606, 6606, 6606, 6608,
+    6610, 6612, 6614, 6616, 6616, 6616, 6618, 6620, 6622, 6624, 6626, 6626,
+    6626, 6628, 6630, 6632, 6634, 6636, 6636, 6636, 6638, 6640, 6642, 6644,
+    6646, 6646, 6646, 6648, 6650, 6652, 6654, 6656, 6656, 6656, 6658, 6660,
+    6662, 6664, 6666, 6666, 6666, 6666, 6666, 6667, 6668, 6669, 6670, 6671,
+    6672, 6673, 6674, 6675, 6676, 6677, 6678, 6679, 6680, 6681, 6682, 6683,
+    6684, 6685, 6686, 6687, 6689, 6691, 6692, 6694, 6696, 6697, 6699, 6701,
+    6702, 6704, 6706, 6707, 6709, 6711, 6712, 6713, 6714, 6715, 6716, 6717,
+    6718, 6719, 6720, 6721, 6722, 6723, 6724, 6725, 6726, 6727, 6728, 6729,
+    6730, 6731, 6732, 6733, 6734, 6735, 6736, 6737, 6738, 6739, 6740, 6741,
+    6742, 6743, 6744, 6745, 6746, 6747, 6748, 6749, 6750, 6751, 6752, 6753,
+    6754, 6755, 6756, 6757, 6757, 6758, 6759, 6760, 6761, 6762, 6763, 6764,
+    6765, 6766, 6767, 6768, 6769, 6770, 6771, 6773, 6774, 6776, 6779, 6781,
+    6783, 6785, 6787, 6788, 6795, 6796, 6797, 6798, 6800, 6801, 6803, 6806,
+    6808, 6810, 6812, 6814, 6815, 6822, 6823, 6824, 6825, 6827, 6828, 6830,
+    6833, 6835, 6837, 6839, 6841, 6842, 6849, 6850, 6851, 6852, 6854, 6855,
+    6857, 6860, 6862, 6864, 6866, 6868, 6869, 6876, 6877, 6878, 6879, 6881,
+    6882, 6884, 6887, 6889, 6891, 6893, 6895, 6896, 6903, 6904, 6905, 6906,
+    6907, 6908, 6909, 6910, 6911, 6912, 6913, 6914, 6916, 6917, 6919, 6922,
+    6924, 6926, 6928, 6930, 6931, 6938, 6939, 6940, 6941, 6943, 6944, 6946,
+    6949, 6951, 6953, 6955, 6957, 6958, 6965, 6966, 6967, 6968, 6970, 6971,
+    6973, 6976, 6978, 6980, 6982, 6984, 6985, 6992, 6993, 6994, 6995, 6997,
+    6998, 7000, 7003, 7005, 7007, 7009, 7011, 7012, 7019, 7020, 7021, 7022,
+    7024, 7025, 7027, 7030, 7032, 7034, 7036, 7038, 7039, 7046, 7047, 7048,
+    7049, 7050, 7051, 7052, 7053, 7054, 7055, 7056, 7057, 7058, 7059, 7060,
+    7061, 7062, 7063, 7064, 7065, 7066, 7067, 7068, 7069, 7070, 7071, 7072,
+    7073, 7074, 7075, 7076, 7077, 7078, 7079, 7080, 7081, 7082, 7083, 7084,
+    7085, 7086, 7087, 7088, 7089, 7090, 7091, 7092, 7093, 7094, 7095, 7096,
+    7097, 7098, 7099, 7100, 7101, 7102, 7103, 7104, 7105, 7106, 7107, 7108,
+    7109, 7110, 7111, 7112, 7113, 7114, 7115, 7116, 7117, 7118, 7119, 7120,
+    7121, 7122, 7123, 7124, 7125, 7126, 7127, 7128, 7129, 7130, 7131, 7132,
+    7133, 7134, 7135, 7136, 7137, 7138, 7139, 7140, 7141, 7142, 7143, 7144,
+    7145, 7146, 7147, 7148, 7148, 7149, 7150, 7151, 7152, 7153, 7154, 7155,
+    7156, 7157, 7158, 7159, 7160, 7161, 7162, 7163, 7164, 7165, 7166, 7167,
+    7168, 7169, 7170, 7171, 7172, 7173, 7174, 7175, 7176, 7177, 7178, 7179,
+    7180, 7181, 7182, 7183, 7184, 7185, 7186, 7187, 7188, 7189, 7190, 7191,
+    7192, 7193, 7194, 7195, 7196, 7197, 7198, 7199, 7200, 7201, 7202, 7203,
+    7204, 7205, 7206, 7207, 7208, 7209, 7210, 7211, 7212, 7213, 7214, 7215,
+    7216, 7217, 7218, 7219, 7220, 7221, 7222, 7223, 7224, 7225, 7226, 7227,
+    7228, 7229, 7230, 7231, 7232, 7233, 7234, 7235, 7236, 7237, 7238, 7239,
+    7240, 7241, 7242, 7244, 7246, 7247, 7249, 7251, 7252, 7254, 7256, 7257,
+    7259, 7261, 7262, 7264, 7266, 7267, 7268, 7269, 7270, 7271, 7272, 7273,
+    7274, 7275, 7276, 7277, 7278, 7279, 7280, 7281, 7282, 7283, 7284, 7285,
+    7286, 7287, 7288, 7289, 7290, 7291, 7292, 7293, 7294, 7295, 7296, 7297,
+    7298, 7299, 7300, 7301, 7302, 7303, 7304, 7305, 7306, 7307, 7308, 7309,
+    7310, 7311, 7312, 7313, 7314, 7315, 7316, 7317, 7318, 7319, 7320, 7321,
+    7322, 7323, 7324, 7325, 7326, 7327, 7328, 7329, 7330, 7331, 7332, 7333,
+    7334, 7335, 7336, 7337, 7338, 7339, 7340, 7341, 7342, 7343, 7344, 7345,
+    7346, 7347, 7348, 7349, 7350, 7351, 7352, 7353, 7354, 7355, 7356, 7357,
+    7358, 7359, 7360, 7361, 7362, 7363, 7364, 7365, 7366, 7367, 7368, 7369,
+    7370, 7371, 7373, 7375, 7376, 7378, 7380, 7381, 7383, 7385, 7386, 7388,
+    7390, 7391, 7393, 7395, 7396, 7397, 7398, 7399, 7400, 7401, 7402, 7403,
+    7404, 7405, 7406, 7407, 7408, 7409, 7410, 7411, 7412, 7413, 7414, 7415,
+    7417, 7418, 7420, 7424, 7426, 7428, 7430, 7432, 7433, 7440, 7441, 7442,
+    7443, 7445, 7446, 7448, 7452, 7454, 7456, 7458, 7460, 7461, 7468, 7469,
+    7470, 7471, 7473, 7474, 7476, 7480, 7482, 7484, 7486, 7488, 7489, 7496,
+    7497, 7498, 7499, 7501, 7502, 7504, 7508, 7510, 7512, 7514, 7516, 7517,
+    7524, 7525, 7526, 7527, 7529, 7530, 7532, 7536, 7538, 7540, 7542, 7544,
+    7545, 7552, 7553, 7554, 7555, 7556, 7557, 7558, 7559, 7560, 7561, 7562,
+    7563, 7564, 7565, 7566, 7567, 7568, 7569, 7570, 7571, 7572, 7573, 7574,
+    7575, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7586,
+    7587, 7588, 7589, 7590, 7591, 7592, 7593, 7594, 7595, 7596, 7597, 7598,
+    7599, 7600, 7601, 7602, 7603, 7604, 7605, 7606, 7607, 7608, 7609, 7610,
+    7611, 7612, 7613, 7614, 7615, 7616, 7617, 7618, 7619, 7620, 7621, 7622,
+    7623, 7624, 7625, 7626, 7627, 7628, 7629, 7630, 7631, 7632, 7633, 7634,
+    7635, 7636, 7637, 7638, 7639, 7640, 7641, 7642, 7643, 7644, 7645, 7646,
+    7647, 7647, 7647, 7648, 7649, 7650, 7651, 7652, 7653, 7654, 7655, 7656,
+    7657, 7658, 7659, 7660, 7661, 7662, 7663, 7664, 7665, 7666, 7667, 7668,
+    7669, 7670, 7671, 7672, 7673, 7674, 7675, 7676, 7677, 7678, 7679, 7680,
+    7681, 7682, 7683, 7684, 7685, 7686, 7687, 7688, 7689, 7690, 7691, 7692,
+    7693, 7694, 7695, 7696, 7697, 7698, 7699, 7700, 7701, 7702, 7703, 7704,
+    7705, 7706, 7707, 7708, 7709, 7710, 7711, 7712, 7713, 7714, 7715, 7716,
+    7717, 7718, 7719, 7720, 7721, 7722, 7723, 7724, 7725, 7726, 7727, 7728,
+    7729, 7730, 7731, 7734, 7735, 7737, 7738, 7739, 7740, 7741, 7742, 7743,
+    7744, 7745, 7746, 7747, 7748, 7749, 7750, 7750, 7750, 7750, 7750, 7750,
+    7750, 7750, 7750, 7750, 7750, 7750, 7750, 7750, 7750, 7751, 7752, 7752,
+    7752, 7752, 7752, 7753, 7754, 7755, 7756, 7757, 7758, 7759, 7759, 7759,
+    7759, 7759, 7759, 7759, 7759, 7759, 7759, 7759, 7759, 7759, 7759, 7759,
+    7760, 7761, 7761, 7761, 7761, 7761, 7762, 7763, 7764, 7765, 7766, 7767,
+    7768, 7768, 7768, 7768, 7768, 7768, 7768, 7768, 7768, 7768, 7768, 7768,
+    7768, 7768, 7768, 7769, 7770, 7770, 7770, 7770, 7770, 7771, 7772, 7773,
+    7774, 7775, 7776, 7777, 7777, 7777, 7777, 7777, 7777, 7777, 7777, 7777,
+    7777, 7777, 7777, 7777, 7777, 7777, 7778, 7779, 7779, 7779, 7779, 7779,
+    7780, 7781, 7782, 7783, 7784, 7785, 7786, 7786, 7786, 7786, 7786, 7786,
+    7786, 7786, 7786, 7786, 7786, 7786, 7786, 7786, 7786, 7787, 7788, 7788,
+    7788, 7788, 7788, 7789, 7790, 7792, 7793, 7794, 7795, 7796, 7797, 7798,
+    7799, 7800, 7801, 7802, 7803, 7804, 7804, 7804, 7804, 7804, 7804, 7804,
+    7804, 7804, 7804, 7804, 7804, 7804, 7804, 7804, 7805, 7806, 7806, 7806,
+    7806, 7806, 7807, 7808, 7809, 7810, 7811, 7812, 7813, 7813, 7813, 7813,
+    7813, 7813, 7813, 7813, 7813, 7813, 7813, 7813, 7813, 7813, 7813, 7814,
+    7815, 7815, 7815, 7815, 7815, 7816, 7817, 7818, 7819, 7820, 7821, 7822,
+    7822, 7822, 7822, 7822, 7822, 7822, 7822, 7822, 7822, 7822, 7822, 7822,
+    7822, 7822, 7823, 7824, 7824, 7824, 7824, 7824, 7825, 7826, 7827, 7828,
+    7829, 7830, 7831, 7831, 7831, 7831, 7831, 7831, 7831, 7831, 7831, 7831,
+    7831, 7831, 7831, 7831, 7831, 7832, 7833, 7833, 7833, 7833, 7833, 7834,
+    7835, 7836, 7837, 7838, 7839, 7840, 7840, 7840, 7840, 7840, 7840, 7840,
+    7840, 7840, 7840, 7840, 7840, 7840, 7840, 7840, 7841, 7842, 7842, 7842,
+    7842, 7842, 7843, 7844, 7845, 7846, 7847, 7848, 7849, 7850, 7851, 7852,
+    7853, 7854, 7855, 7856, 7857, 7858, 7859, 7860, 7861, 7862, 7863, 7864,
+    7865, 7866, 7867, 7868, 7869, 7870, 7871, 7872, 7873, 7874, 7875, 7876,
+    7877, 7878, 7879, 7880, 7881, 7882, 7883, 7884, 7885, 7886, 7887, 7888,
+    7889, 7890, 7891, 7892, 7893, 7894, 7895, 7896, 7897, 7898, 7899, 7900,
+    7901, 7902, 7903, 7904, 7905, 7906, 7907, 7908, 7909, 7910, 7911, 7912,
+    7913, 7914, 7915, 7916, 7917, 7918, 7919, 7920, 7921, 7922, 7923, 7924,
+    7925, 7926, 7927, 7928, 7929, 7930, 7931, 7932, 7933, 7934, 7935, 7936,
+    7937, 7938, 7939, 7940, 7941, 7942, 7943, 7944, 7945, 7946, 7947, 7948,
+    7949, 7950, 7951, 7952, 7953, 7954, 7955, 7956, 7957, 7958, 7959, 7960,
+    7961, 7962, 7963, 7964, 7965, 7966, 7967, 7968, 7969, 7970, 7971, 7972,
+    7973, 7974, 7975, 7976, 7977, 7978, 7979, 7980, 7981, 7982, 7983, 7984,
+    7985, 7986, 7987, 7988, 7989, 7990, 7991, 7992, 7993, 7994, 7995, 7996,
+    7997, 7998, 7999, 8000, 8001, 8002, 8003, 8004, 8005, 8006, 8007, 8008,
+    8009, 8010, 8011, 8012, 8013, 8014, 8015, 8016, 8017, 8018, 8019, 8020,
+    8021, 8022, 8023, 8024, 8025, 8026, 8027, 8028, 8029, 8030, 8031, 8032,
+    8033, 8034, 8035, 8036, 8037, 8038, 8039, 8040, 8041, 8042, 8043, 8044,
+    8045, 8046, 8047, 8048, 8049, 8050, 8051, 8052, 8053, 8054, 8055, 8056,
+    8057, 8058, 8059, 8060, 8061, 8062, 8063, 8064, 8065, 8066, 8067, 8068,
+    8069, 8070, 8071, 8072, 8073, 8074, 8075, 8076, 8077, 8078, 8079, 8080,
+    8081, 8082, 8083, 8084, 8085, 8086, 8087, 8088, 8089, 8090, 8091, 8092,
+    8093, 8094, 8095, 8096, 8097, 8098, 8099, 8100, 8101, 8102, 8103, 8104,
+    8105, 8106, 8107, 8108, 8109, 8110, 8111, 8112, 8113, 8114, 8115, 8116,
+    8117, 8118, 8119, 8120, 8121, 8122, 8123, 8124, 8125, 8126, 8127, 8128,
+    8129, 8130, 8131, 8132, 8133, 8134, 8135, 8136, 8137, 8138, 8139, 8140,
+    8141, 8142, 8143, 8144, 8145, 8146, 8147, 8148, 8149, 8150, 8151, 8152,
+    8153, 8154, 8155, 8156, 8157, 8158, 8159, 8160, 8161, 8162, 8163, 8164,
+    8165, 8166, 8167, 8168, 8169, 8170, 8171, 8172, 8173, 8174, 8175, 8176,
+    8177, 8178, 8179, 8180, 8181, 8182, 8183, 8184, 8185, 8186, 8187, 8188,
+    8189, 8190, 8191, 8192, 8193, 8194, 8195, 8196, 8197, 8198, 8199, 8200,
+    8201, 8202, 8203, 8204, 8205, 8206, 8207, 8208, 8209, 8210, 8211, 8212,
+    8213, 8214, 8215, 8215, 8215, 8215, 8215, 8215, 8215, 8215, 8215, 8215,
+    8215, 8215, 8215, 8215, 8215, 8215, 8216, 8217, 8217, 8217, 8217, 8217,
+    8218, 8219, 8220, 8221, 8222, 8223, 8224, 8224, 8224, 8224, 8224, 8224,
+    8224, 8224, 8224, 8224, 8224, 8224, 8224, 8224, 8224, 8224, 8225, 8226,
+    8226, 8226, 8226, 8226, 8227, 8228, 8229, 8230, 8231, 8232, 8233, 8233,
+    8233, 8233, 8233, 8233, 8233, 8233, 8233, 8233, 8233, 8233, 8233, 8233,
+    8233, 8233, 8234, 8235, 8235, 8235, 8235, 8235, 8236, 8237, 8238, 8239,
+    8240, 8241, 8242, 8242, 8242, 8242, 8242, 8242, 8242, 8242, 8242, 8242,
+    8242, 8242, 8242, 8242, 8242, 8242, 8243, 8244, 8244, 8244, 8244, 8244,
+    8245, 8246, 8247, 8248, 8249, 8250, 8251, 8251, 8251, 8251, 8251, 8251,
+    8251, 8251, 8251, 8251, 8251, 8251, 8251, 8251, 8251, 8251, 8252, 8253,
+    8253, 8253, 8253, 8253, 8254, 8255, 8256, 8257, 8258, 8259, 8260, 8261,
+    8262, 8263, 8264, 8265, 8266, 8267, 8268, 8269, 8270, 8271, 8272, 8273,
+    8274, 8275, 8276, 8277, 8278, 8279, 8280, 8281, 8282, 8283, 8284, 8285,
+    8286, 8287, 8288, 8289, 8290, 8291, 8292, 8293, 8294, 8295, 8296, 8297,
+    8298, 8299, 8300, 8301, 8302, 8303, 8304, 8305, 8306, 8307, 8308, 8309,
+    8310, 8311, 8312, 8313, 8314, 8315, 8316, 8317, 8318, 8319, 8320, 8321,
+    8322, 8323, 8324, 8325, 8326, 8327, 8328, 8329, 8330, 8331, 8332, 8333,
+    8334, 8335, 8336, 8337, 8338, 8339, 8340, 8341, 8342, 8343, 8344, 8345,
+    8346, 8347, 8348, 8349, 8350, 8350, 8350, 8350, 8350, 8350, 8350, 8350,
+    8350, 8350, 8350, 8351, 8352, 8353, 8354, 8355, 8356, 8357, 8358, 8359,
+    8360, 8361, 8362, 8363, 8364, 8365, 8366, 8367, 8368, 8369, 8370, 8371,
+    8372, 8373, 8374, 8375, 8376, 8377, 8378, 8379, 8380, 8381, 8382, 8383,
+    8384, 8385, 8386, 8387, 8388, 8389, 8390, 8391, 8392, 8393, 8394, 8395,
+    8396, 8397, 8398, 8399, 8399, 8399, 8400, 8401, 8402, 8403, 8404, 8405,
+    8406, 8407, 8408, 8409, 8409, 8409, 8410, 8411, 8412, 8413, 8414, 8415,
+    8416, 8417, 8418, 8419, 8419, 8420, 8421, 8422, 8423, 8424, 8425, 8426,
+    8427, 8428, 8429, 8430, 8431, 8432, 8433, 8434, 8435, 8436, 8437, 8438,
+    8439, 8440, 8441, 8442, 8443, 8444, 8445, 8446, 8447, 8448, 8449, 8450,
+    8451, 8452, 8453, 8454, 8455, 8456, 8457, 8458, 8459, 8460, 8461, 8462,
+    8463, 8464, 8465, 8466, 8467, 8468, 8469, 8470, 8471, 8472, 8473, 8474,
+    8475, 8476, 8477, 8478, 8480, 8481, 8482, 8483, 8484, 8485, 8486, 8487,
+    8488, 8489, 8490, 8491, 8492, 8493, 8494, 8495, 8496, 8497, 8498, 8499,
+    8500, 8501, 8502, 8503, 8504, 8505, 8506, 8507, 8508, 8509, 8510, 8511,
+    8512, 8513, 8514, 8515, 8516, 8517, 8518, 8519, 8520, 8521, 8522, 8523,
+    8524, 8525, 8526, 8527, 8528, 8529, 8530, 8531, 8532, 8533, 8534, 8535,
+    8536, 8537, 8538, 8539, 8540, 8541, 8542, 8543, 8544, 8545, 8546, 8547,
+    8548, 8549, 8550, 8551, 8552, 8553, 8554, 8555, 8556, 8557, 8558, 8559,
+    8560, 8561, 8562, 8563, 8564, 8565, 8566, 8567, 8568, 8569, 8570, 8571,
+    8572, 8573, 8574, 8575, 8576, 8577, 8578, 8579, 8580, 8581, 8582, 8583,
+    8584, 8585, 8586, 8587, 8588, 8589, 8590, 8591, 8592, 8593, 8594, 8595,
+    8596, 8597, 8598, 8599, 8600, 8601, 8602, 8603, 8604, 8605, 8606, 8607,
+    8608, 8609, 8610, 8611, 8612, 8613, 8614, 8615, 8616, 8617, 8618, 8619,
+    8620, 8621, 8622, 8623, 8623, 8623, 8624, 8625, 8626, 8627, 8628, 8629,
+    8630, 8631, 8632, 8633, 8634, 8635, 8636, 8637, 8638, 8639, 8640, 8641,
+    8642, 8643, 8644, 8645, 8646, 8647, 8648, 8649, 8650, 8651, 8652, 8653,
+    8654, 8655, 8656, 8657, 8658, 8659, 8660, 8661, 8662, 8663, 8664, 8665,
+    8666, 8667, 8668, 8669, 8670, 8671, 8672, 8673, 8674, 8675, 8676, 8677,
+    8678, 8679, 8680, 8681, 8682, 8683, 8684, 8685, 8686, 8687, 8688, 8689,
+    8690, 8691, 8692, 8693, 8694, 8695, 8696, 8697, 8698, 8699, 8700, 8701,
+    8702, 8703, 8704, 8705, 8706, 8707, 8708, 8709, 8710, 8711, 8712, 8713,
+    8714, 8715, 8716, 8717, 8718, 8719, 8720, 8721, 8722, 8723, 8724, 8725,
+    8726, 8727, 8728, 8729, 8730, 8731, 8732, 8733, 8734, 8735, 8736, 8737,
+    8738, 8739, 8740, 8741, 8742, 8743, 8744, 8745, 8746, 8747, 8748, 8749,
+    8750, 8751, 8752, 8753, 8754, 8755, 8756, 8757, 8758, 8759, 8760, 8761,
+    8762, 8763, 8764, 8765, 8766, 8767, 8768, 8769, 8770, 8771, 8772, 8773,
+    8774, 8775, 8776, 8777, 8778, 8779, 8780, 8781, 8782, 8783, 8784, 8785,
+    8786, 8787, 8788, 8789, 8790, 8791, 8792, 8793, 8794, 8795, 8796, 8797,
+    8798, 8799, 8800, 8801, 8802, 8803, 8804, 8805, 8806, 8807, 8808, 8809,
+    8810, 8811, 8812, 8813, 8814, 8815, 8816, 8817, 8818, 8819, 8820, 8821,
+    8822, 8823, 8824, 8825, 8826, 8827, 8828, 8829, 8830, 8831, 8832, 8833,
+    8834, 8835, 8836, 8837, 8838, 8839, 8840, 8841, 8842, 8843, 8844, 8845,
+    8846, 8847, 8848, 8849, 8850, 8851, 8852, 8853, 8854, 8855, 8856, 8857,
+    8858, 8859, 8860, 8861, 8862, 8863, 8864, 8865, 8866, 8867, 8868, 8869,
+    8870, 8871, 8872, 8873, 8874, 8875, 8876, 8877, 8878, 8879, 8880, 8881,
+    8882, 8883, 8884, 8885, 8886, 8887, 8888, 8889, 8890, 8891, 8892, 8893,
+    8894, 8895, 8896, 8897, 8898, 8899, 8900, 8901, 8902, 8903, 8904, 8905,
+    8906, 8907, 8908, 8909, 8910, 8911, 8912, 8913, 8914, 8915, 8916, 8917,
+    8918, 8919, 8920, 8921, 8922, 8923, 8924, 8925, 8926, 8927, 8928, 8929,
+    8930, 8931, 8932, 8933, 8934, 8935, 8936, 8937, 8938, 8939, 8940, 8941,
+    8942, 8943, 8944, 8945, 8946, 8947, 8948, 8949, 8950, 8951, 8952, 8953,
+    8954, 8955, 8956, 8957, 8958, 8959, 8960, 8961, 8962, 8963, 8964, 8965,
+    8966, 8967, 8968, 8969, 8970, 8971, 8972, 8973, 8974, 8975, 8976, 8977,
+    8978, 8979, 8980, 8981, 8982, 8983, 8984, 8985, 8986, 8987, 8988, 8989,
+    8990, 8991, 8992, 8993, 8994, 8995, 8996, 8997, 8998, 8999, 9000, 9001,
+    9002, 9003, 9004, 9005, 9006, 9007, 9008, 9009, 9010, 9011, 9012, 9013,
+    9014, 9015, 9016, 9017, 9018, 9019, 9020, 9021, 9022, 9023, 9024, 9025,
+    9026, 9027, 9028, 9029, 9030, 9031, 9032, 9033, 9034, 9035, 9036, 9037,
+    9038, 9039, 9040, 9041, 9042, 9043, 9044, 9045, 9045, 9046, 9047, 9048,
+    9049, 9049, 9050, 9051, 9052, 9053, 9053, 9054, 9055, 9056, 9057, 9057,
+    9058, 9059, 9060, 9061, 9061, 9061, 9061, 9061, 9061, 9061, 9061, 9061,
+    9061, 9061, 9061, 9061, 9061, 9061, 9061, 9061, 9061, 9061, 9061, 9061,
+    9061, 9061, 9061, 9061, 9061, 9061, 9061, 9061, 9061, 9061, 9061, 9061,
+    9061, 9061, 9061, 9061, 9061, 9061, 9061, 9061, 9061, 9062, 9063, 9064,
+    9064, 9064, 9065, 9066, 9067, 9069, 9071, 9073, 9074, 9075, 9076, 9076,
+    9076, 9076, 9077, 9078, 9079, 9080, 9081, 9082, 9082, 9082, 9082, 9083,
+    9084, 9085, 9086, 9087, 9088, 9088, 9088, 9088, 9089, 9090, 9091, 9092,
+    9093, 9094, 9094, 9094, 9094, 9095, 9096, 9097, 9098, 9099, 9100, 9100,
+    9100, 9100, 9101, 9102, 9103, 9104, 9105, 9106, 9106, 9106, 9107, 9108,
+    9109, 9111, 9113, 9114, 9115, 9116, 9116, 9116, 9116, 9117, 9118, 9119,
+    9120, 9121, 9122, 9122, 9122, 9122, 9123, 9124, 9125, 9126, 9127, 9128,
+    9128, 9128, 9128, 9129, 9130, 9131, 9132, 9133, 9134, 9134, 9134, 9134,
+    9135, 9136, 9137, 9138, 9139, 9140, 9140, 9140, 9140, 9141, 9142, 9143,
+    9144, 9145, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146, 9146,
+    9146, 9147, 9148, 9149, 9150, 9151, 9152, 9153, 9154, 9154, 9155, 9156,
+    9157, 9158, 9158, 9159, 9160, 9161, 9162, 9162, 9163, 9164, 9165, 9166,
+    9166, 9167, 9168, 9169, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170,
+    9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170,
+    9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170,
+    9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170,
+    9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170,
+    9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170,
+    9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170,
+    9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170,
+    9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9170, 9171, 9172,
+    9173, 9174, 9175, 9176, 9177, 9178, 9178, 9179, 9180, 9181, 9182, 9182,
+    9183, 9184, 9185, 9186, 9186, 9187, 9188, 9189, 9190, 9190, 9191, 9192,
+    9193, 9194, 9194, 9194, 9194, 9194, 9194, 9194, 9194, 9194, 9194, 9194,
+    9194, 9195, 9196, 9197, 9198, 9199, 9200, 9200, 9200, 9200, 9201, 9202,
+    9203, 9204, 9205, 9206, 9206, 9206, 9206, 9207, 9208, 9209, 9210, 9211,
+    9212, 9212, 9212, 9212, 9213, 9214, 9215, 9216, 9217, 9218, 9218, 9218,
+    9218, 9219, 9220, 9221, 9222, 9223, 9224, 9224, 9224, 9224, 9225, 9226,
+    9227, 9228, 9229, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230,
+    9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230,
+    9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230,
+    9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230,
+    9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230,
+    9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230,
+    9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230,
+    9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9230, 9231, 9232,
+    9233, 9234, 9235, 9236, 9237, 9238, 9239, 9240, 9241, 9242, 9243, 9244,
+    9245, 9246, 9247, 9248, 9249, 9250, 9251, 9252, 9253, 9254, 9255, 9256,
+    9257, 9258, 9259, 9260, 9261, 9262, 9263, 9265, 9265, 9265, 9265, 9266,
+    9267, 9268, 9269, 9270, 9271, 9272, 9273, 9274, 9275, 9276, 9277, 9278,
+    9279, 9280, 9281, 9282, 9283, 9284, 9285, 9286, 9287, 9288, 9289, 9290,
+    9291, 9292, 9293, 9294, 9295, 9296, 9297, 9298, 9299, 9300, 9301, 9302,
+    9303, 9305, 9305, 9305, 9305, 9306, 9307, 9308, 9309, 9310, 9311, 9312,
+    9313, 9314, 9315, 9316, 9317, 9318, 9319, 9320, 9321, 9322, 9323, 9324,
+    9325, 9326, 9327, 9328, 9329, 9330, 9331, 9332, 9333, 9334, 9335, 9336,
+    9337, 9338, 9339, 9340, 9341, 9342, 9343, 9344, 9345, 9346, 9347, 9348,
+    9349, 9350, 9351, 9352, 9353, 9354, 9355, 9356, 9357, 9358, 9359, 9360,
+    9361, 9362, 9363, 9364, 9365, 9366, 9367, 9368, 9369, 9370, 9371, 9372,
+    9373, 9374, 9375, 9376, 9377, 9378, 9379, 9380, 9381, 9382, 9383, 9384,
+    9385, 9386, 9387, 9388, 9388, 9389, 9390, 9391, 9392, 9392, 9393, 9394,
+    9395, 9396, 9397, 9398, 9399, 9400, 9401, 9402, 9403, 9404, 9405, 9406,
+    9407, 9408, 9409, 9410, 9411, 9412, 9413, 9414, 9415, 9416, 9417, 9418,
+    9419, 9420, 9421, 9422, 9426, 9430, 9434, 9438, 9442, 9442, 9443, 9443,
+    9444, 9445, 9446, 9447, 9448, 9449, 9450, 9451, 9452, 9453, 9454, 9455,
+    9456, 9457, 9458, 9459, 9460, 9461, 9462, 9463, 9464, 9465, 9466, 9467,
+    9468, 9469, 9470, 9471, 9472, 9473, 9474, 9475, 9476, 9477, 9479, 9480,
+    9481, 9482, 9483, 9484, 9486, 9487, 9488, 9489, 9490, 9491, 9493, 9494,
+    9495, 9496, 9497, 9498, 9500, 9501, 9502, 9503, 9504, 9505, 9507, 9508,
+    9509, 9510, 9511, 9512, 9513, 9515, 9516, 9517, 9518, 9519, 9520, 9521,
+    9523, 9524, 9525, 9526, 9527, 9528, 9530, 9531, 9532, 9533, 9534, 9535,
+    9537, 9538, 9539, 9540, 9541, 9542, 9544, 9545, 9546, 9547, 9548, 9549,
+    9551, 9552, 9553, 9554, 9555, 9556, 9556, 9557, 9557, 9558, 9559, 9560,
+    9561, 9562, 9563, 9564, 9565, 9566, 9567, 9568, 9569, 9570, 9571, 9572,
+    9573, 9574, 9575, 9576, 9577, 9578, 9578, 9579, 9579, 9580, 9581, 9582,
+    9583, 9584, 9585, 9586, 9587, 9588, 9589, 9590, 9591, 9592, 9593, 9594,
+    9595, 9596, 9597, 9598, 9599, 9600, 9601, 9602, 9603, 9604, 9606, 9607,
+    9608, 9609, 9610, 9611, 9613, 9614, 9615, 9616, 9617, 9618, 9620, 9621,
+    9622, 9623, 9624, 9625, 9627, 9628, 9629, 9630, 9631, 9632, 9634, 9635,
+    9636, 9637, 9638, 9639, 9639, 9639, 9639, 9639, 9639, 9639, 9639, 9639,
+    9639, 9639, 9639, 9639, 9639, 9639, 9639, 9639, 9639, 9639, 9639, 9639,
+    9640, 9641, 9642, 9643, 9644, 9645, 9646, 9647, 9648, 9649, 9650, 9651,
+    9652, 9653, 9654, 9655, 9656, 9657, 9658, 9659, 9660, 9661, 9662, 9663,
+    9664, 9665, 9665, 9666, 9667, 9668, 9669, 9670, 9670, 9670, 9670, 9671,
+    9672, 9673, 9674, 9675, 9676, 9677, 9678, 9679, 9680, 9681, 9682, 9683,
+    9684, 9685, 9686, 9687, 9688, 9689, 9690, 9691, 9692, 9693, 9694, 9695,
+    9696, 9697, 9698, 9699, 9700, 9701, 9702, 9703, 9704, 9705, 9706, 9706,
+    9706, 9707, 9708, 9709, 9709, 9709, 9709, 9711, 9712, 9713, 9714, 9715,
+    9716, 9717, 9719, 9720, 9721, 9722, 9723, 9724, 9725, 9727, 9728, 9729,
+    9730, 9731, 9732, 9733, 9735, 9736, 9737, 9738, 9739, 9740, 9741, 9743,
+    9744, 9745, 9746, 9747, 9748, 9749, 9750, 9751, 9752, 9753, 9754, 9755,
+    9756, 9757, 9758, 9759, 9760, 9761, 9762, 9763, 9764, 9765, 9766, 9767,
+    9768, 9769, 9770, 9771, 9772, 9773, 9774, 9775, 9776, 9777, 9778, 9779,
+    9780, 9781, 9782, 9783, 9784, 9785, 9786, 9787, 9788, 9789, 9790, 9791,
+    9792, 9793, 9793, 9793, 9793, 9794, 9795, 9796, 9797, 9798, 9799, 9800,
+    9801, 9802, 9803, 9804, 9805, 9806, 9807, 9808, 9809, 9810, 9811, 9812,
+    9813, 9814, 9815, 9816, 9817, 9818, 9819, 9820, 9821, 9822, 9823, 9824,
+    9825, 9826, 9827, 9828, 9829, 9830, 9831, 9832, 9833, 9834, 9835, 9836,
+    9837, 9838, 9839, 9840, 9841, 9842, 9843, 9844, 9845, 9846, 9847, 9848,
+    9849, 9850, 9851, 9852, 9853, 9854, 9855, 9856, 9857, 9858, 9859, 9860,
+    9861, 9862, 9863, 9864, 9865, 9866, 9867, 9868, 9869, 9870, 9871, 9872,
+    9873, 9874, 9875, 9876, 9877, 9878, 9879, 9880, 9881, 9882, 9883, 9884,
+    9885, 9886, 9887, 9888, 9889, 9890, 9891, 9892, 9893, 9894, 9895, 9896,
+    9897, 9898, 9899, 9900, 9901, 9902, 9903, 9905, 9906, 9907, 9908, 9909,
+    9910, 9911, 9912, 9914, 9915, 9916, 9917, 9918, 9919, 9920, 9921, 9923,
+    9924, 9925, 9926, 9927, 9928, 9929, 9930, 9932, 9933, 9934, 9935, 9936,
+    9937, 9938, 9939, 9941, 9942, 9943, 9944, 9945, 9946, 9947, 9948, 9949,
+    9950, 9951, 9952, 9953, 9954, 9955, 9956, 9957, 9958, 9959, 9960, 9961,
+    9962, 9963, 9964, 9965, 9966, 9967, 9968, 9969, 9970, 9971, 9972, 9973,
+    9974, 9975, 9976, 9977, 9978, 9979, 9980, 9981, 9982, 9983, 9984, 9985,
+    9986, 9987, 9988, 9989, 9990, 9991, 9992, 9993, 9994, 9995, 9996, 9997,
+    9998, 9999, 10000, 10001, 10002, 10003, 10004, 10005, 10006, 10007, 10008, 10009,
+    10010, 10011, 10012, 10013, 10014, 10015, 10016, 10017, 10018, 10019, 10020, 10021,
+    10022, 10023, 10024, 10024, 10024, 10025, 10026, 10027, 10028, 10029, 10030, 10031,
+    10032, 10033, 10034, 10035, 10036, 10037, 10038, 10039, 10040, 10041, 10042, 10043,
+    10044, 10045, 10046, 10047, 10048, 10049, 10050, 10051, 10052, 10053, 10054, 10055,
+    10057, 10058, 10059, 10060, 10061, 10062, 10063, 10065, 10066, 10067, 10068, 10069,
+    10070, 10071, 10073, 10074, 10075, 10076, 10077, 10078, 10079, 10081, 10082, 10083,
+    10084, 10085, 10086, 10087, 10089, 10090, 10091, 10092, 10093, 10094, 10095, 10096,
+    10097, 10098, 10099, 10100, 10102, 10103, 10104, 10105, 10106, 10107, 10108, 10109,
+    10110, 10112, 10113, 10114, 10115, 10116, 10117, 10118, 10119, 10120, 10122, 10123,
+    10124, 10125, 10126, 10127, 10128, 10129, 10130, 10132, 10133, 10134, 10135, 10136,
+    10137, 10138, 10139, 10140, 10142, 10143, 10144, 10145, 10146, 10147, 10147, 10147,
+    10148, 10149, 10150, 10151, 10152, 10153, 10154, 10155, 10156, 10157, 10158, 10159,
+    10160, 10161, 10162, 10163, 10164, 10165, 10166, 10167, 10167, 10167, 10168, 10169,
+    10170, 10171, 10172, 10173, 10174, 10175, 10176, 10177, 10178, 10179, 10180, 10181,
+    10182, 10183, 10184, 10185, 10186, 10187, 10188, 10189, 10190, 10192, 10193, 10194,
+    10195, 10196, 10197, 10198, 10200, 10201, 10202, 10203, 10204, 10205, 10206, 10208,
+    10209, 10210, 10211, 10212, 10213, 10214, 10216, 10217, 10218, 10219, 10220, 10221,
+    10222, 10224, 10225, 10226, 10227, 10228, 10228, 10229, 10229, 10230, 10230, 10231,
+    10231, 10232, 10232, 10233, 10233, 10234, 10234, 10235, 10235, 10236, 10236, 10237,
+    10237, 10238, 10239, 10240, 10241, 10242, 10243, 10244, 10245, 10246, 10247, 10248,
+    10249, 10250, 10251, 10252, 10253, 10254, 10255, 10256, 10257, 10258, 10259, 10260,
+    10261, 10262, 10263, 10264, 10265, 10266, 10267, 10268, 10269, 10270, 10271, 10272,
+    10273, 10274, 10275, 10276, 10277, 10278, 10279, 10280, 10281, 10282, 10283, 10284,
+    10285, 10286, 10287, 10289, 10290, 10291, 10292, 10293, 10294, 10295, 10297, 10298,
+    10299, 10300, 10301, 10302, 10303, 10304, 10305, 10306, 10308, 10309, 10310, 10311,
+    10312, 10313, 10314, 10315, 10316, 10317, 10319, 10320, 10321, 10322, 10323, 10324,
+    10325, 10326, 10327, 10328, 10330, 10331, 10332, 10333, 10334, 10335, 10336, 10337,
+    10338, 10339, 10341, 10342, 10343, 10344, 10345, 10346, 10347, 10347, 10348, 10348,
+    10349, 10349, 10350, 10350, 10351, 10351, 10352, 10352, 10353, 10353, 10354, 10354,
+    10355, 10355, 10356, 10356, 10357, 10357, 10358, 10358, 10359, 10359, 10360, 10360,
+    10361, 10361, 10362, 10362, 10363, 10363, 10364, 10364, 10365, 10365, 10366, 10366,
+    10367, 10368, 10369, 10370, 10371, 10372, 10373, 10374, 10375, 10376, 10377, 10378,
+    10379, 10380, 10381, 10382, 10383, 10384, 10385, 10386, 10387, 10388, 10389, 10390,
+    10391, 10392, 10393, 10394, 10395, 10396, 10397, 10398, 10399, 10400, 10401, 10402,
+    10403, 10404, 10405, 10406, 10407, 10408, 10409, 10410, 10411, 10412, 10413, 10414,
+    10415, 10416, 10417, 10418, 10419, 10420, 10421, 10421, 10422, 10423, 10425, 10426,
+    10428, 10433, 10434, 10435, 10436, 10437, 10437, 10437, 10437, 10442, 10443, 10444,
+    10445, 10446, 10446, 10446, 10446, 10451, 10452, 10453, 10454, 10455, 10455, 10455,
+    10455, 10460, 10461, 10462, 10463, 10464, 10464, 10464, 10464, 10469, 10470, 10471,
+    10472, 10473, 10473, 10473, 10473, 10473, 10473, 10474, 10475, 10477, 10482, 10487,
+    10488, 10489, 10490, 10491, 10492, 10493, 10493, 10493, 10493, 10498, 10503, 10504,
+    10505, 10506, 10507, 10508, 10509, 10509, 10509, 10509, 10514, 10519, 10520, 10521,
+    10522, 10523, 10524, 10525, 10525, 10525, 10525, 10530, 10535, 10536, 10537, 10538,
+    10539, 10540, 10541, 10541, 10541, 10541, 10546, 10551, 10552, 10553, 10554, 10555,
+    10556, 10557, 10557, 10557, 10557, 10558, 10559, 10560, 10561, 10562, 10563, 10564,
+    10565, 10566, 10567, 10568, 10569, 10570, 10571, 10572, 10573, 10574, 10575, 10576,
+    10577, 10578, 10579, 10583, 10584, 10585, 10586, 10586, 10586, 10586, 10587, 10591,
+    10592, 10593, 10594, 10594, 10594, 10594, 10595, 10599, 10600, 10601, 10602, 10602,
+    10602, 10602, 10603, 10607, 10608, 10609, 10610, 10610, 10610, 10610, 10611, 10615,
+    10616, 10617, 10618, 10618, 10618, 10618, 10619, 10620, 10621, 10622, 10623, 10624,
+    10625, 10626, 10627, 10628, 10629, 10630, 10631, 10632, 10632, 10632, 10632, 10632,
+    10632, 10632, 10632, 10632, 10632, 10632, 10632, 10633, 10634, 10635, 10639, 10639,
+    10639, 10639, 10639, 10639, 10640, 10641, 10642, 10646, 10646, 10646, 10646, 10646,
+    10646, 10647, 10648, 10649, 10653, 10653, 10653, 10653, 10653, 10653, 10654, 10655,
+    10656, 10660, 10660, 10660, 10660, 10660, 10660, 10661, 10662, 10663, 10667, 10668,
+    10668, 10668, 10668, 10668, 10668, 10668, 10668, 10668, 10668, 10668, 10668, 10668,
+    10668, 10669, 10670, 10671, 10672, 10676, 10680, 10680, 10680, 10680, 10680, 10680,
+    10680, 10680, 10680, 10680, 10680, 10681, 10682, 10683, 10684, 10688, 10692, 10692,
+    10692, 10692, 10692, 10692, 10692, 10692, 10692, 10692, 10692, 10693, 10694, 10695,
+    10696, 10700, 10704, 10704, 10704, 10704, 10704, 10704, 10704, 10704, 10704, 10704,
+    10704, 10705, 10706, 10707, 10708, 10712, 10716, 10716, 10716, 10716, 10716, 10716,
+    10716, 10716, 10716, 10716, 10716, 10717, 10718, 10719, 10720, 10724, 10728, 10729,
+    10730, 10731, 10732, 10733, 10734, 10735, 10736, 10737, 10738, 10739, 10740, 10741,
+    10742, 10743, 10744, 10745, 10746, 10747, 10748, 10748, 10749, 10749, 10749, 10749,
+    10749, 10750, 10751, 10756, 10757, 10757, 10757, 10757, 10757, 10758, 10759, 10764,
+    10765, 10765, 10765, 10765, 10765, 10766, 10767, 10772, 10773, 10773, 10773, 10773,
+    10773, 10774, 10775, 10780, 10781, 10781, 10781, 10781, 10781, 10782, 10783, 10788,
+    10788, 10788, 10788, 10788, 10788, 10788, 10788, 10788, 10788, 10788, 10789, 10790,
+    10791, 10792, 10793, 10794, 10795, 10795, 10795, 10795, 10795, 10796, 10797, 10798,
+    10798, 10798, 10798, 10798, 10799, 10800, 10801, 10801, 10801, 10801, 10801, 10802,
+    10803, 10804, 10804, 10804, 10804, 10804, 10805, 10806, 10807, 10807, 10807, 10807,
+    10807, 10809, 10810, 10811, 10812, 10813, 10813, 10813, 10813, 10813, 10813, 10813,
+    10813, 10813, 10814, 10815, 10816, 10817, 10817, 10817, 10817, 10817, 10817, 10817,
+    10817, 10817, 10818, 10819, 10820, 10821, 10821, 10821, 10821, 10821, 10821, 10821,
+    10821, 10821, 10822, 10823, 10824, 10825, 10825, 10825, 10825, 10825, 10825, 10825,
+    10825, 10825, 10826, 10827, 10828, 10829, 10829, 10829, 10829, 10829, 10829, 10829,
+    10829, 10829, 10829, 10829, 10829, 10829, 10829, 10829, 10829, 10829, 10829, 10829,
+    10829, 10829, 10829, 10829, 10829, 10829, 10829, 10829, 10829, 10829, 10830, 10831,
+    10832, 10832, 10832, 10832, 10832, 10832, 10833, 10834, 10835, 10835, 10835, 10835,
+    10835, 10835, 10836, 10837, 10838, 10838, 10838, 10838, 10838, 10838, 10839, 10840,
+    10841, 10841, 10841, 10841, 10841, 10841, 10842, 10843, 10844, 10844, 10844, 10844,
+    10844, 10844, 10845, 10846, 10847, 10847, 10848, 10853, 10854, 10855, 10860, 10861,
+    10862, 10867, 10868, 10869, 10874, 10875, 10876, 10881, 10882, 10882, 10882, 10884,
+    10889, 10894, 10895, 10897, 10902, 10907, 10908, 10910, 10915, 10920, 10921, 10923,
+    10928, 10933, 10934, 10936, 10941, 10946, 10947, 10948, 10949, 10953, 10954, 10955,
+    10959, 10960, 10961, 10965, 10966, 10967, 10971, 10972, 10973, 10977, 10977, 10977,
+    10977, 10978, 10978, 10978, 10978, 10978, 10978, 10979, 10980, 10980, 10980, 10980,
+    10980, 10980, 10981, 10982, 10982, 10982, 10982, 10982, 10982, 10983, 10984, 10984,
+    10984, 10984, 10984, 10984, 10985, 10986, 10986, 10986, 10986, 10986, 10986, 10987,
+    10988, 10989, 10989, 10989, 10989, 10989, 10989, 10989, 10989, 10989, 10989, 10989,
+    10990, 10991, 10992, 10992, 10992, 10992, 10992, 10992, 10992, 10992, 10992, 10992,
+    10992, 10993, 10994, 10995, 10995, 10995, 10995, 10995, 10995, 10995, 10995, 10995,
+    10995, 10995, 10996, 10997, 10998, 10998, 10998, 10998, 10998, 10998, 10998, 10998,
+    10998, 10998, 10998, 10999, 11000, 11001, 11001, 11001, 11001, 11001, 11001, 11001,
+    11001, 11001, 11001, 11001, 11002, 11003, 11004, 11004, 11004, 11004, 11004, 11005,
+    11006, 11006, 11006, 11006, 11006, 11007, 11008, 11008, 11008, 11008, 11008, 11009,
+    11010, 11010, 11010, 11010, 11010, 11011, 11012, 11012, 11012, 11012, 11012, 11013,
+    11014, 11015, 11016, 11017, 11018, 11019, 11020, 11021, 11022, 11023, 11024, 11025,
+    11026, 11027, 11028, 11029, 11030, 11031, 11032, 11033, 11034, 11035, 11036, 11037,
+    11038, 11039, 11040, 11041, 11042, 11043, 11044, 11045, 11046, 11047, 11048, 11049,
+    11050, 11051, 11052, 11053, 11054, 11055, 11056, 11057, 11058, 11059, 11061, 11062,
+    11063, 11065, 11066, 11067, 11069, 11070, 11071, 11073, 11074, 11075, 11077, 11078,
+    11079, 11080, 11081, 11082, 11083, 11084, 11085, 11086, 11087, 11092, 11093, 11098,
+    11099, 11104, 11105, 11110, 11111, 11116, 11117, 11122, 11127, 11128, 11129, 11134,
+    11139, 11140, 11141, 11146, 11151, 11152, 11153, 11158, 11163, 11164, 11165, 11170,
+    11175, 11176, 11177, 11181, 11182, 11186, 11187, 11191, 11192, 11196, 11197, 11201,
+    11202, 11202, 11202, 11202, 11202, 11202, 11203, 11203, 11203, 11203, 11203, 11203,
+    11204, 11204, 11204, 11204, 11204, 11204, 11205, 11205, 11205, 11205, 11205, 11205,
+    11206, 11206, 11206, 11206, 11206, 11206, 11207, 11207, 11207, 11207, 11207, 11207,
+    11207, 11207, 11207, 11207, 11207, 11208, 11209, 11209, 11209, 11209, 11209, 11209,
+    11209, 11209, 11209, 11209, 11209, 11210, 11211, 11211, 11211, 11211, 11211, 11211,
+    11211, 11211, 11211, 11211, 11211, 11212, 11213, 11213, 11213, 11213, 11213, 11213,
+    11213, 11213, 11213, 11213, 11213, 11214, 11215, 11215, 11215, 11215, 11215, 11215,
+    11215, 11215, 11215, 11215, 11215, 11216, 11217, 11217, 11217, 11217, 11217, 11218,
+    11218, 11218, 11218, 11218, 11219, 11219, 11219, 11219, 11219, 11220, 11220, 11220,
+    11220, 11220, 11221, 11221, 11221, 11221, 11221, 11222, 11223, 11224, 11225, 11226,
+    11227, 11228, 11229, 11230, 11231, 11232, 11233, 11234, 11235, 11236, 11237, 11238,
+    11239, 11240, 11241, 11242, 11247, 11252, 11257, 11262, 11267, 11272, 11277, 11282,
+    11287, 11292, 11297, 11302, 11307, 11312, 11317, 11321, 11325, 11329, 11333, 11337,
+    11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337,
+    11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337,
+    11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337,
+    11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337,
+    11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337,
+    11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337,
+    11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337,
+    11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337, 11337
+};
+
+constexpr uint8_t EMOJI_BYTE_TRIE_SYMBOLS[] = {
+    0x23, 0x2A, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0xC2, 0xE2, 0xE3, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xA9, 0xAE, 0x80, 0x81, 0x84, 0x86, 0x8C, 0x8F,
+    0x93, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0xA4, 0xAC,
+    0xAD, 0x80, 0x8A, 0x9F, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xEF, 0xEF, 0xBC, 0x89, 0xA2, 0xB9, 0x94, 0x95,
+    0x96, 0x97, 0x98, 0x99, 0xA9, 0xAA, 0x9A, 0x9B, 0xA8, 0x8F, 0xA9, 0xAA,
+    0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB8, 0xB9, 0xBA,
+    0x82, 0xAA, 0xAB, 0xB6, 0x80, 0xBB, 0xBC, 0xBD, 0xBE, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x8E, 0x91, 0x94, 0x95, 0x98, 0x9D, 0xA0, 0xA2, 0xA3, 0xA6,
+    0xAA, 0xAE, 0xAF, 0xB8, 0xB9, 0xBA, 0x80, 0x82, 0x88, 0x89, 0x8A, 0x8B,
+    0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x9F, 0xA0, 0xA3, 0xA5,
+    0xA6, 0xA8, 0xBB, 0xBE, 0xBF, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x99,
+    0x9B, 0x9C, 0xA0, 0xA1, 0xA7, 0xAA, 0xAB, 0xB0, 0xB1, 0xBD, 0xBE, 0x84,
+    0x85, 0x88, 0x8E, 0x8F, 0x91, 0x93, 0x94, 0xA9, 0xAA, 0xB0, 0xB1, 0xB2,
+    0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xB9, 0xBA, 0xBD, 0x82, 0x85, 0x88, 0x89,
+    0x8A, 0x8B, 0x8C, 0x8D, 0x8F, 0x92, 0x94, 0x96, 0x9D, 0xA1, 0xA8, 0xB3,
+    0xB4, 0x84, 0x87, 0x8C, 0x8E, 0x93, 0x94, 0x95, 0x97, 0xA3, 0xA4, 0x95,
+    0x96, 0x97, 0xA1, 0xB0, 0xBF, 0xB4, 0xB5, 0x85, 0x86, 0x87, 0x9B, 0x9C,
+    0x90, 0x95, 0xB0, 0xBD, 0x97, 0x99, 0x80, 0x83, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9F, 0xA4, 0xA5, 0xA6, 0xA7, 0xA9, 0xAA,
+    0xAB, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0xB8, 0xB8, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xF0, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xEF, 0xF0, 0xEF, 0xF0, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x84, 0x8F, 0xB0,
+    0xB1, 0xBE, 0xBF, 0x8E, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98,
+    0x99, 0x9A, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0x81, 0x82, 0x9A, 0xAF, 0xB2, 0xB3, 0xB4, 0xB5,
+    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0x90, 0x91, 0x80, 0x81, 0x82, 0x83, 0x84,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90,
+    0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C,
+    0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA,
+    0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6,
+    0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A,
+    0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6,
+    0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2,
+    0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A,
+    0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x96, 0x97, 0x99,
+    0x9A, 0x9B, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7,
+    0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B,
+    0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3,
+    0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF,
+    0xB0, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xB9, 0xBA, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B,
+    0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7,
+    0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B,
+    0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3,
+    0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93,
+    0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F,
+    0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB,
+    0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B,
+    0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7,
+    0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0x80,
+    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C,
+    0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98,
+    0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4,
+    0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0,
+    0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
+    0xBD, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x90, 0x91, 0x92, 0x93, 0x94,
+    0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0,
+    0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xAF, 0xB0, 0xB3, 0xB4, 0xB5,
+    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0x87, 0x8A, 0x8B, 0x8C, 0x8D, 0x90, 0x95,
+    0x96, 0xA4, 0xA5, 0xA8, 0xB1, 0xB2, 0xBC, 0x82, 0x83, 0x84, 0x91, 0x92,
+    0x93, 0x9C, 0x9D, 0x9E, 0xA1, 0xA3, 0xA8, 0xAF, 0xB3, 0xBA, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94,
+    0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0,
+    0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC,
+    0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
+    0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x80, 0x81, 0x82, 0x83, 0x84,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x80,
+    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C,
+    0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98,
+    0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4,
+    0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0,
+    0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x90, 0x91, 0x92, 0x95, 0x96, 0x97, 0x9C, 0x9D, 0x9E, 0x9F,
+    0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA9, 0xAB, 0xAC, 0xB0, 0xB3, 0xB4,
+    0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xA0, 0xA1, 0xA2, 0xA3,
+    0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xB0, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A,
+    0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6,
+    0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2,
+    0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C,
+    0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98,
+    0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4,
+    0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0,
+    0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94,
+    0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0,
+    0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC,
+    0xAD, 0xAE, 0xAF, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94,
+    0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0,
+    0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC,
+    0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
+    0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
+    0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94,
+    0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0,
+    0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC,
+    0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
+    0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x80, 0x81, 0x82, 0x83, 0x84,
+    0x85, 0x86, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
+    0xA6, 0xA7, 0xA8, 0xA9, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0x8F, 0x8F, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x9F, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0x9F, 0xB8, 0xB8, 0xB8, 0x9F, 0x9F, 0xB8, 0x9F, 0xB8, 0x9F, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xE2, 0xE2, 0xEF, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xF0, 0xE2, 0xF0, 0xEF,
+    0xF0, 0xEF, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xE2, 0xF3, 0xEF, 0xEF, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xEF, 0xEF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xE2, 0xF0, 0xE2, 0xE2, 0xF0, 0xE2, 0xF0, 0xF0, 0xE2, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xE2, 0xF0, 0xF0, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xF0,
+    0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xF0, 0xEF, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xF0, 0xE2, 0xF0,
+    0xE2, 0xF0, 0xE2, 0xF0, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xF0, 0xE2, 0xF0,
+    0xE2, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xF0, 0xEF, 0xF0, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE2, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xE2, 0xF0, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2,
+    0xE2, 0xF0, 0xE2, 0xF0, 0xF0, 0xF0, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xF0,
+    0xE2, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xF0, 0xF0, 0xE2, 0xF0,
+    0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2,
+    0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2, 0xE2, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0xB8, 0xB8, 0xB8, 0xB8, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x80, 0x80, 0xB8, 0x9F,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x9F, 0x80, 0x9F, 0x80, 0x9F,
+    0x9F, 0x80, 0x9F, 0xB8, 0x9F, 0xB8, 0x9F, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x80, 0xA0,
+    0xB8, 0xB8, 0x80, 0x80, 0x80, 0x80, 0xB8, 0xB8, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x80,
+    0x9F, 0x80, 0x9F, 0x9F, 0x9F, 0x9F, 0x80, 0x9F, 0x80, 0x80, 0x9F, 0x80,
+    0x9F, 0x9F, 0x80, 0x9F, 0x9F, 0x9F, 0x9F, 0x80, 0x9F, 0x9F, 0x9F, 0x80,
+    0x9F, 0x80, 0x9F, 0x9F, 0x9F, 0x80, 0x9F, 0x80, 0x9F, 0x9F, 0x9F, 0x9F,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x9F, 0xB8, 0x9F, 0xB8, 0xB8,
+    0xB8, 0xB8, 0x9F, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x9F, 0x9F, 0x9F,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x9F, 0x80, 0x9F, 0x80, 0x9F, 0x80, 0x9F, 0x9F, 0x80, 0x9F, 0x80,
+    0x9F, 0x9F, 0x80, 0x9F, 0x80, 0x9F, 0x80, 0x9F, 0x80, 0x9F, 0x9F, 0xB8,
+    0x9F, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x80,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x80, 0x9F, 0x9F, 0x80, 0x9F, 0x80,
+    0x9F, 0x80, 0x9F, 0x80, 0x80, 0x9F, 0x80, 0x9F, 0x9F, 0x9F, 0x9F, 0x80,
+    0x9F, 0x80, 0x9F, 0x9F, 0x80, 0x9F, 0x80, 0x9F, 0x80, 0x9F, 0x80, 0x9F,
+    0x9F, 0x9F, 0x80, 0x9F, 0x9F, 0x80, 0x9F, 0x80, 0x9F, 0x80, 0x9F, 0x80,
+    0x9F, 0x80, 0x9F, 0x80, 0x9F, 0x80, 0x9F, 0x80, 0x9F, 0x80, 0x80, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xA3,
+    0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+    0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+    0x87, 0x87, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8D, 0x8D, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8D, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8D, 0x81, 0x8F, 0x8F, 0x8D, 0x8D, 0x8D,
+    0x8D, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8D, 0x8F, 0x8D, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8D, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8D, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8F,
+    0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8F, 0x8D, 0x8F, 0x8D,
+    0x8F, 0x8D, 0x8F, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8D, 0x8F, 0x8D,
+    0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8D, 0x8F, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8D, 0x8D,
+    0x8F, 0x8D, 0x8F, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8D,
+    0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x8F,
+    0x8D, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F,
+    0x8D, 0x8F, 0x8D, 0x8F, 0x8D, 0x8D, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x80, 0x80, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0x80, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAE, 0xB1, 0xB2, 0xB4, 0xB6,
+    0xB7, 0xB8, 0xB9, 0xBA, 0xBC, 0xBD, 0xBF, 0xA6, 0xA7, 0xA9, 0xAA, 0xAB,
+    0xAC, 0xAD, 0xAE, 0xAF, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xB8, 0xB9,
+    0xBB, 0xBC, 0xBE, 0xBF, 0xA6, 0xA8, 0xA9, 0xAB, 0xAC, 0xAD, 0xAE, 0xB0,
+    0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xAA, 0xAC, 0xAF, 0xB0, 0xB2, 0xB4, 0xBF, 0xA6, 0xA8, 0xAA, 0xAC,
+    0xAD, 0xB7, 0xB8, 0xB9, 0xBA, 0xAE, 0xAF, 0xB0, 0xB2, 0xB4, 0xB7, 0xA6,
+    0xA7, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xB1, 0xB2, 0xB3, 0xB5, 0xB6,
+    0xB7, 0xB8, 0xB9, 0xBA, 0xBC, 0xBE, 0xB0, 0xB2, 0xB3, 0xB7, 0xB9, 0xBA,
+    0xA8, 0xA9, 0xAA, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xB8, 0xB9, 0xAA,
+    0xB2, 0xB4, 0xB5, 0xAA, 0xAC, 0xAD, 0xAE, 0xB2, 0xB3, 0xB5, 0xB7, 0xBC,
+    0xBE, 0xBF, 0xA6, 0xA7, 0xA8, 0xAE, 0xB0, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB,
+    0xBE, 0xA6, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xA6, 0xA8, 0xAA, 0xAB, 0xAC, 0xAE, 0xB1, 0xB4, 0xB5, 0xB7, 0xBA, 0xBF,
+    0xB2, 0xA6, 0xAA, 0xAB, 0xAC, 0xAD, 0xB0, 0xB1, 0xB2, 0xB3, 0xB7, 0xB8,
+    0xB9, 0xBC, 0xBE, 0xA6, 0xAA, 0xB4, 0xB8, 0xBA, 0xBC, 0xA6, 0xA7, 0xA8,
+    0xA9, 0xAA, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB7,
+    0xB8, 0xB9, 0xBB, 0xBD, 0xBE, 0xBF, 0xA6, 0xA8, 0xA9, 0xAB, 0xAC, 0xAD,
+    0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB7, 0xB9, 0xBB, 0xBC, 0xBF, 0xA6,
+    0xAC, 0xB2, 0xB3, 0xB8, 0xBE, 0xBF, 0xA6, 0xA8, 0xAA, 0xAC, 0xAE, 0xB3,
+    0xBA, 0xAB, 0xB8, 0xB0, 0xAA, 0xB9, 0xA6, 0xB2, 0xBC, 0xF0, 0xF0, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xE2, 0xA7, 0xE2,
+    0xF0, 0xE2, 0xF0, 0xE2, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xF0, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xE2, 0xF0, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xE2, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xF0,
+    0xF0, 0xE2, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xE2, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xE2, 0xF0, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xE2, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2, 0xE2, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x8D, 0x8D, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x8D, 0x9F, 0x9F, 0x99, 0x9E, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0x80, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x80, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0x80, 0x98, 0xF3, 0xAC, 0x9F, 0xAC, 0x9F, 0x9D, 0x80, 0x9A,
+    0x9C, 0x9D, 0x9F, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x9A, 0x9C, 0x9D, 0x9F,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99,
+    0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0x80, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x9F, 0x9F, 0x9F, 0x86, 0x99, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0x9E, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0x99, 0x9E, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0x9A, 0x9C, 0x9F, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0x99, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xF0, 0xE2,
+    0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xF0, 0x9F, 0x9F, 0x80, 0x82, 0xA1, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8D, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x8D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8D, 0xA0, 0xA0, 0x9B, 0xA6, 0x9B,
+    0x94, 0x84, 0x8D, 0x95, 0x96, 0x88, 0xA4, 0x8C, 0x8D, 0x8E, 0x8F, 0x91,
+    0x92, 0x94, 0x9A, 0xA6, 0x80, 0x80, 0x80, 0x80, 0x80, 0x95, 0x96, 0x88,
+    0xA4, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x92, 0x94, 0x9A, 0xA6, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8D, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x92, 0x92, 0x8C, 0x94, 0x95, 0x80, 0x82, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82,
+    0xA1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x82, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0xA1, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x95, 0x96, 0x88,
+    0x8C, 0x8D, 0x8E, 0x8F, 0x92, 0x94, 0x9A, 0xA4, 0xA6, 0xA7, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x82, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x9F, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x9F, 0xAB,
+    0xA9, 0xE2, 0xEF, 0xE2, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF,
+    0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D,
+    0x8D, 0xE2, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xE2, 0x8D, 0x8D, 0x8D, 0x8D,
+    0x8D, 0xE2, 0xF0, 0xEF, 0x81, 0xBA, 0xA5, 0xEF, 0xF0, 0xEF, 0xEF, 0xEF,
+    0xE2, 0xEF, 0xBE, 0xB3, 0xBC, 0x93, 0xA4, 0xA8, 0xAB, 0xAD, 0xA6, 0xA7,
+    0xA8, 0xA9, 0xBB, 0xBC, 0xA7, 0xAC, 0x80, 0x92, 0xAF, 0xB0, 0xB1, 0xB2,
+    0xB3, 0xBC, 0xBD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0xEF, 0xE2,
+    0xEF, 0xBE, 0xB3, 0xBC, 0x93, 0xA4, 0xA8, 0xAB, 0xAD, 0xA6, 0xA7, 0xA9,
+    0xBB, 0xBC, 0xA7, 0xAC, 0x80, 0x92, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xBC,
+    0xBD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D,
+    0x8D, 0xEF, 0xEF, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF,
+    0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+    0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D,
+    0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D,
+    0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xE2,
+    0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xA8, 0xAB, 0xAB, 0xEF, 0xEF, 0xEF, 0xEF,
+    0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+    0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D,
+    0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D,
+    0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF,
+    0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D,
+    0x8D, 0xE2, 0xEF, 0xE2, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF,
+    0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D,
+    0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D,
+    0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF,
+    0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D,
+    0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D,
+    0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xE2,
+    0xEF, 0xE2, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D,
+    0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0xEF, 0xBE, 0xB3, 0xBC, 0x84, 0x93,
+    0xA4, 0xA8, 0xAB, 0xAD, 0xBB, 0xBC, 0xA7, 0xAC, 0x80, 0x92, 0x9D, 0xAF,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xBC, 0xBD, 0x91, 0x92, 0x8D, 0x8D, 0x8D, 0x8D,
+    0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D,
+    0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF,
+    0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+    0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D,
+    0x8D, 0x8D, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0x8D,
+    0x8D, 0x8D, 0x8D, 0x8D, 0xEF, 0xEF, 0xEF, 0xEF, 0x8D, 0x8D, 0x8D, 0x8D,
+    0x8D, 0x92, 0x80, 0x82, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xA9, 0x80,
+    0xB8, 0x80, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x9A,
+    0x9F, 0xB8, 0xA2, 0xB8, 0x9F, 0xB8, 0xB8, 0xB8, 0x80, 0xB8, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2,
+    0xF0, 0xE2, 0xF0, 0xB8, 0xB8, 0xB8, 0x80, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0,
+    0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0xB8, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8,
+    0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x99, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xEF,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8,
+    0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x80, 0xB8, 0x80, 0xB8, 0xB8, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8,
+    0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0x80, 0xB8, 0x80, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2, 0xF0, 0xE2,
+    0xF0, 0xE2, 0xF0, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8,
+    0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0xB8, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xA5, 0xEF, 0xEF, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0xA5, 0xB9, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x99,
+    0x9E, 0x99, 0x9E, 0x99, 0x9E, 0x99, 0x9E, 0x99, 0x9E, 0x8F, 0x8F, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x80,
+    0x82, 0x99, 0x99, 0x99, 0x99, 0x99, 0x80, 0x82, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0xA7, 0x8C, 0x8F, 0xF3, 0x8F, 0x97, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x9A, 0x9C, 0x9D, 0x9F, 0x9A,
+    0x9C, 0x9D, 0x9F, 0x9A, 0x9C, 0x9D, 0x9F, 0x9A, 0x9C, 0x9D, 0x9F, 0x9A,
+    0x9C, 0x9D, 0x9F, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x9A, 0x9C, 0x9D, 0x9F, 0x9A, 0x9C, 0x9D, 0x9F, 0x9A, 0x9C,
+    0x9D, 0x9F, 0x9A, 0x9C, 0x9D, 0x9F, 0x9A, 0x9C, 0x9D, 0x9F, 0x8F, 0x8F,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x8F, 0x8F, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F,
+    0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x80, 0x82, 0x99, 0x99, 0x99, 0x99, 0x99, 0xB8, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x99, 0x9E, 0x99,
+    0x9E, 0x99, 0x9E, 0x99, 0x9E, 0x99, 0x9E, 0x8F, 0x8F, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F,
+    0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x8F, 0x8F, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F,
+    0x99, 0x9E, 0x99, 0x9E, 0x99, 0x9E, 0x99, 0x9E, 0x99, 0x9E, 0x8F, 0x8F,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x8F, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x9A, 0x9C, 0x9D, 0x9F, 0x9A, 0x9C, 0x9D, 0x9F, 0x9A, 0x9C,
+    0x9D, 0x9F, 0x9A, 0x9C, 0x9D, 0x9F, 0x9A, 0x9C, 0x9D, 0x9F, 0x8F, 0x8F,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F,
+    0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8F, 0x8F, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x8F, 0x8F, 0x8F, 0x8F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xB8, 0xB8,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xE2, 0xE2,
+    0xE2, 0xE2, 0x80, 0x82, 0xA1, 0x80, 0x82, 0xA1, 0x80, 0x82, 0xA1, 0x80,
+    0x82, 0xA1, 0x80, 0x82, 0xA1, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80,
+    0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80,
+    0x82, 0xEF, 0xEF, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80,
+    0x82, 0xEF, 0xEF, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80,
+    0x82, 0xEF, 0x88, 0xA0, 0xA8, 0xF0, 0xE2, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+    0x8D, 0x8D, 0x95, 0x96, 0x88, 0xA4, 0x8C, 0x8D, 0x8E, 0x8F, 0x92, 0x94,
+    0x9A, 0xA4, 0xA6, 0x95, 0x96, 0x88, 0xA4, 0x8C, 0x8D, 0x8E, 0x8F, 0x92,
+    0x94, 0x9A, 0xA4, 0xA6, 0x95, 0x96, 0x88, 0xA4, 0x8C, 0x8D, 0x8E, 0x8F,
+    0x92, 0x94, 0x9A, 0xA4, 0xA6, 0x95, 0x96, 0x88, 0xA4, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x92, 0x94, 0x9A, 0xA4, 0xA6, 0x95, 0x96, 0x88, 0xA4, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x92, 0x94, 0x9A, 0xA4, 0xA6, 0xF0, 0xE2, 0x8D, 0x8D, 0x8D,
+    0x8D, 0x8D, 0x8D, 0x95, 0x96, 0x88, 0xA4, 0x8C, 0x8D, 0x8E, 0x8F, 0x92,
+    0x94, 0x9A, 0xA4, 0xA6, 0x95, 0x96, 0x88, 0xA4, 0x8C, 0x8D, 0x8E, 0x8F,
+    0x92, 0x94, 0x9A, 0xA4, 0xA6, 0x95, 0x96, 0x88, 0xA4, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x92, 0x94, 0x9A, 0xA4, 0xA6, 0x95, 0x96, 0x88, 0xA4, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x92, 0x94, 0x9A, 0xA4, 0xA6, 0x95, 0x96, 0x88, 0xA4, 0x8C,
+    0x8D, 0x8E, 0x8F, 0x92, 0x94, 0x9A, 0xA4, 0xA6, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0xEF, 0xEF, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x8F, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80,
+    0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80,
+    0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80,
+    0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80,
+    0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80,
+    0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80,
+    0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80,
+    0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0xE2, 0xE2, 0xE2,
+    0xE2, 0x80, 0x82, 0xA1, 0x80, 0x82, 0xA1, 0x80, 0x82, 0xA1, 0x80, 0x82,
+    0xA1, 0x80, 0x82, 0xA1, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0xE2, 0xE2, 0xE2, 0xE2,
+    0x80, 0x82, 0xA1, 0x80, 0x82, 0xA1, 0x80, 0x82, 0xA1, 0x80, 0x82, 0xA1,
+    0x80, 0x82, 0xA1, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80,
+    0x82, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x95, 0x96, 0x88, 0xA4, 0x8C,
+    0x8D, 0x8E, 0x8F, 0x92, 0x94, 0x9A, 0xA4, 0xA6, 0x95, 0x96, 0x88, 0xA4,
+    0x8C, 0x8D, 0x8E, 0x8F, 0x92, 0x94, 0x9A, 0xA4, 0xA6, 0x95, 0x96, 0x88,
+    0xA4, 0x8C, 0x8D, 0x8E, 0x8F, 0x92, 0x94, 0x9A, 0xA4, 0xA6, 0x95, 0x96,
+    0x88, 0xA4, 0x8C, 0x8D, 0x8E, 0x8F, 0x92, 0x94, 0x9A, 0xA4, 0xA6, 0x95,
+    0x96, 0x88, 0xA4, 0x8C, 0x8D, 0x8E, 0x8F, 0x92, 0x94, 0x9A, 0xA4, 0xA6,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82,
+    0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0x8F,
+    0x8F, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x9E,
+    0x80, 0x9E, 0x80, 0xE2, 0xEF, 0xE2, 0xEF, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF,
+    0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xEF, 0xE2,
+    0xEF, 0xE2, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xB8, 0xB8, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xB8, 0xB8, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xB8, 0x81, 0xEF, 0x9F, 0x80, 0xF0, 0xF0, 0xF0, 0xF0, 0xE2, 0xE2, 0xE2,
+    0xEF, 0xEF, 0xEF, 0xE2, 0xEF, 0xBE, 0xB3, 0xBC, 0x93, 0xA4, 0xA8, 0xAB,
+    0xAD, 0xBB, 0xBC, 0xA7, 0xAC, 0x80, 0x92, 0x9D, 0xAF, 0xB0, 0xB1, 0xB2,
+    0xB3, 0xBC, 0xBD, 0xEF, 0xEF, 0xEF, 0xE2, 0xEF, 0xBE, 0xB3, 0xBC, 0x93,
+    0xA4, 0xA8, 0xAB, 0xAD, 0xBB, 0xBC, 0xA7, 0xAC, 0x80, 0x92, 0x9D, 0xAF,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xBC, 0xBD, 0xEF, 0xEF, 0xEF, 0xE2, 0xEF, 0xBE,
+    0xB3, 0xBC, 0x93, 0xA4, 0xA8, 0xAB, 0xAD, 0xBB, 0xBC, 0xA7, 0xAC, 0x80,
+    0x92, 0x9D, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xBC, 0xBD, 0xEF, 0xEF, 0xEF,
+    0xE2, 0xEF, 0xBE, 0xB3, 0xBC, 0x93, 0xA4, 0xA8, 0xAB, 0xAD, 0xBB, 0xBC,
+    0xA7, 0xAC, 0x80, 0x92, 0x9D, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xBC, 0xBD,
+    0xEF, 0xEF, 0xEF, 0xE2, 0xEF, 0xBE, 0xB3, 0xBC, 0x93, 0xA4, 0xA8, 0xAB,
+    0xAD, 0xBB, 0xBC, 0xA7, 0xAC, 0x80, 0x92, 0x9D, 0xAF, 0xB0, 0xB1, 0xB2,
+    0xB3, 0xBC, 0xBD, 0x9F, 0x80, 0xF0, 0xF0, 0xF0, 0xE2, 0xE2, 0xE2, 0xEF,
+    0xEF, 0xEF, 0xE2, 0xEF, 0xBE, 0xB3, 0xBC, 0x93, 0xA4, 0xA8, 0xAB, 0xAD,
+    0xBB, 0xBC, 0xA7, 0xAC, 0x80, 0x92, 0x9D, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xBC, 0xBD, 0xEF, 0xEF, 0xEF, 0xE2, 0xEF, 0xBE, 0xB3, 0xBC, 0x93, 0xA4,
+    0xA8, 0xAB, 0xAD, 0xBB, 0xBC, 0xA7, 0xAC, 0x80, 0x92, 0x9D, 0xAF, 0xB0,
+    0xB1, 0xB2, 0xB3, 0xBC, 0xBD, 0xEF, 0xEF, 0xEF, 0xE2, 0xEF, 0xBE, 0xB3,
+    0xBC, 0x93, 0xA4, 0xA8, 0xAB, 0xAD, 0xBB, 0xBC, 0xA7, 0xAC, 0x80, 0x92,
+    0x9D, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xBC, 0xBD, 0xEF, 0xEF, 0xEF, 0xE2,
+    0xEF, 0xBE, 0xB3, 0xBC, 0x93, 0xA4, 0xA8, 0xAB, 0xAD, 0xBB, 0xBC, 0xA7,
+    0xAC, 0x80, 0x92, 0x9D, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xBC, 0xBD, 0xEF,
+    0xEF, 0xEF, 0xE2, 0xEF, 0xBE, 0xB3, 0xBC, 0x93, 0xA4, 0xA8, 0xAB, 0xAD,
+    0xBB, 0xBC, 0xA7, 0xAC, 0x80, 0x92, 0x9D, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xBC, 0xBD, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xB8, 0xB8, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0x9E, 0x80, 0x9E, 0x80, 0xE2, 0xEF, 0xE2, 0xEF, 0xEF, 0xE2,
+    0xEF, 0xE2, 0xEF, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xEF, 0xE2, 0xEF, 0xE2,
+    0xEF, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x9E,
+    0x80, 0x9E, 0x80, 0xE2, 0xEF, 0xE2, 0xEF, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF,
+    0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xEF, 0xE2,
+    0xEF, 0xE2, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xF0, 0xE2, 0xE2, 0xE2, 0xF0, 0xF0, 0xEF, 0xEF, 0xEF, 0xE2,
+    0xEF, 0xBE, 0xB3, 0xBC, 0x84, 0x93, 0xA4, 0xA8, 0xAB, 0xAD, 0xBB, 0xBC,
+    0xA7, 0xAC, 0x80, 0x92, 0x9D, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xBC, 0xBD,
+    0xEF, 0xEF, 0xEF, 0xE2, 0xEF, 0xBE, 0xB3, 0xBC, 0x84, 0x93, 0xA4, 0xA8,
+    0xAB, 0xAD, 0xBB, 0xBC, 0xA7, 0xAC, 0x80, 0x92, 0x9D, 0xAF, 0xB0, 0xB1,
+    0xB2, 0xB3, 0xBC, 0xBD, 0xEF, 0xEF, 0xEF, 0xE2, 0xEF, 0xBE, 0xB3, 0xBC,
+    0x84, 0x93, 0xA4, 0xA8, 0xAB, 0xAD, 0xBB, 0xBC, 0xA7, 0xAC, 0x80, 0x92,
+    0x9D, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xBC, 0xBD, 0xEF, 0xEF, 0xEF, 0xE2,
+    0xEF, 0xBE, 0xB3, 0xBC, 0x84, 0x93, 0xA4, 0xA8, 0xAB, 0xAD, 0xBB, 0xBC,
+    0xA7, 0xAC, 0x80, 0x92, 0x9D, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xBC, 0xBD,
+    0xEF, 0xEF, 0xEF, 0xE2, 0xEF, 0xBE, 0xB3, 0xBC, 0x84, 0x93, 0xA4, 0xA8,
+    0xAB, 0xAD, 0xBB, 0xBC, 0xA7, 0xAC, 0x80, 0x92, 0x9D, 0xAF, 0xB0, 0xB1,
+    0xB2, 0xB3, 0xBC, 0xBD, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xB2, 0xB2,
+    0xB2, 0xB2, 0xB2, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0xA1, 0x8D, 0xA1, 0x8D, 0x80, 0xB8, 0x80, 0xB8, 0xB8, 0x80, 0xB8,
+    0x80, 0xB8, 0xB8, 0x80, 0xB8, 0x80, 0xB8, 0xB8, 0x80, 0xB8, 0x80, 0xB8,
+    0xB8, 0x80, 0xB8, 0x80, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0x8F, 0x8F, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0x8F, 0x8F, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0x8F, 0xA5, 0xB3, 0xB7, 0xB8, 0x91, 0x92, 0x8D, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0xB8, 0xB8, 0xB8, 0x80, 0xB8, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0x80, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8,
+    0xB8, 0xB8, 0x80, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0x80,
+    0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0x80, 0xB8, 0xE2, 0xE2,
+    0xE2, 0xE2, 0x91, 0x92, 0x8D, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0xB8,
+    0xB8, 0xB8, 0x80, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0x80,
+    0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0x80, 0xB8, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0x80, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8,
+    0xB8, 0xB8, 0x80, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0x8F, 0x8F, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xA1, 0x8D, 0xA1, 0x8D,
+    0x80, 0xB8, 0x80, 0xB8, 0xB8, 0x80, 0xB8, 0x80, 0xB8, 0xB8, 0x80, 0xB8,
+    0x80, 0xB8, 0xB8, 0x80, 0xB8, 0x80, 0xB8, 0xB8, 0x80, 0xB8, 0x80, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xA1, 0x8D, 0xA1, 0x8D, 0x80, 0xB8, 0x80,
+    0xB8, 0xB8, 0x80, 0xB8, 0x80, 0xB8, 0xB8, 0x80, 0xB8, 0x80, 0xB8, 0xB8,
+    0x80, 0xB8, 0x80, 0xB8, 0xB8, 0x80, 0xB8, 0x80, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x9F, 0x9E, 0x9E, 0x9E,
+    0x9F, 0x9F, 0xB8, 0xB8, 0xB8, 0x80, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8,
+    0xB8, 0xB8, 0x80, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0x80,
+    0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0x80, 0xB8, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0x80, 0xB8, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0xE2,
+    0xEF, 0xE2, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F,
+    0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8D, 0x8F,
+    0x8D, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xF3, 0xF3, 0xF3, 0x8F, 0xA8,
+    0x8B, 0xF0, 0x91, 0x91, 0x91, 0x91, 0xA1, 0xA1, 0xA1, 0x8F, 0x8F, 0x8F,
+    0x8D, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x80,
+    0x80, 0x80, 0x80, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x80, 0x80, 0x80, 0x80,
+    0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x8F,
+    0x8D, 0x8F, 0x80, 0x80, 0x80, 0x80, 0xA8, 0xA9, 0x8B, 0xF0, 0x91, 0x91,
+    0x91, 0xA1, 0xA1, 0xA1, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x80, 0x80, 0x80,
+    0x80, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F,
+    0x8F, 0x8D, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F,
+    0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x80, 0x80, 0x80,
+    0x80, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xEF,
+    0xE2, 0xEF, 0xE2, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F,
+    0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8D,
+    0x8F, 0x8D, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xEF, 0xE2, 0xEF, 0xE2,
+    0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8D, 0x8F,
+    0x8D, 0x8F, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F, 0x8F, 0x8D, 0x8F, 0x8D, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xA7,
+    0xA1, 0xA1, 0xA1, 0xA7, 0xA7, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x80, 0x80,
+    0x80, 0x80, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x8F,
+    0x8F, 0x8F, 0x8D, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x8F, 0x8D,
+    0x8F, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x80, 0x80,
+    0x80, 0x80, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0xB8, 0x9E, 0xB8, 0x9E, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xA0, 0xA0, 0xA0, 0xE2, 0x9F, 0xA6, 0xA6, 0xA7, 0xA6, 0xA7, 0xA6,
+    0xA7, 0xEF, 0xEF, 0xEF, 0xF0, 0xE2, 0x8D, 0x8D, 0x8D, 0x8D, 0xF0, 0xE2,
+    0x8D, 0x8D, 0x8D, 0x8D, 0xF0, 0xE2, 0x8D, 0x8D, 0x8D, 0x8D, 0xF0, 0xE2,
+    0x8D, 0x8D, 0x8D, 0x8D, 0xF0, 0xE2, 0x8D, 0x8D, 0x8D, 0x8D, 0xE2, 0x9F,
+    0xA6, 0xA6, 0xA7, 0xA6, 0xA7, 0xEF, 0xEF, 0xEF, 0xF0, 0xE2, 0x8D, 0x8D,
+    0x8D, 0x8D, 0xF0, 0xE2, 0x8D, 0x8D, 0x8D, 0x8D, 0xF0, 0xE2, 0x8D, 0x8D,
+    0x8D, 0x8D, 0xF0, 0xE2, 0x8D, 0x8D, 0x8D, 0x8D, 0xF0, 0xE2, 0x8D, 0x8D,
+    0x8D, 0x8D, 0xB8, 0x9E, 0xB8, 0x9E, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xB8, 0x9E, 0xB8, 0x9E, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0x91, 0xEF, 0xEF, 0xEF, 0x92, 0x92, 0xF0, 0xE2, 0x8D, 0x8D,
+    0x8D, 0x8D, 0xF0, 0xE2, 0x8D, 0x8D, 0x8D, 0x8D, 0xF0, 0xE2, 0x8D, 0x8D,
+    0x8D, 0x8D, 0xF0, 0xE2, 0x8D, 0x8D, 0x8D, 0x8D, 0xF0, 0xE2, 0x8D, 0x8D,
+    0x8D, 0x8D, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xA1, 0x8F, 0xA1, 0x9E,
+    0x80, 0x9E, 0x80, 0x9E, 0x80, 0x9E, 0x80, 0x9E, 0x80, 0x9E, 0x80, 0x9E,
+    0x80, 0x9E, 0x80, 0x9E, 0x80, 0x9E, 0x80, 0x81, 0x81, 0x81, 0x80, 0x91,
+    0x92, 0xE2, 0xE2, 0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0x9F, 0x80, 0xF0, 0xE2,
+    0xE2, 0xE2, 0x9F, 0x80, 0xF0, 0xE2, 0xE2, 0xE2, 0x9F, 0x80, 0xF0, 0xE2,
+    0xE2, 0xE2, 0x9F, 0x80, 0xF0, 0xE2, 0xE2, 0xE2, 0x9F, 0x80, 0xF0, 0xE2,
+    0xE2, 0xE2, 0x80, 0x91, 0x92, 0xE2, 0xE2, 0xB8, 0xB8, 0xB8, 0x9F, 0x80,
+    0xF0, 0xE2, 0xE2, 0xE2, 0x9F, 0x80, 0xF0, 0xE2, 0xE2, 0xE2, 0x9F, 0x80,
+    0xF0, 0xE2, 0xE2, 0xE2, 0x9F, 0x80, 0xF0, 0xE2, 0xE2, 0xE2, 0x9F, 0x80,
+    0xF0, 0xE2, 0xE2, 0xE2, 0x8F, 0xA1, 0x8F, 0xA1, 0x9E, 0x80, 0x9E, 0x80,
+    0x9E, 0x80, 0x9E, 0x80, 0x9E, 0x80, 0x9E, 0x80, 0x9E, 0x80, 0x9E, 0x80,
+    0x9E, 0x80, 0x9E, 0x80, 0x8F, 0xA1, 0x8F, 0xA1, 0x9E, 0x80, 0x9E, 0x80,
+    0x9E, 0x80, 0x9E, 0x80, 0x9E, 0x80, 0x9E, 0x80, 0x9E, 0x80, 0x9E, 0x80,
+    0x9E, 0x80, 0x9E, 0x80, 0xB8, 0xB8, 0xB8, 0xE2, 0x9F, 0x80, 0xF0, 0xE2,
+    0xE2, 0xE2, 0x9F, 0x80, 0xF0, 0xE2, 0xE2, 0xE2, 0x9F, 0x80, 0xF0, 0xE2,
+    0xE2, 0xE2, 0x9F, 0x80, 0xF0, 0xE2, 0xE2, 0xE2, 0x9F, 0x80, 0xF0, 0xE2,
+    0xE2, 0xE2, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xEF, 0xEF,
+    0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D,
+    0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D, 0xAE, 0xA3, 0xAC, 0x8D,
+    0xA8, 0x8B, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x8F, 0x91, 0x92, 0x8D,
+    0x9F, 0x9E, 0x9E, 0x9E, 0x91, 0x92, 0x8D, 0x9F, 0x9E, 0x9E, 0x9E, 0x91,
+    0x92, 0x8D, 0x9F, 0x9E, 0x9E, 0x9E, 0x91, 0x92, 0x8D, 0x9F, 0x9E, 0x9E,
+    0x9E, 0x91, 0x92, 0x8D, 0x9F, 0x9E, 0x9E, 0x9E, 0x8D, 0xA8, 0xA9, 0x8B,
+    0x80, 0x80, 0x8F, 0x8F, 0x8F, 0x91, 0x92, 0x8D, 0x9F, 0x9E, 0x9E, 0x9E,
+    0x91, 0x92, 0x8D, 0x9F, 0x9E, 0x9E, 0x9E, 0x91, 0x92, 0x8D, 0x9F, 0x9E,
+    0x9E, 0x9E, 0x91, 0x92, 0x8D, 0x9F, 0x9E, 0x9E, 0x9E, 0x91, 0x92, 0x8D,
+    0x9F, 0x9E, 0x9E, 0x9E, 0xEF, 0xEF, 0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D,
+    0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D,
+    0xA1, 0x8D, 0xEF, 0xEF, 0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D,
+    0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D, 0xA1, 0x8D,
+    0x8F, 0x8F, 0x8F, 0x80, 0x92, 0xA7, 0x8D, 0x9F, 0x9E, 0x9E, 0x9E, 0x92,
+    0xA7, 0x8D, 0x9F, 0x9E, 0x9E, 0x9E, 0x92, 0xA7, 0x8D, 0x9F, 0x9E, 0x9E,
+    0x9E, 0x92, 0xA7, 0x8D, 0x9F, 0x9E, 0x9E, 0x9E, 0x92, 0xA7, 0x8D, 0x9F,
+    0x9E, 0x9E, 0x9E, 0xB8, 0xB8, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF,
+    0xE2, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF,
+    0xE2, 0xF3, 0xF3, 0xF3, 0xF0, 0xE2, 0x8D, 0x8D, 0x8D, 0x8D, 0xA8, 0x8B,
+    0xF0, 0x91, 0xA1, 0xA1, 0xA1, 0xA8, 0x8B, 0xF0, 0x91, 0xA1, 0xA1, 0xA1,
+    0xA8, 0x8B, 0xF0, 0x91, 0xA1, 0xA1, 0xA1, 0xA8, 0x8B, 0xF0, 0x91, 0xA1,
+    0xA1, 0xA1, 0xA8, 0x8B, 0xF0, 0x91, 0xA1, 0xA1, 0xA1, 0xF0, 0xE2, 0x8D,
+    0x8D, 0xA8, 0xA9, 0x8B, 0xF0, 0x91, 0xA1, 0xA1, 0xA1, 0xA8, 0xA9, 0x8B,
+    0xF0, 0x91, 0xA1, 0xA1, 0xA1, 0xA8, 0xA9, 0x8B, 0xF0, 0x91, 0xA1, 0xA1,
+    0xA1, 0xA8, 0xA9, 0x8B, 0xF0, 0x91, 0xA1, 0xA1, 0xA1, 0xA8, 0xA9, 0x8B,
+    0xF0, 0x91, 0xA1, 0xA1, 0xA1, 0xB8, 0xB8, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF,
+    0xE2, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF,
+    0xE2, 0xEF, 0xE2, 0xB8, 0xB8, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF,
+    0xE2, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF, 0xE2, 0xEF,
+    0xE2, 0x8D, 0x8B, 0x91, 0xF0, 0xA7, 0xA1, 0xA1, 0xA1, 0x8B, 0x91, 0xF0,
+    0xA7, 0xA1, 0xA1, 0xA1, 0x8B, 0x91, 0xF0, 0xA7, 0xA1, 0xA1, 0xA1, 0x8B,
+    0x91, 0xF0, 0xA7, 0xA1, 0xA1, 0xA1, 0x8B, 0x91, 0xF0, 0xA7, 0xA1, 0xA1,
+    0xA1, 0x8F, 0x8F, 0xB8, 0x9E, 0xB8, 0x9E, 0xB8, 0x9E, 0xB8, 0x9E, 0xB8,
+    0x9E, 0xB8, 0x9E, 0xB8, 0x9E, 0xB8, 0x9E, 0xB8, 0x9E, 0xB8, 0x9E, 0xA0,
+    0xA0, 0xA0, 0x9F, 0x80, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE2, 0x9F, 0xA8,
+    0xEF, 0xEF, 0xEF, 0xF0, 0xE2, 0x9F, 0xA8, 0xEF, 0xEF, 0xEF, 0xF0, 0xE2,
+    0x9F, 0xA8, 0xEF, 0xEF, 0xEF, 0xF0, 0xE2, 0x9F, 0xA8, 0xEF, 0xEF, 0xEF,
+    0xF0, 0xE2, 0x9F, 0xA8, 0xEF, 0xEF, 0xEF, 0x9F, 0x80, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xE2, 0x9F, 0xA8, 0xA9, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xE2, 0x9F,
+    0xA8, 0xA9, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xE2, 0x9F, 0xA8, 0xA9, 0xEF,
+    0xEF, 0xEF, 0xF0, 0xF0, 0xE2, 0x9F, 0xA8, 0xA9, 0xEF, 0xEF, 0xEF, 0xF0,
+    0xF0, 0xE2, 0x9F, 0xA8, 0xA9, 0xEF, 0xEF, 0xEF, 0x8F, 0x8F, 0xB8, 0x9E,
+    0xB8, 0x9E, 0xB8, 0x9E, 0xB8, 0x9E, 0xB8, 0x9E, 0xB8, 0x9E, 0xB8, 0x9E,
+    0xB8, 0x9E, 0xB8, 0x9E, 0xB8, 0x9E, 0x8F, 0x8F, 0xB8, 0x9E, 0xB8, 0x9E,
+    0xB8, 0x9E, 0xB8, 0x9E, 0xB8, 0x9E, 0xB8, 0x9E, 0xB8, 0x9E, 0xB8, 0x9E,
+    0xB8, 0x9E, 0xB8, 0x9E, 0xF0, 0xE2, 0xF0, 0x9F, 0x91, 0xEF, 0xEF, 0xEF,
+    0xE2, 0xF0, 0x9F, 0x91, 0xEF, 0xEF, 0xEF, 0xE2, 0xF0, 0x9F, 0x91, 0xEF,
+    0xEF, 0xEF, 0xE2, 0xF0, 0x9F, 0x91, 0xEF, 0xEF, 0xEF, 0xE2, 0xF0, 0x9F,
+    0x91, 0xEF, 0xEF, 0xEF, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1,
+    0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1,
+    0x81, 0x81, 0x81, 0x91, 0x8D, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x80, 0x91,
+    0x92, 0xF0, 0xB8, 0xB8, 0xB8, 0x9F, 0x80, 0x91, 0x92, 0xF0, 0xB8, 0xB8,
+    0xB8, 0x9F, 0x80, 0x91, 0x92, 0xF0, 0xB8, 0xB8, 0xB8, 0x9F, 0x80, 0x91,
+    0x92, 0xF0, 0xB8, 0xB8, 0xB8, 0x9F, 0x80, 0x91, 0x92, 0xF0, 0xB8, 0xB8,
+    0xB8, 0x91, 0x8D, 0x9F, 0x9F, 0x9F, 0x9F, 0x80, 0x91, 0x92, 0xF0, 0xF0,
+    0xB8, 0xB8, 0xB8, 0x9F, 0x9F, 0x80, 0x91, 0x92, 0xF0, 0xF0, 0xB8, 0xB8,
+    0xB8, 0x9F, 0x9F, 0x80, 0x91, 0x92, 0xF0, 0xF0, 0xB8, 0xB8, 0xB8, 0x9F,
+    0x9F, 0x80, 0x91, 0x92, 0xF0, 0xF0, 0xB8, 0xB8, 0xB8, 0x9F, 0x9F, 0x80,
+    0x91, 0x92, 0xF0, 0xF0, 0xB8, 0xB8, 0xB8, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F,
+    0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F,
+    0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F,
+    0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x8F, 0xA1, 0x9F,
+    0x80, 0x9F, 0x92, 0xA7, 0xF0, 0xB8, 0xB8, 0xB8, 0x80, 0x9F, 0x92, 0xA7,
+    0xF0, 0xB8, 0xB8, 0xB8, 0x80, 0x9F, 0x92, 0xA7, 0xF0, 0xB8, 0xB8, 0xB8,
+    0x80, 0x9F, 0x92, 0xA7, 0xF0, 0xB8, 0xB8, 0xB8, 0x80, 0x9F, 0x92, 0xA7,
+    0xF0, 0xB8, 0xB8, 0xB8, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xA7, 0xB4, 0xB3, 0xA8, 0xF0, 0x91, 0x91, 0x91, 0x91, 0x8F,
+    0x8D, 0xA8, 0x8B, 0x9F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8D, 0xA8, 0x8B, 0x9F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8D, 0xA8, 0x8B, 0x9F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8D, 0xA8, 0x8B, 0x9F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8D, 0xA8, 0x8B, 0x9F,
+    0x8F, 0x8F, 0x8F, 0xA8, 0xA9, 0xF0, 0x91, 0x91, 0x8F, 0x8F, 0x8D, 0xA8,
+    0xA9, 0x8B, 0x9F, 0x9F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8D, 0xA8, 0xA9,
+    0x8B, 0x9F, 0x9F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8D, 0xA8, 0xA9, 0x8B,
+    0x9F, 0x9F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8D, 0xA8, 0xA9, 0x8B, 0x9F,
+    0x9F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8D, 0xA8, 0xA9, 0x8B, 0x9F, 0x9F,
+    0x8F, 0x8F, 0x8F, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xA7,
+    0x8D, 0x8F, 0x8B, 0x91, 0x9F, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x8B, 0x91,
+    0x9F, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x8B, 0x91, 0x9F, 0x8F, 0x8F, 0x8F,
+    0x8D, 0x8F, 0x8B, 0x91, 0x9F, 0x8F, 0x8F, 0x8F, 0x8D, 0x8F, 0x8B, 0x91,
+    0x9F, 0x8F, 0x8F, 0x8F, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xF3, 0xF3, 0xF3, 0x9F, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA7,
+    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xF0, 0xE2, 0x8F, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xF0, 0xF0, 0xE2, 0x8F, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0,
+    0xF0, 0xE2, 0x8F, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xF0, 0xE2, 0x8F,
+    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xF0, 0xE2, 0x8F, 0x9F, 0xA6, 0xA6,
+    0xA7, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0,
+    0xF0, 0xF0, 0xE2, 0x8F, 0x8F, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xF0, 0xF0, 0xF0, 0xE2, 0x8F, 0x8F, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xF0, 0xF0, 0xE2, 0x8F,
+    0x8F, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0,
+    0xF0, 0xF0, 0xE2, 0x8F, 0x8F, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xF0, 0xF0, 0xF0, 0xE2, 0x8F, 0x8F, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x92, 0xF0, 0xBC, 0xBD, 0xBE, 0xBF, 0xE2,
+    0xF0, 0x8F, 0xF0, 0xBB, 0xBD, 0xBE, 0xBF, 0xE2, 0xF0, 0x8F, 0xF0, 0xBB,
+    0xBC, 0xBE, 0xBF, 0xE2, 0xF0, 0x8F, 0xF0, 0xBB, 0xBC, 0xBD, 0xBF, 0xE2,
+    0xF0, 0x8F, 0xF0, 0xBB, 0xBC, 0xBD, 0xBE, 0xE2, 0xF0, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xA0, 0xA0, 0xA0, 0x91,
+    0x9F, 0x9F, 0x80, 0xBC, 0xBD, 0xBE, 0xBF, 0x9F, 0x9F, 0x80, 0xBB, 0xBD,
+    0xBE, 0xBF, 0x9F, 0x9F, 0x80, 0xBB, 0xBC, 0xBE, 0xBF, 0x9F, 0x9F, 0x80,
+    0xBB, 0xBC, 0xBD, 0xBF, 0x9F, 0x9F, 0x80, 0xBB, 0xBC, 0xBD, 0xBE, 0x91,
+    0x9F, 0x9F, 0x9F, 0x80, 0xBC, 0xBD, 0xBE, 0xBF, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x9F, 0x9F, 0x9F, 0x80, 0xBB, 0xBD, 0xBE, 0xBF, 0xBB, 0xBD, 0xBE, 0xBF,
+    0x9F, 0x9F, 0x9F, 0x80, 0xBB, 0xBC, 0xBE, 0xBF, 0xBB, 0xBC, 0xBE, 0xBF,
+    0x9F, 0x9F, 0x9F, 0x80, 0xBB, 0xBC, 0xBD, 0xBF, 0xBB, 0xBC, 0xBD, 0xBF,
+    0x9F, 0x9F, 0x9F, 0x80, 0xBB, 0xBC, 0xBD, 0xBE, 0xBB, 0xBC, 0xBD, 0xBE,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x9F, 0x80, 0x9F, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0x9F, 0x80, 0x9F, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x9F, 0x80, 0x9F, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x9F, 0x80, 0x9F, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0x9F, 0x80, 0x9F, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x81, 0x81, 0x81, 0xA8, 0x91, 0x8F, 0x8D, 0x91, 0x8F, 0x8D, 0x91, 0x8F,
+    0x8D, 0x91, 0x8F, 0x8D, 0x91, 0x8F, 0x8D, 0xA8, 0xA9, 0x91, 0x8F, 0x8F,
+    0x8D, 0x91, 0x8F, 0x8F, 0x8D, 0x91, 0x8F, 0x8F, 0x8D, 0x91, 0x8F, 0x8F,
+    0x8D, 0x91, 0x8F, 0x8F, 0x8D, 0xA7, 0x8D, 0x8F, 0xA7, 0x8D, 0x8F, 0xA7,
+    0x8D, 0x8F, 0xA7, 0x8D, 0x8F, 0xA7, 0x8D, 0x8F, 0xBF, 0xBF, 0xBF, 0xA8,
+    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xA8, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xF0, 0xA8, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xA8, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xF0, 0xA8, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xA8, 0xA9,
+    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xA8,
+    0xA9, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0,
+    0xA8, 0xA9, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xF0, 0xA8, 0xA9, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xF0, 0xA8, 0xA9, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xF0, 0x91, 0xF0, 0xBC, 0xBD, 0xBE, 0xBF, 0x91, 0xF0, 0xBB,
+    0xBD, 0xBE, 0xBF, 0x91, 0xF0, 0xBB, 0xBC, 0xBE, 0xBF, 0x91, 0xF0, 0xBB,
+    0xBC, 0xBD, 0xBF, 0x91, 0xF0, 0xBB, 0xBC, 0xBD, 0xBE, 0xF0, 0x9F, 0xF0,
+    0x9F, 0xF0, 0x9F, 0xF0, 0x9F, 0xF0, 0x9F, 0xF0, 0xF0, 0x9F, 0xF0, 0xF0,
+    0x9F, 0xF0, 0xF0, 0x9F, 0xF0, 0xF0, 0x9F, 0xF0, 0xF0, 0x9F, 0xF0, 0x9F,
+    0xF0, 0x9F, 0xF0, 0x9F, 0xF0, 0x9F, 0xF0, 0x9F, 0x9F, 0x91, 0x9F, 0x91,
+    0x9F, 0x91, 0x9F, 0x91, 0x9F, 0x91, 0x9F, 0x9F, 0x91, 0x9F, 0x9F, 0x91,
+    0x9F, 0x9F, 0x91, 0x9F, 0x9F, 0x91, 0x9F, 0x9F, 0x91, 0x9F, 0xA7, 0x9F,
+    0xA7, 0x9F, 0xA7, 0x9F, 0xA7, 0x9F, 0xA7, 0x8F, 0xA8, 0x8F, 0xA8, 0x8F,
+    0xA8, 0x8F, 0xA8, 0x8F, 0xA8, 0x8F, 0x8F, 0xA8, 0xA9, 0x8F, 0x8F, 0xA8,
+    0xA9, 0x8F, 0x8F, 0xA8, 0xA9, 0x8F, 0x8F, 0xA8, 0xA9, 0x8F, 0x8F, 0xA8,
+    0xA9, 0x8F, 0x91, 0x8F, 0x91, 0x8F, 0x91, 0x8F, 0x91, 0x8F, 0x91, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xF0, 0xF0, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xF0, 0xF0, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xF0, 0xF0, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xF0, 0xF0, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xF0, 0xF0, 0xBC, 0xBD, 0xBE, 0xBF, 0xF0, 0xBB, 0xBD,
+    0xBE, 0xBF, 0xF0, 0xBB, 0xBC, 0xBE, 0xBF, 0xF0, 0xBB, 0xBC, 0xBD, 0xBF,
+    0xF0, 0xBB, 0xBC, 0xBD, 0xBE, 0xF0, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xBC, 0xBD, 0xBE, 0xBF, 0xBB, 0xBD, 0xBE, 0xBF, 0xBB, 0xBC, 0xBE,
+    0xBF, 0xBB, 0xBC, 0xBD, 0xBF, 0xBB, 0xBC, 0xBD, 0xBE
+};
+
+constexpr bool EMOJI_BYTE_TRIE_TERMINAL[] = {
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, true, true, false, false, true,
+    true, true, true, false, false, false, true, false, false, true, false, false,
+    false, false, false, false, false, false, false, false, true, true, false, false,
+    false, false, false, false, false, true, true, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, true, true, true,
+    true, true, true, true, true, true, true, true, true, false, false, false,
+    false, false, false, false, false, true, false, true, false, false, false, false,
+    false, false, false, false, true, false, true, true, false, false, true, true,
+    true, true, false, true, false, false, false, true, false, true, false, false,
+    true, true, false, true, false, false, false, true, true, false, true, false,
+    false, true, true, false, false, false, false, false, false, false, false, true,
+    false, false, false, false, true, true, true, true, true, true, false, false,
+    true, true, true, false, true, true, false, false, false, false, false, true,
+    true, true, true, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, true, true,
+    false, false, false, false, true, true, true, true, true, true, true, true,
+    true, true, true, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, true, false, true, true, true, true, true,
+    true, true, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, false, false, false, false, false, false, false,
+    false, false, false, true, true, true, true, true, true, true, true, true,
+    false, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, false,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, false,
+    false, false, false, false, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    false, false, false, false, true, true, true, true, true, false, false, false,
+    false, false, false, false, false, false, false, false, false, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, true, false, false, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    false, true, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, false, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, false, false, false, false,
+    false, false, false, false, false, true, false, false, false, false, false, false,
+    true, true, true, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, true,
+    false, false, false, true, true, true, true, true, true, true, true, true,
+    true, false, false, false, false, false, false, false, true, true, false, false,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, false, false, false, false, false, false, false, false, false,
+    false, false, true, true, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, false, true, true, true, false, false,
+    true, false, true, false, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, false, false, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, false, true, true, true,
+    true, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, false, false, true, false, true, true, true, true,
+    true, true, true, false, false, false, false, false, false, false, false, true,
+    false, true, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, false, false, true, true, false, false,
+    false, false, true, true, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, true, true, true, true,
+    true, true, true, false, true, false, true, true, true, true, false, true,
+    true, true, true, true, true, false, false, false, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, true, false, true, true, true,
+    true, true, true, true, true, true, true, true, true, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, false,
+    true, true, true, true, true, true, true, true, true, true, false, true,
+    true, true, true, true, false, true, true, true, true, true, true, true,
+    true, true, true, false, true, true, true, true, true, false, true, true,
+    true, true, true, false, true, true, true, true, true, false, false, false,
+    false, false, false, false, false, false, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, false, false, true,
+    true, true, true, true, false, false, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, true, true, true, true, true, false, false, true, true,
+    true, true, true, false, true, true, true, true, true, true, true, true,
+    true, true, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, false,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, false, true, true, true, true, true, false, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, false, true, true, true, true, true, false, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, false, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, false,
+    false, false, false, false, true, true, true, true, true, false, true, true,
+    true, true, true, false, true, true, true, true, true, false, true, true,
+    true, true, true, true, true, true, true, true, false, true, true, true,
+    true, true, false, true, true, true, true, true, true, true, true, true,
+    true, false, true, true, true, true, true, false, true, true, true, true,
+    true, false, true, true, true, true, true, false, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, false, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, false, true, true, true,
+    true, true, true, true, true, true, true, false, true, true, true, true,
+    true, false, true, true, true, true, true, false, true, true, true, true,
+    true, false, false, true, true, true, true, true, false, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, false, true, true, true, true, true, false,
+    true, true, true, true, true, true, true, true, true, true, false, true,
+    true, true, true, true, false, true, true, true, true, true, false, true,
+    true, true, true, true, false, false, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, false, true, true,
+    true, true, true, true, true, true, true, true, false, true, true, true,
+    true, true, false, true, true, true, true, true, false, true, true, true,
+    true, true, false, true, true, true, true, true, false, true, true, true,
+    true, true, false, true, true, true, true, true, false, true, true, true,
+    true, true, false, true, true, true, true, true, false, false, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, true, true, true,
+    false, false, false, false, false, true, true, false, false, false, false, false,
+    true, true, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, true, false, true, false,
+    true, false, true, false, true, true, true, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, true, true,
+    true, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, true, true, false, false, false, false, false, true,
+    true, true, true, false, false, false, false, false, true, true, false, false,
+    false, false, false, true, true, false, false, false, false, false, true, true,
+    false, false, false, false, false, true, true, false, false, false, false, false,
+    true, true, false, false, false, false, false, true, true, false, false, false,
+    false, false, true, true, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, true, true, true, true, false, false,
+    false, false, false, true, true, false, false, false, false, false, true, true,
+    false, false, false, false, false, true, true, false, false, false, false, false,
+    true, true, false, false, false, false, false, true, true, false, false, false,
+    false, false, true, true, false, false, false, false, false, true, true, false,
+    false, false, false, false, true, true, false, false, false, false, false, true,
+    true, true, false, false, false, false, false, true, true, false, false, false,
+    false, false, true, true, false, false, false, false, false, true, true, false,
+    false, false, false, false, true, true, false, false, false, false, false, true,
+    true, false, false, false, false, false, true, true, true, true, false, false,
+    false, false, false, true, true, false, false, false, false, false, true, true,
+    false, false, false, false, false, true, true, false, false, false, false, false,
+    true, true, false, false, false, false, false, true, true, true, false, false,
+    false, false, false, true, true, false, false, false, false, false, true, true,
+    true, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, true, true, false, false, false, false, false, true,
+    true, false, false, false, false, false, true, true, false, false, false, false,
+    false, true, true, false, false, false, false, false, true, true, false, false,
+    false, false, false, true, true, false, false, false, false, false, true, true,
+    false, false, false, false, false, true, true, false, false, false, false, false,
+    true, true, false, false, false, false, false, true, true, true, true, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    true, true, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, true, true, false, false, false, false,
+    false, false, false, true, true, true, true, true, true, true, true, true,
+    true, false, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, false, false, false, false, false, false, false, false,
+    false, false, true, true, true, true, true, true, true, true, true, true,
+    false, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, true, true, true, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, false,
+    true, true, true, true, true, true, true, false, true, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, true, true, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, true, false, false, true, true, true, true, true,
+    true, true, true, true, true, true, true, false, true, false, true, true,
+    false, false, false, false, false, false, false, false, false, false, true, true,
+    false, false, false, false, false, true, true, false, false, false, false, false,
+    true, true, false, false, false, false, false, true, true, false, false, false,
+    false, false, true, false, true, false, true, false, true, true, true, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, true, true, true, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, true,
+    true, false, false, false, false, false, true, true, true, true, false, false,
+    false, false, false, true, true, false, false, false, false, false, true, true,
+    false, false, false, false, false, true, true, false, false, false, false, false,
+    true, true, false, false, false, false, false, true, true, false, false, false,
+    false, false, true, true, false, false, false, false, false, true, true, false,
+    false, false, false, false, true, true, false, false, false, false, false, false,
+    true, true, true, true, false, false, false, false, false, true, true, false,
+    false, false, false, false, true, true, false, false, false, false, false, true,
+    true, false, false, false, false, false, true, true, false, false, false, false,
+    false, true, true, false, false, false, false, false, true, true, false, false,
+    false, false, false, true, true, false, false, false, false, false, true, true,
+    false, false, false, false, false, false, true, false, true, true, false, false,
+    false, false, false, false, false, false, false, false, true, true, false, false,
+    false, false, false, true, true, false, false, false, false, false, true, true,
+    false, false, false, false, false, true, true, false, false, false, false, false,
+    true, true, false, false, false, false, false, true, true, true, true, false,
+    false, false, false, false, true, true, false, false, false, false, false, true,
+    true, false, false, false, false, false, true, true, false, false, false, false,
+    false, true, true, false, false, false, false, false, false, true, false, true,
+    true, false, false, false, false, false, false, false, false, false, false, true,
+    true, false, false, false, false, false, true, true, true, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, true,
+    true, false, false, false, false, false, true, true, false, false, false, false,
+    false, true, true, false, false, false, false, false, true, true, false, false,
+    false, false, false, true, true, false, false, false, false, false, true, true,
+    false, false, false, false, false, true, true, false, false, false, false, false,
+    true, true, false, false, false, false, false, true, true, false, false, false,
+    false, false, true, true, true, true, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, false, true, true, true, true, true, true, true, true,
+    true, true, false, false, true, true, true, true, true, true, true, true,
+    true, true, false, true, false, true, false, false, false, false, false, false,
+    false, false, false, true, true, true, false, false, false, false, false, false,
+    false, false, false, false, true, true, true, false, false, false, false, false,
+    false, false, false, false, false, true, true, true, false, false, false, false,
+    false, false, false, false, false, false, true, true, true, false, false, false,
+    false, false, false, false, false, false, false, true, true, true, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, true, true, true, false, false, false, false, false,
+    false, false, false, false, false, true, true, true, false, false, false, false,
+    false, false, false, false, false, false, true, true, true, false, false, false,
+    false, false, false, false, false, false, false, true, true, true, false, false,
+    false, false, false, false, false, false, false, false, true, true, true, false,
+    false, false, false, false, false, false, false, false, false, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, false, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, false,
+    false, false, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, false, false, false,
+    false, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, false, false, false, false, false, true, true, true, false,
+    false, false, false, false, false, false, false, false, false, true, true, true,
+    false, false, false, false, false, false, false, false, false, false, true, true,
+    true, false, false, false, false, false, false, false, false, false, false, true,
+    true, true, false, false, false, false, false, false, false, false, false, false,
+    true, true, true, false, false, false, false, false, false, false, false, false,
+    false, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, false, false, false, false, false,
+    true, true, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, false, true, true, true,
+    true, true, true, true, false, false, false, false, false, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, false,
+    true, true, true, true, true, true, true, false, false, false, false, false,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, false, true, true, true, true, true, true, true, false, false,
+    false, false, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, false, true, true, true, true, true, true,
+    true, false, false, false, false, false, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, false, true, true, true,
+    true, true, true, true, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, false, true, true, true, true,
+    true, true, true, false, false, false, false, false, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, false, true,
+    true, true, true, true, true, true, false, false, false, false, false, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, false, true, true, true, true, true, true, true, false, false, false,
+    false, false, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, false, true, true, true, true, true, true, true,
+    false, false, false, false, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, false, true, true, true, true,
+    true, true, true, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, false, true, true, true, true, true, true,
+    true, false, false, false, false, false, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, false, true, true,
+    true, true, true, true, true, false, false, false, false, false, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, false, true, true, true, true, true, true, true, false, false, false,
+    false, false, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, false, true, true, true, true, true, true,
+    true, false, false, false, false, false, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, false, true, true,
+    true, true, true, true, true, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, true, true, true, true, true, true, true, true,
+    true, true, true, false, true, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, true, true, false, false, false, false, false, false, false,
+    false, false, false, true, true, false, false, false, false, false, false, false,
+    false, false, false, true, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, true, true, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, true, false, true,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, true, false, true, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, true, false, true, true, false, true, false, true,
+    true, false, true, false, true, true, false, true, false, true, true, false,
+    true, false, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, false, false, false, true,
+    true, false, false, false, false, false, false, true, true, true, true, true,
+    true, false, false, false, false, false, false, true, true, true, false, false,
+    false, false, false, false, true, true, true, false, false, false, false, false,
+    false, true, true, true, false, false, false, false, false, false, true, true,
+    true, false, false, false, false, false, false, true, true, false, false, false,
+    false, false, true, true, true, true, true, true, false, false, false, false,
+    false, false, true, true, true, false, false, false, false, false, false, true,
+    true, true, false, false, false, false, false, false, true, true, true, false,
+    false, false, false, false, false, true, true, true, false, false, false, false,
+    false, false, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    false, false, false, false, false, true, false, true, true, false, true, false,
+    true, true, false, true, false, true, true, false, true, false, true, true,
+    false, true, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, false, false, false,
+    false, false, true, false, true, true, false, true, false, true, true, false,
+    true, false, true, true, false, true, false, true, true, false, true, false,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    false, true, true, true, false, false, true, true, true, false, false, false,
+    false, false, false, true, true, true, false, false, false, false, false, false,
+    true, true, true, false, false, false, false, false, false, true, true, true,
+    false, false, false, false, false, false, true, true, true, false, false, false,
+    false, false, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, true, true, true, true, true,
+    true, true, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, true, true, true, true, true, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, true, false, false, false, true, true, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, true, true, true, true,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, true, true, true, true, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, true, true, true, true, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, false,
+    false, true, false, true, false, true, false, true, false, true, false, true,
+    false, true, false, true, false, true, false, true, false, false, false, false,
+    false, true, false, false, false, false, false, true, true, true, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, true, true,
+    false, false, false, true, true, true, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, true, false, true, false, true,
+    false, true, false, true, false, true, false, true, false, true, false, true,
+    false, true, false, false, false, true, false, true, false, true, false, true,
+    false, true, false, true, false, true, false, true, false, true, false, true,
+    false, true, true, true, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, true, true, true, false, false, false, false, true, true,
+    true, false, false, false, false, true, true, true, false, false, false, false,
+    true, true, true, false, false, false, false, true, true, true, false, false,
+    false, false, false, false, false, false, false, true, true, true, false, false,
+    false, false, false, true, true, true, false, false, false, false, false, true,
+    true, true, false, false, false, false, false, true, true, true, false, false,
+    false, false, false, true, true, true, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, true, true, true, false, false,
+    false, false, true, true, true, false, false, false, false, true, true, true,
+    false, false, false, false, true, true, true, false, false, false, false, true,
+    true, true, true, true, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, true, true, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, true, true, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, true, false, false, false, false, false,
+    false, false, false, false, false, true, true, true, false, false, false, false,
+    false, true, true, true, false, false, false, false, false, true, true, true,
+    false, false, false, false, false, true, true, true, false, false, false, false,
+    false, true, true, true, true, true, false, false, false, false, false, false,
+    false, false, false, false, false, true, true, true, false, false, false, false,
+    false, false, false, false, true, true, true, false, false, false, false, false,
+    false, false, false, true, true, true, false, false, false, false, false, false,
+    false, false, true, true, true, false, false, false, false, false, false, false,
+    false, true, true, true, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, true, true, true, false, false, false,
+    false, false, true, true, true, false, false, false, false, false, true, true,
+    true, false, false, false, false, false, true, true, true, false, false, false,
+    false, false, true, true, true, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, true, true, true, true, true,
+    true, true, true, true, true, true, false, false, false, false, true, true,
+    true, true, true, false, false, false, false, true, true, true, true, true,
+    false, false, false, false, true, true, true, true, true, false, false, false,
+    false, true, true, true, true, true, false, false, false, false, false, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    false, false, false, false, false, false, true, true, true, true, true, true,
+    true, true, true, true, false, false, false, false, false, false, true, true,
+    true, true, true, true, true, true, true, true, false, false, false, false,
+    false, false, true, true, true, true, true, true, true, true, true, true,
+    false, false, false, false, false, false, true, true, true, true, true, true,
+    true, true, true, true, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, true, false, true, true, true, true,
+    false, false, false, false, true, true, true, true, false, false, false, false,
+    true, true, true, true, false, false, false, false, true, true, true, true,
+    false, false, false, false, true, true, true, true, false, false, false, true,
+    true, true, true, true, true, true, true, true, true, false, false, false,
+    false, false, false, false, true, true, true, true, false, false, false, true,
+    true, true, true, false, false, false, true, true, true, true, false, false,
+    false, true, true, true, true, false, false, false, true, true, true, true,
+    false, false, false, false, false, true, true, true, true, true, true, true,
+    true, false, false, false, false, true, true, true, true, true, true, true,
+    true, false, false, false, false, true, true, true, true, true, true, true,
+    true, false, false, false, false, true, true, true, true, true, true, true,
+    true, false, false, false, false, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, false, false, false,
+    true, true, true, true, true, false, false, false, true, true, true, true,
+    true, false, false, false, true, true, true, true, true, false, false, false,
+    true, true, true, true, true, false, false, false, true, true, true, true,
+    true, false, false, false, true, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, true, true, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, true, true, true,
+    false, true, true, true, true, true, false, false, true, true, true, true,
+    true, false, false, true, true, true, true, true, false, false, true, true,
+    true, true, true, false, false, true, true, true, true, true, false, false,
+    false, true, true, true, true, true, true, true, true, true, true, false,
+    false, false, true, true, true, true, true, true, true, true, true, true,
+    false, false, false, true, true, true, true, true, true, true, true, true,
+    true, false, false, false, true, true, true, true, true, true, true, true,
+    true, true, false, false, false, true, true, true, true, true, true, true,
+    true, true, true, false, false, false, true, true, true, true, false, false,
+    true, true, true, true, false, false, true, true, true, true, false, false,
+    true, true, true, true, false, false, true, true, true, true, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    true, true, true, true, true, false, true, true, true, true, true, false,
+    true, true, true, true, true, false, true, true, true, true, true, false,
+    true, true, true, true, true, false, true, true, true, true, true, true,
+    true, true, true, true, false, false, true, true, true, true, true, true,
+    true, true, true, true, false, false, true, true, true, true, true, true,
+    true, true, true, true, false, false, true, true, true, true, true, true,
+    true, true, true, true, false, false, true, true, true, true, true, true,
+    true, true, true, true, false, false, true, true, true, true, false, true,
+    true, true, true, false, true, true, true, true, false, true, true, true,
+    true, false, true, true, true, true, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, false,
+    false, false, false, false, false, false, false, false, false, false, false, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true, true, true,
+    true, true, true, true, true, true, true, true, true, true
+};
 
 #endif  // NEJ_EMOJI_DATA_H
@@ -0,0 +1,618 @@
+#include "file_io.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>  // For rename and renameat2
+#include <deque>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <utility>  // For std::exchange
+
+FileDescriptor::~FileDescriptor() { close(); }
+
+FileDescriptor::FileDescriptor(FileDescriptor&& other) noexcept
+    : fd_(std::exchange(other.fd_, -1)) {}
+
+auto FileDescriptor::operator=(FileDescriptor&& other) noexcept -> FileDescriptor& {
+    if (this != &other) {
+        close();
+        fd_ = std::exchange(other.fd_, -1);
+    }
+    return *this;
+}
+
+auto FileDescriptor::close() -> bool {
+    if (fd_ < 0) {
+        return true;
+    }
+    return ::close(std::exchange(fd_, -1)) == 0;
+}
+
+MappedFile::~MappedFile() {
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+    }
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile& {
+    if (this != &other) {
+        if (data_ != nullptr) {
+            munmap(data_, size_);
+        }
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+auto MappedFile::map(int fd, size_t size) -> MappedFile {
+    MappedFile mapped;
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+        return mapped;
+    }
+    madvise(data, size, MADV_SEQUENTIAL);
+    mapped.data_ = data;
+    mapped.size_ = size;
+    return mapped;
+}
+
+// Function to write all of `data` to `fd`
+auto writeAll(int fd, std::string_view data) -> bool {
+    while (!data.empty()) {
+        ssize_t written = ::write(fd, data.data(), data.size());
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data.remove_prefix(static_cast<size_t>(written));
+    }
+    return true;
+}
+
+namespace {
+
+// Feeds `chunk` to `filter` and hands the processed bytes to `write`. The leading bytes the filter
+// would pass through unchanged are handed over straight from `chunk`, so clean input is never
+// copied into `processed`.
+template <typename Write>
+auto feedPassingThrough(std::string_view chunk, EmojiStreamFilter& filter, std::string& processed,
+                        Write write) -> bool {
+    size_t unchanged = filter.unchangedPrefix(chunk);
+    if (unchanged > 0 && !write(chunk.substr(0, unchanged))) {
+        return false;
+    }
+    processed.clear();
+    if (unchanged < chunk.size()) {
+        filter.feed(chunk.substr(unchanged), &processed);
+    }
+    return processed.empty() || write(std::string_view(processed));
+}
+
+}  // namespace
+
+// Function to stream a file descriptor through an EmojiStreamFilter
+auto filterDescriptor(int input_fd, int output_fd, EmojiStreamFilter& filter) -> bool {
+    std::string block(IO_BLOCK_SIZE, '\0');
+    std::string processed_block;
+    auto write = [output_fd](std::string_view processed) { return writeAll(output_fd, processed); };
+
+    while (true) {
+        ssize_t bytes_read = ::read(input_fd, block.data(), block.size());
+        if (bytes_read < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+
+        std::string_view chunk(block.data(), static_cast<size_t>(bytes_read));
+        if (bytes_read == 0) {
+            processed_block.clear();
+            filter.finish(output_fd >= 0 ? &processed_block : nullptr);
+            return output_fd < 0 || writeAll(output_fd, processed_block);
+        }
+        if (output_fd < 0) {
+            filter.feed(chunk, nullptr);
+        } else if (!feedPassingThrough(chunk, filter, processed_block, write)) {
+            return false;
+        }
+    }
+}
+
+// Function to copy the start of a file to another file
+auto copyPrefix(int input_fd, int output_fd, std::string_view prefix) -> bool {
+    size_t copied = 0;
+#ifdef __linux__
+    auto input_offset = static_cast<off_t>(0);
+    while (copied < prefix.size()) {
+        ssize_t result =
+            copy_file_range(input_fd, &input_offset, output_fd, nullptr, prefix.size() - copied, 0);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            // Unsupported across these files, or the input shrank: write the rest from memory
+            break;
+        }
+        copied += static_cast<size_t>(result);
+    }
+#else
+    (void)input_fd;
+#endif
+    return writeAll(output_fd, prefix.substr(copied));
+}
+
+namespace {
+
+// Feeds `input` to `filter` in IO_BLOCK_SIZE slices and hands each processed slice to `write`, so
+// the output buffer stays at one block however large the input is. Only counts if `count_only`.
+// With `pass_through`, bytes the filter would leave unchanged are handed over straight from
+// `input`; that is not possible when the output overwrites `input` itself.
+template <typename Write>
+auto feedSlices(std::string_view input, EmojiStreamFilter& filter, bool count_only,
+                bool pass_through, Write write) -> bool {
+    std::string processed_block;
+    std::string* processed = count_only ? nullptr : &processed_block;
+
+    for (size_t pos = 0; pos < input.size(); pos += IO_BLOCK_SIZE) {
+        std::string_view slice = input.substr(pos, IO_BLOCK_SIZE);
+        if (pass_through && !count_only) {
+            if (!feedPassingThrough(slice, filter, processed_block, write)) {
+                return false;
+            }
+            continue;
+        }
+        processed_block.clear();
+        filter.feed(slice, processed);
+        if (!count_only && !write(std::string_view(processed_block))) {
+            return false;
+        }
+    }
+    processed_block.clear();
+    filter.finish(processed);
+    return count_only || write(std::string_view(processed_block));
+}
+
+// Writes all of `data` to `fd` at `offset`, retrying after partial writes and interrupts
+auto writeAllAt(int fd, std::string_view data, off_t offset) -> bool {
+    while (!data.empty()) {
+        ssize_t written = pwrite(fd, data.data(), data.size(), offset);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data.remove_prefix(static_cast<size_t>(written));
+        offset += written;
+    }
+    return true;
+}
+
+}  // namespace
+
+// Function to run an in-memory input through an EmojiStreamFilter
+auto filterBuffer(std::string_view input, int output_fd, EmojiStreamFilter& filter) -> bool {
+    return feedSlices(input, filter, output_fd < 0, true, [output_fd](std::string_view processed) {
+        return writeAll(output_fd, processed);
+    });
+}
+
+namespace {
+
+// Output of one chunk: its first `unchanged_size` bytes as they are, followed by `text`
+struct ChunkOutput {
+    size_t unchanged_size = 0;
+    std::string text;
+    uint64_t removed_emoji_count = 0;
+};
+
+// One chunk of a larger input, processed by whichever thread claims it first: a thread it was
+// handed to, or the thread that writes the output once it needs the chunk
+class ChunkTask {
+   public:
+    ChunkTask(std::string_view text, MatchEngine engine, bool count_only)
+        : text_(text), engine_(engine), count_only_(count_only) {}
+
+    [[nodiscard]] auto output() -> std::future<ChunkOutput> { return output_.get_future(); }
+    [[nodiscard]] auto text() const -> std::string_view { return text_; }
+
+    // Processes the chunk unless another thread already claimed it. Returns false in that case.
+    auto tryRun() -> bool {
+        if (claimed_.exchange(true)) {
+            return false;
+        }
+        // Chunks end where findSafeSplit allows, so each one is final on its own
+        ChunkOutput output;
+        BlockResult result;
+        if (count_only_) {
+            result = countEmojisInBlock(text_, true, engine_);
+        } else {
+            output.unchanged_size = findUnchangedPrefix(text_, true, engine_);
+            result = removeEmojisFromBlock(text_.substr(output.unchanged_size), true, output.text,
+                                           engine_);
+        }
+        output.removed_emoji_count = result.removed_emoji_count;
+        output_.set_value(std::move(output));
+        return true;
+    }
+
+   private:
+    std::string_view text_;
+    MatchEngine engine_;
+    bool count_only_;
+    std::atomic<bool> claimed_{false};
+    std::promise<ChunkOutput> output_;
+};
+
+}  // namespace
+
+auto filterBufferParallel(std::string_view input, int output_fd, MatchEngine engine,
+                          unsigned int jobs, uint64_t& removed_emoji_count,
+                          const TaskSubmitter& submit) -> bool {
+    if (jobs <= 1 || input.size() <= PARALLEL_CHUNK_SIZE) {
+        EmojiStreamFilter filter(engine);
+        bool processed = filterBuffer(input, output_fd, filter);
+        removed_emoji_count += filter.removedEmojiCount();
+        return processed;
+    }
+
+    // Without a submitter each chunk gets a thread of its own, joined once the chunk is written. A
+    // chunk that cannot get one is left to this thread.
+    std::deque<std::future<void>> spawned;
+    TaskSubmitter spawn = [&spawned](std::function<void()> task) {
+        try {
+            spawned.push_back(std::async(std::launch::async, std::move(task)));
+        } catch (const std::system_error&) {
+            spawned.emplace_back();
+        }
+    };
+    const TaskSubmitter& share = submit ? submit : spawn;
+
+    // Up to `jobs` chunks are handed out ahead of the one being written
+    struct PendingChunk {
+        std::shared_ptr<ChunkTask> task;
+        std::future<ChunkOutput> output;
+    };
+    std::deque<PendingChunk> in_flight;
+    size_t next_begin = 0;
+    auto submitNext = [&]() {
+        size_t end = findSafeSplit(input, std::min(next_begin + PARALLEL_CHUNK_SIZE, input.size()));
+        auto task = std::make_shared<ChunkTask>(input.substr(next_begin, end - next_begin), engine,
+                                                output_fd < 0);
+        in_flight.push_back({task, task->output()});
+        share([task] { task->tryRun(); });
+        next_begin = end;
+    };
+    while (next_begin < input.size() && in_flight.size() < jobs) {
+        submitNext();
+    }
+
+    int saved_errno = 0;
+    while (!in_flight.empty()) {
+        PendingChunk chunk = std::move(in_flight.front());
+        in_flight.pop_front();
+        if (!chunk.task->tryRun()) {
+            // Another thread is on it; take a later chunk rather than wait idle
+            for (auto& later : in_flight) {
+                if (later.task->tryRun()) {
+                    break;
+                }
+            }
+        }
+        ChunkOutput output = chunk.output.get();
+        if (!spawned.empty()) {
+            spawned.pop_front();  // Joins the thread the chunk was handed to
+        }
+
+        // After a failed write the chunks already handed out are still claimed and waited for,
+        // since the threads they went to may otherwise touch the input after this returns
+        if (saved_errno != 0) {
+            continue;
+        }
+        if (output_fd >= 0 &&
+            (!writeAll(output_fd, chunk.task->text().substr(0, output.unchanged_size)) ||
+             !writeAll(output_fd, output.text))) {
+            saved_errno = errno;
+            continue;
+        }
+        removed_emoji_count += output.removed_emoji_count;
+        if (next_begin < input.size()) {
+            submitNext();
+        }
+    }
+    if (saved_errno != 0) {
+        errno = saved_errno;
+        return false;
+    }
+    return true;
+}
+
+auto InputFile::open(const char* path) -> bool {
+    fd_ = FileDescriptor(::open(path, O_RDONLY | O_CLOEXEC));
+    if (!fd_.isOpen() || fstat(fd_.get(), &status_) != 0) {
+        return false;
+    }
+    if (S_ISDIR(status_.st_mode)) {
+        errno = EISDIR;
+        return false;
+    }
+
+    if (S_ISREG(status_.st_mode) && status_.st_size > 0) {
+        mapped_ = MappedFile::map(fd_.get(), static_cast<size_t>(status_.st_size));
+        if (mapped_.isMapped()) {
+            return true;
+        }
+    }
+
+    head_block_.resize(IO_BLOCK_SIZE);
+    ssize_t bytes_read = 0;
+    do {
+        bytes_read = ::read(fd_.get(), head_block_.data(), head_block_.size());
+    } while (bytes_read < 0 && errno == EINTR);
+    if (bytes_read < 0) {
+        return false;
+    }
+    head_block_.resize(static_cast<size_t>(bytes_read));
+    return true;
+}
+
+auto InputFile::head() const -> std::string_view {
+    return mapped_.isMapped() ? mapped_.view() : std::string_view(head_block_);
+}
+
+auto InputFile::firstChangeOffset(MatchEngine engine) const -> size_t {
+    if (mapped_.isMapped()) {
+        return findFirstChange(mapped_.view(), engine);
+    }
+    if (S_ISREG(status_.st_mode) && status_.st_size == 0) {
+        return std::string_view::npos;
+    }
+    return 0;
+}
+
+auto InputFile::filterFrom(size_t offset, int output_fd, EmojiStreamFilter& filter) -> bool {
+    if (offset == 0) {
+        return this->filter(output_fd, filter);
+    }
+    // Only mapped files report a non-zero first change
+    std::string_view content = mapped_.view();
+    return copyPrefix(fd_.get(), output_fd, content.substr(0, offset)) &&
+           filterBuffer(content.substr(offset), output_fd, filter);
+}
+
+auto InputFile::filterParallelFrom(size_t offset, int output_fd, MatchEngine engine,
+                                   unsigned int jobs, uint64_t& removed_emoji_count,
+                                   const TaskSubmitter& submit) -> bool {
+    if (!mapped_.isMapped()) {
+        errno = ENOTSUP;
+        return false;
+    }
+    std::string_view content = mapped_.view();
+    if (offset > 0 && !copyPrefix(fd_.get(), output_fd, content.substr(0, offset))) {
+        return false;
+    }
+    return filterBufferParallel(content.substr(offset), output_fd, engine, jobs,
+                                removed_emoji_count, submit);
+}
+
+auto InputFile::filter(int output_fd, EmojiStreamFilter& filter) -> bool {
+    if (mapped_.isMapped()) {
+        return filterBuffer(mapped_.view(), output_fd, filter);
+    }
+
+    // The head was already read from the stream, so process it before the rest
+    std::string processed_head;
+    if (output_fd < 0) {
+        filter.feed(head_block_, nullptr);
+    } else if (!feedPassingThrough(head_block_, filter, processed_head,
+                                   [output_fd](std::string_view processed) {
+                                       return writeAll(output_fd, processed);
+                                   })) {
+        return false;
+    }
+    return filterDescriptor(fd_.get(), output_fd, filter);
+}
+
+auto InputFile::compactFrom(const char* path, size_t offset, EmojiStreamFilter& filter) -> bool {
+    if (!mapped_.isMapped()) {
+        errno = ENOTSUP;
+        return false;
+    }
+
+    // Reopen for writing and make sure the path still names the file that was scanned
+    FileDescriptor writable(::open(path, O_WRONLY | O_CLOEXEC));
+    struct stat writable_status {};
+    if (!writable.isOpen() || fstat(writable.get(), &writable_status) != 0) {
+        return false;
+    }
+    if (writable_status.st_dev != status_.st_dev || writable_status.st_ino != status_.st_ino) {
+        errno = ESTALE;
+        return false;
+    }
+
+    // Output never outgrows the input it came from, so every write lands on bytes the filter has
+    // already read from the mapping
+    auto write_offset = static_cast<off_t>(offset);
+    bool written = feedSlices(mapped_.view().substr(offset), filter, false, false,
+                              [&](std::string_view processed) {
+                                  if (!writeAllAt(writable.get(), processed, write_offset)) {
+                                      return false;
+                                  }
+                                  write_offset += static_cast<off_t>(processed.size());
+                                  return true;
+                              });
+    return written && ftruncate(writable.get(), write_offset) == 0 && writable.close();
+}
+
+namespace {
+
+// Builds a name next to `target` that no other run is using, from the PID, a timestamp and a
+// counter shared by all threads
+auto temporaryPathFor(const std::string& target) -> std::string {
+    static std::atomic<int> file_counter{0};
+    auto timestamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    return target + "." + std::to_string(getpid()) + "." + std::to_string(timestamp) + "." +
+           std::to_string(++file_counter) + ".nej_tmp";
+}
+
+#if defined(__linux__) && defined(O_TMPFILE)
+// Set once an anonymous file could not be linked for lack of /proc, so that later replacements
+// start out as named temporary files
+std::atomic<bool> anonymous_links_unavailable{false};
+
+// Gives the anonymous file behind `fd` the name `path`. linkat with AT_EMPTY_PATH needs
+// CAP_DAC_READ_SEARCH; linking through /proc needs no privileges, but needs /proc to be mounted.
+// Fails with ENOENT if neither works.
+auto linkAnonymous(int fd, const std::string& path) -> bool {
+    if (linkat(fd, "", AT_FDCWD, path.c_str(), AT_EMPTY_PATH) == 0) {
+        return true;
+    }
+    std::string proc_path = "/proc/self/fd/" + std::to_string(fd);
+    return linkat(AT_FDCWD, proc_path.c_str(), AT_FDCWD, path.c_str(), AT_SYMLINK_FOLLOW) == 0;
+}
+
+// Copies everything in `input_fd`, from its start, to the current position of `output_fd`
+auto copyContent(int input_fd, int output_fd) -> bool {
+    auto input_offset = static_cast<off_t>(0);
+    while (true) {
+        ssize_t result = copy_file_range(input_fd, &input_offset, output_fd, nullptr,
+                                         IO_BLOCK_SIZE, 0);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result == 0) {
+            return true;
+        }
+        if (result < 0) {
+            break;  // Unsupported across these files: copy through memory from where it stopped
+        }
+    }
+
+    std::string block(IO_BLOCK_SIZE, '\0');
+    while (true) {
+        ssize_t bytes_read = pread(input_fd, block.data(), block.size(), input_offset);
+        if (bytes_read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytes_read <= 0) {
+            return bytes_read == 0;
+        }
+        if (!writeAll(output_fd, std::string_view(block.data(), static_cast<size_t>(bytes_read)))) {
+            return false;
+        }
+        input_offset += bytes_read;
+    }
+}
+#endif
+
+}  // namespace
+
+ReplacementFile::~ReplacementFile() {
+    if (!temp_path_.empty()) {
+        unlink(temp_path_.c_str());
+    }
+}
+
+auto ReplacementFile::open(const std::string& target) -> bool {
+    target_ = target;
+#if defined(__linux__) && defined(O_TMPFILE)
+    // Opened for reading too, so the content can still be copied out if it cannot be linked
+    std::string directory = std::filesystem::path(target).parent_path().string();
+    if (!anonymous_links_unavailable) {
+        fd_ = FileDescriptor(::open(directory.empty() ? "." : directory.c_str(),
+                                    O_TMPFILE | O_RDWR | O_CLOEXEC, 0666));
+        if (fd_.isOpen()) {
+            return true;
+        }
+    }
+    // Kernels and file systems without O_TMPFILE support get a named temporary file instead
+#endif
+    temp_path_ = temporaryPathFor(target);
+    fd_ = FileDescriptor(::open(temp_path_.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0666));
+    if (!fd_.isOpen()) {
+        temp_path_.clear();
+        return false;
+    }
+    return true;
+}
+
+auto ReplacementFile::commit(const std::string& backup_path) -> bool {
+#if defined(__linux__) && defined(O_TMPFILE)
+    if (temp_path_.empty()) {
+        // With a backup, the output is linked in under the backup name so that one exchange puts
+        // it in place and the original under the backup name
+        std::string name = backup_path.empty() ? temporaryPathFor(target_) : backup_path;
+        if (linkAnonymous(fd_.get(), name)) {
+            temp_path_ = name;
+        } else if (errno == ENOENT) {
+            // No /proc: copy the output to a named temporary file and replace the target with that
+            anonymous_links_unavailable = true;
+            temp_path_ = temporaryPathFor(target_);
+            FileDescriptor named(
+                ::open(temp_path_.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0666));
+            if (!named.isOpen()) {
+                temp_path_.clear();
+                return false;
+            }
+            if (!copyContent(fd_.get(), named.get())) {
+                return false;
+            }
+            fd_ = std::move(named);
+        } else {
+            return false;
+        }
+        if (!backup_path.empty() && temp_path_ == backup_path) {
+            if (!fd_.close()) {
+                return false;
+            }
+#ifdef RENAME_EXCHANGE
+            if (renameat2(AT_FDCWD, target_.c_str(), AT_FDCWD, backup_path.c_str(),
+                          RENAME_EXCHANGE) == 0) {
+                temp_path_.clear();
+                return true;
+            }
+            if (errno != EINVAL && errno != ENOSYS) {
+                return false;
+            }
+#endif
+            // No exchange on this file system: move the output aside and rename one at a time
+            std::string temp_path = temporaryPathFor(target_);
+            if (std::rename(backup_path.c_str(), temp_path.c_str()) != 0) {
+                return false;
+            }
+            temp_path_ = temp_path;
+        }
+    }
+#endif
+    if (!fd_.close()) {
+        return false;
+    }
+    if (!backup_path.empty() && std::rename(target_.c_str(), backup_path.c_str()) != 0) {
+        return false;
+    }
+    if (std::rename(temp_path_.c_str(), target_.c_str()) != 0) {
+        int saved_errno = errno;
+        if (!backup_path.empty()) {
+            std::rename(backup_path.c_str(), target_.c_str());
+        }
+        errno = saved_errno;
+        return false;
+    }
+    temp_path_.clear();
+    return true;
+}
@@ -0,0 +1,179 @@
+#ifndef NEJ_FILE_IO_H
+#define NEJ_FILE_IO_H
+
+#include <sys/stat.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "core.h"
+
+// Size of each read when streaming input through the engine
+constexpr size_t IO_BLOCK_SIZE = 1 << 20;  // 1 MiB
+
+// Approximate size of the pieces a large input is cut into for processing on several threads
+constexpr size_t PARALLEL_CHUNK_SIZE = 8 * IO_BLOCK_SIZE;
+
+// Hands a task to another thread, such as an idle worker of a pool. The task may also be run, or
+// never be run, anywhere else; see filterBufferParallel.
+using TaskSubmitter = std::function<void(std::function<void()>)>;
+
+// Owns a POSIX file descriptor and closes it when destroyed
+class FileDescriptor {
+   public:
+    FileDescriptor() = default;
+    explicit FileDescriptor(int fd) : fd_(fd) {}
+    ~FileDescriptor();
+
+    FileDescriptor(const FileDescriptor&) = delete;
+    auto operator=(const FileDescriptor&) -> FileDescriptor& = delete;
+    FileDescriptor(FileDescriptor&& other) noexcept;
+    auto operator=(FileDescriptor&& other) noexcept -> FileDescriptor&;
+
+    [[nodiscard]] auto get() const -> int { return fd_; }
+    [[nodiscard]] auto isOpen() const -> bool { return fd_ >= 0; }
+
+    // Closes the descriptor now, returning false if close() reported an error
+    auto close() -> bool;
+
+   private:
+    int fd_ = -1;
+};
+
+// Read-only memory mapping of a whole file, unmapped when destroyed
+class MappedFile {
+   public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    auto operator=(const MappedFile&) -> MappedFile& = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+
+    // Maps the first `size` bytes of `fd` and advises the kernel that they will be read
+    // sequentially. Returns an unmapped object if mmap fails.
+    static auto map(int fd, size_t size) -> MappedFile;
+
+    [[nodiscard]] auto isMapped() const -> bool { return data_ != nullptr; }
+    [[nodiscard]] auto view() const -> std::string_view {
+        return {static_cast<const char*>(data_), size_};
+    }
+
+   private:
+    void* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// A file opened for processing with a single open and fstat. Non-empty regular files are mapped;
+// anything else is read in blocks. The first block is available through head() before processing
+// starts, so it can be checked for binary content without opening or reading the file twice.
+class InputFile {
+   public:
+    // Opens `path` and loads its head. Returns false with errno set on failure; directories fail
+    // with EISDIR.
+    auto open(const char* path) -> bool;
+
+    [[nodiscard]] auto status() const -> const struct stat& { return status_; }
+    [[nodiscard]] auto head() const -> std::string_view;
+    [[nodiscard]] auto isMapped() const -> bool { return mapped_.isMapped(); }
+
+    // Whole content of a mapped file; empty for anything else
+    [[nodiscard]] auto content() const -> std::string_view { return mapped_.view(); }
+
+    // Offset of the first byte processing would change, or std::string_view::npos if the output
+    // would be identical to the input. Only mapped and empty files can be checked up front;
+    // for anything else this conservatively returns 0.
+    [[nodiscard]] auto firstChangeOffset(MatchEngine engine) const -> size_t;
+
+    // Runs the whole content through `filter`, writing to `output_fd` as filterDescriptor does
+    auto filter(int output_fd, EmojiStreamFilter& filter) -> bool;
+
+    // Copies the first `offset` bytes to `output_fd` unchanged, in the kernel where possible, and
+    // runs the rest through `filter`. `offset` must come from firstChangeOffset.
+    auto filterFrom(size_t offset, int output_fd, EmojiStreamFilter& filter) -> bool;
+
+    // Like filterFrom, but runs the content after `offset` through filterBufferParallel on up to
+    // `jobs` threads. Only mapped files can be processed this way.
+    auto filterParallelFrom(size_t offset, int output_fd, MatchEngine engine, unsigned int jobs,
+                            uint64_t& removed_emoji_count, const TaskSubmitter& submit = nullptr)
+        -> bool;
+
+    // Rewrites the file at `path`, which must be the file this object opened, in place: the
+    // processed content from `offset` on is written over the original starting at that same
+    // offset and the file is truncated to the new length. Needs no temporary file or extra disk
+    // space, but is not atomic; an interruption leaves a partly rewritten file. Only mapped files
+    // can be compacted. `offset` must come from firstChangeOffset.
+    auto compactFrom(const char* path, size_t offset, EmojiStreamFilter& filter) -> bool;
+
+   private:
+    FileDescriptor fd_;
+    struct stat status_ {};
+    MappedFile mapped_;
+    std::string head_block_;  // First block, when the file is read rather than mapped
+};
+
+// Output that replaces a target file once it is complete. On Linux it starts as an anonymous
+// O_TMPFILE in the target's directory and only gets a name when committed, so a run that is
+// interrupted leaves nothing behind. Where O_TMPFILE is not available it is a uniquely named
+// temporary file next to the target. Output that is never committed is discarded on destruction.
+class ReplacementFile {
+   public:
+    ReplacementFile() = default;
+    ~ReplacementFile();
+
+    ReplacementFile(const ReplacementFile&) = delete;
+    auto operator=(const ReplacementFile&) -> ReplacementFile& = delete;
+
+    // Creates the output in the directory of `target`. Returns false with errno set on failure.
+    auto open(const std::string& target) -> bool;
+
+    [[nodiscard]] auto get() const -> int { return fd_.get(); }
+
+    // Closes the output and moves it over the target. With a non-empty `backup_path`, which must
+    // not exist yet, the original is kept under that name; when the output is anonymous and the
+    // file system supports it, the two are swapped with a single renameat2(RENAME_EXCHANGE).
+    // Returns false with errno set on failure, leaving the target as it was.
+    auto commit(const std::string& backup_path) -> bool;
+
+   private:
+    FileDescriptor fd_;
+    std::string target_;
+    std::string temp_path_;  // Name the output has while it is not committed, if any
+};
+
+// Function to write all of `data` to `fd`, retrying after partial writes and interrupts
+auto writeAll(int fd, std::string_view data) -> bool;
+
+// Function to stream everything readable from `input_fd` through `filter` with large unbuffered
+// reads, writing the processed bytes to `output_fd`, or only counting if `output_fd` is negative.
+// Returns false with errno set if a read or write fails.
+auto filterDescriptor(int input_fd, int output_fd, EmojiStreamFilter& filter) -> bool;
+
+// Function to copy `prefix`, which holds the first bytes of `input_fd`, to the current position of
+// `output_fd`. On Linux copy_file_range lets the kernel copy the data, or the filesystem share it
+// by reflinking; elsewhere, or when that is not supported between the two files, the bytes are
+// written from memory.
+auto copyPrefix(int input_fd, int output_fd, std::string_view prefix) -> bool;
+
+// Function to run an in-memory input through `filter` in IO_BLOCK_SIZE slices, writing the
+// processed bytes to `output_fd`, or only counting if `output_fd` is negative
+auto filterBuffer(std::string_view input, int output_fd, EmojiStreamFilter& filter) -> bool;
+
+// Function to run an in-memory input through the engine on up to `jobs` threads. The input is cut
+// into chunks of about PARALLEL_CHUNK_SIZE where findSafeSplit allows, the chunks are processed
+// independently, and their outputs are written to `output_fd` in input order, or only counted if
+// `output_fd` is negative. No more than `jobs` + 1 chunk outputs are held at once, however slowly
+// the output drains. Adds the number of removed emojis to `removed_emoji_count`.
+//
+// Each chunk is handed to `submit` as a task, or to a thread of its own if `submit` is empty. The
+// calling thread processes any chunk that no other thread has started by the time it needs it,
+// so tasks may run late or not at all; once this returns, running one does nothing.
+auto filterBufferParallel(std::string_view input, int output_fd, MatchEngine engine,
+                          unsigned int jobs, uint64_t& removed_emoji_count,
+                          const TaskSubmitter& submit = nullptr) -> bool;
+
+#endif  // NEJ_FILE_IO_H
@@ -1,44 +1,85 @@
 #include <algorithm>
-#include <chrono>
+#include <cerrno>
+#include <charconv>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <sstream>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <vector>
 #include <functional>
 
-#ifdef _WIN32
-#include <process.h>
-#else
+#include <sys/stat.h>
 #include <unistd.h>
-#endif
 
+#include "clean_cache.h"
 #include "core.h"
+#include "directory_walk.h"
+#include "file_io.h"
 
 namespace fs = std::filesystem;
 
 void show_help(const char* program_name) {
     std::cout << "Nej - No EmoJis: A command-line tool for removing emojis from text files\n\n";
-    std::cout << "Usage: " << program_name << " [OPTIONS] FILES...\n\n";
+    std::cout << "Usage: " << program_name << " [OPTIONS] [FILES...]\n\n";
     std::cout << "Arguments:\n";
-    std::cout << "  FILES                    Input text files to process\n\n";
+    std::cout << "  FILES                    Input text files to process; '-' or no files reads\n";
+    std::cout << "                           standard input and writes standard output\n\n";
     std::cout << "Options:\n";
     std::cout << "  -i, --in-place          Perform in-place editing with no backup\n";
     std::cout << "  --backup-ext EXT        Backup extension for in-place editing (e.g., .bak)\n";
+    std::cout << "  --compact               With -i and no backup, rewrite files directly\n";
+    std::cout << "                          instead of through a temporary file (not atomic)\n";
+    std::cout << "  -r, --recursive         Process the files in directories and below; with no\n";
+    std::cout << "                          files, the current directory\n";
+    std::cout << "  --include GLOB          With -r, only process files matching GLOB\n";
+    std::cout << "  --exclude GLOB          With -r, skip files and directories matching GLOB;\n";
+    std::cout << "                          both can be given more than once\n";
+    std::cout << "  --files-from FILE       Also process the paths listed in FILE, one per line;\n";
+    std::cout << "                          '-' reads the list from standard input\n";
+    std::cout << "  -0, --null              Paths in the --files-from list end with NUL bytes\n";
     std::cout << "  --dry-run               Report changes without modifying files\n";
+    std::cout << "  --cache FILE            With -i or --dry-run, remember in FILE which files\n";
+    std::cout << "                          are clean and skip them while they are unchanged\n";
+    std::cout << "  --engine NAME           Matching engine: codepoint (default) or byte\n";
+    std::cout << "  -j, --jobs N            Use up to N threads for separate files and for the\n";
+    std::cout << "                          pieces of large files; output to stdout stays in\n";
+    std::cout << "                          argument order\n";
     std::cout << "  -h, --help              Show this help message and exit\n\n";
     std::cout << "Examples:\n";
     std::cout << "  " << program_name << " file.txt                    # Output to stdout\n";
     std::cout << "  " << program_name << " -i file.txt                 # In-place, no backup\n";
     std::cout << "  " << program_name << " -i --backup-ext .bak file.txt  # In-place with backup\n";
     std::cout << "  " << program_name << " --dry-run *.txt             # Preview changes\n";
+    std::cout << "  " << program_name << " -j 8 -i.bak docs/*.md         # Eight files at a time\n";
+    std::cout << "  " << program_name << " -r -i.bak --include '*.md' docs  # Sweep a tree\n";
+    std::cout << "  git ls-files -z | " << program_name << " -0 --files-from - -i  # From a list\n";
+    std::cout << "  tail -f app.log | " << program_name << "              # Filter a pipe\n";
 }
 
 struct Arguments {
     std::vector<std::string> files;
     bool in_place = false;
     std::string backup_extension;
+    bool compact = false;
+    bool recursive = false;
+    WalkFilter walk_filter;
+    std::string files_from;
+    bool null_separated = false;
     bool dry_run = false;
+    std::string cache_path;
+    MatchEngine engine = MatchEngine::CodePoint;
+    unsigned int jobs = 1;
     bool help = false;
 };
 
@@ -71,9 +112,68 @@ Arguments parse_arguments(int argc, char** argv) {
                 std::cerr << "Error: --backup-ext requires an argument\n";
                 exit(1);
             }
+        } else if (arg == "--compact") {
+            args.compact = true;
+        } else if (arg == "-r" || arg == "--recursive") {
+            args.recursive = true;
+        } else if (arg == "--files-from") {
+            if (i + 1 < argc) {
+                args.files_from = argv[++i];
+            } else {
+                std::cerr << "Error: --files-from requires an argument\n";
+                exit(1);
+            }
+        } else if (arg == "-0" || arg == "--null") {
+            args.null_separated = true;
+        } else if (arg == "--include" || arg == "--exclude") {
+            if (i + 1 < argc) {
+                auto& patterns =
+                    arg == "--include" ? args.walk_filter.include : args.walk_filter.exclude;
+                patterns.emplace_back(argv[++i]);
+            } else {
+                std::cerr << "Error: " << arg << " requires an argument\n";
+                exit(1);
+            }
         } else if (arg == "--dry-run") {
             args.dry_run = true;
-        } else if (!arg.empty() && arg[0] == '-') {
+        } else if (arg == "--cache") {
+            if (i + 1 < argc) {
+                args.cache_path = argv[++i];
+            } else {
+                std::cerr << "Error: --cache requires an argument\n";
+                exit(1);
+            }
+        } else if (arg == "--engine") {
+            if (i + 1 < argc) {
+                std::string engine = argv[++i];
+                if (engine == "codepoint") {
+                    args.engine = MatchEngine::CodePoint;
+                } else if (engine == "byte") {
+                    args.engine = MatchEngine::Byte;
+                } else {
+                    std::cerr << "Error: Unknown engine '" << engine
+                              << "' (expected 'codepoint' or 'byte')\n";
+                    exit(1);
+                }
+            } else {
+                std::cerr << "Error: --engine requires an argument\n";
+                exit(1);
+            }
+        } else if (arg == "-j" || arg == "--jobs") {
+            if (i + 1 < argc) {
+                std::string jobs = argv[++i];
+                const char* end = jobs.data() + jobs.size();
+                auto result = std::from_chars(jobs.data(), end, args.jobs);
+                if (result.ec != std::errc() || result.ptr != end || args.jobs == 0) {
+                    std::cerr << "Error: Invalid number of jobs '" << jobs
+                              << "' (expected a positive integer)\n";
+                    exit(1);
+                }
+            } else {
+                std::cerr << "Error: " << arg << " requires an argument\n";
+                exit(1);
+            }
+        } else if (arg.size() > 1 && arg[0] == '-') {  // A lone '-' means standard input
             std::cerr << "Error: Unknown option '" << arg << "'\n";
             std::cerr << "Try '" << argv[0] << " --help' for more information.\n";
             exit(1);
@@ -85,169 +185,651 @@ Arguments parse_arguments(int argc, char** argv) {
     return args;
 }
 
-auto main(int argc, char** argv) noexcept -> int {
-    Arguments args = parse_arguments(argc, argv);
-    
-    if (args.help) {
-        show_help(argv[0]);
-        return 0;
+// Processed bytes go to the temporary file in in-place mode, nowhere in dry-run mode (negative
+// descriptor, count only) and to standard output otherwise
+auto output_descriptor(const Arguments& args, const ReplacementFile& replacement) -> int {
+    if (args.in_place) {
+        return replacement.get();
     }
-    
-    if (args.files.empty()) {
-        std::cerr << "Error: No input files specified\n";
-        std::cerr << "Try '" << argv[0] << " --help' for more information.\n";
-        return 1;
+    return args.dry_run ? -1 : STDOUT_FILENO;
+}
+
+void report_dry_run(std::ostream& out, const fs::path& file_path, uint64_t removed_emoji_count) {
+    if (removed_emoji_count > 0) {
+        out << "File: " << file_path << ", Emojis removed: " << removed_emoji_count << "\n";
+    } else {
+        out << "File: " << file_path << ", No emojis found.\n";
     }
+}
 
-    for (const auto& file_path_str : args.files) {
-        fs::path file_path(file_path_str);
+// Reports and diagnostics for one file, collected while it is processed and written out in one
+// piece so that the lines of concurrent workers never interleave
+struct FileMessages {
+    std::ostringstream out;
+    std::ostringstream err;
+};
+
+void flush_messages(const FileMessages& messages) {
+    static std::mutex output_mutex;
+    std::lock_guard<std::mutex> lock(output_mutex);
+    std::cout << messages.out.str() << std::flush;
+    std::cerr << messages.err.str();
+}
 
-        if (!fs::exists(file_path)) {
-            std::cerr << "Error: File not found: " << file_path << '\n';
-            continue;
+void process_standard_input(const Arguments& args, FileMessages& messages) {
+    if (args.in_place) {
+        messages.err << "Error: Cannot edit standard input in place\n";
+        return;
+    }
+
+    EmojiStreamFilter filter(args.engine);
+    if (!filterDescriptor(STDIN_FILENO, args.dry_run ? -1 : STDOUT_FILENO, filter)) {
+        messages.err << "Error: Could not process standard input: " << std::strerror(errno)
+                     << "\n";
+        return;
+    }
+    if (args.dry_run) {
+        report_dry_run(messages.out, "-", filter.removedEmojiCount());
+    }
+}
+
+// Work for the worker threads: paths to process, and chunks of large files that are already being
+// processed. Chunks are handed out first, so idle workers help finish files under way before
+// starting new ones; that keeps one huge file from running on a single core at the end. Walks of
+// subdirectories come next, so the tree is read on every worker. With `largest_first`, each path
+// is stat'ed as it is queued and the largest file starts first; otherwise paths come out in the
+// order they were queued.
+class WorkQueue {
+   public:
+    // Either a path to process or a task to run: a chunk or a walk
+    struct Item {
+        std::string path;
+        std::function<void()> task;
+    };
+
+    explicit WorkQueue(bool largest_first) : largest_first_(largest_first) {}
+
+    void push(std::string path) {
+        uint64_t size = 0;
+        struct stat status {};
+        if (largest_first_ && stat(path.c_str(), &status) == 0) {
+            size = static_cast<uint64_t>(status.st_size);
         }
+        std::lock_guard<std::mutex> lock(mutex_);
+        paths_.push({size, next_sequence_++, std::move(path)});
+        ready_.notify_one();
+    }
+
+    void push_chunk(std::function<void()> chunk) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        chunks_.push_back(std::move(chunk));
+        ready_.notify_one();
+    }
+
+    // Queues the walk of a subdirectory. Workers take walks before paths, the most recent first so
+    // that few directories are held open at once, and keep waiting for paths until every walk
+    // has run.
+    void push_walk(std::function<void()> walk) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        walks_.push_back([this, walk = std::move(walk)] {
+            walk();
+            std::lock_guard<std::mutex> lock(mutex_);
+            --pending_walks_;
+            ready_.notify_all();
+        });
+        ++pending_walks_;
+        ready_.notify_one();
+    }
+
+    // Called once no more paths will be pushed, apart from those of walks already queued
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        ready_.notify_all();
+    }
+
+    // Bracket the processing of a file whose chunks are shared, so that workers keep waiting for
+    // its chunks even after the last path has been handed out
+    void begin_shared_file() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++shared_files_;
+    }
+
+    void end_shared_file() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --shared_files_;
+        ready_.notify_all();
+    }
+
+    // Waits for the next item; returns nothing once no more work can arrive
+    auto pop() -> std::optional<Item> {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait(lock, [this] {
+            return !chunks_.empty() || !walks_.empty() || !paths_.empty() ||
+                   (closed_ && shared_files_ == 0 && pending_walks_ == 0);
+        });
+        return take_item();
+    }
+
+    // Returns the next item if one is ready, without waiting
+    auto try_pop() -> std::optional<Item> {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return take_item();
+    }
 
-        if (isBinary(file_path)) {
-            std::cerr << "Warning: Skipping binary file: " << file_path << '\n';
-            continue;
+    // Hands chunks of a file to the workers
+    auto chunk_submitter() -> TaskSubmitter {
+        return [this](std::function<void()> chunk) { push_chunk(std::move(chunk)); };
+    }
+
+   private:
+    // Removes the next item, chunks first and then walks; called with the mutex held
+    auto take_item() -> std::optional<Item> {
+        Item item;
+        if (!chunks_.empty()) {
+            item.task = std::move(chunks_.front());
+            chunks_.pop_front();
+        } else if (!walks_.empty()) {
+            item.task = std::move(walks_.back());
+            walks_.pop_back();
+        } else if (!paths_.empty()) {
+            item.path = paths_.top().path;
+            paths_.pop();
+        } else {
+            return std::nullopt;
         }
+        return item;
+    }
 
-        std::ifstream infile(file_path);
-        if (!infile.is_open()) {
-            std::cerr << "Error: Could not open file for reading: " << file_path << '\n';
-            continue;
+    struct QueuedPath {
+        uint64_t size;
+        uint64_t sequence;
+        std::string path;
+
+        // Orders the priority queue so that the largest, then the earliest, path is on top
+        auto operator<(const QueuedPath& other) const -> bool {
+            return size != other.size ? size < other.size : sequence > other.sequence;
         }
+    };
 
-        infile.close();  // Close input file after isBinary check
+    const bool largest_first_;
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<std::function<void()>> chunks_;
+    std::vector<std::function<void()>> walks_;
+    std::priority_queue<QueuedPath> paths_;
+    uint64_t next_sequence_ = 0;
+    int shared_files_ = 0;
+    int pending_walks_ = 0;  // Walks queued or running
+    bool closed_ = false;
+};
 
-        std::string line;
-        int total_removed_emoji_count = 0;
-        std::ofstream temp_outfile;
-        fs::path temp_file_path;  // Declare here for broader scope
+// Opens `file_path` for processing, explaining in `messages` why not if it cannot be opened. One
+// open and fstat per file; nothing is read yet.
+auto open_input(const fs::path& file_path, InputFile& input, FileMessages& messages) -> bool {
+    if (!input.open(file_path.c_str())) {
+        if (errno == ENOENT) {
+            messages.err << "Error: File not found: " << file_path << '\n';
+        } else {
+            messages.err << "Error: Could not open file for reading: " << file_path << ": "
+                         << std::strerror(errno) << '\n';
+        }
+        return false;
+    }
+    return true;
+}
+
+// True if an opened file looks binary, in which case it is skipped with a warning. Looks at the
+// head of the same input that is processed afterwards.
+auto is_binary_input(const fs::path& file_path, const InputFile& input, FileMessages& messages)
+    -> bool {
+    if (isBinaryContent(input.head())) {
+        messages.err << "Warning: Skipping binary file: " << file_path << '\n';
+        return true;
+    }
+    return false;
+}
 
+// Processes an opened file, splitting a large mapped input across up to `chunk_jobs` threads. With
+// a `queue`, its workers process the chunks; otherwise each chunk gets a thread of its own. Files
+// found clean are recorded in `cache`, if there is one.
+void process_input(const Arguments& args, const fs::path& file_path, InputFile& input,
+                   unsigned int chunk_jobs, WorkQueue* queue, CleanCache* cache,
+                   FileMessages& messages) {
+    // A file without emojis or malformed bytes is left alone: no temporary file, no backup,
+    // and its inode and mtime stay untouched. Otherwise the untouched prefix is copied by the
+    // kernel and only the rest goes through userspace.
+    size_t first_change = 0;
+    if (args.in_place || cache != nullptr) {
+        size_t offset = input.firstChangeOffset(args.engine);
+        if (offset == std::string_view::npos) {
+            if (cache != nullptr) {
+                cache->recordClean(file_path.string(), input.status(), input.content());
+            }
+            if (args.dry_run) {
+                report_dry_run(messages.out, file_path, 0);
+            }
+            return;
+        }
         if (args.in_place) {
-            // Generate unique temporary filename with PID, timestamp and counter in same directory as
-            // original file
-            static int file_counter = 0;
-            auto timestamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
-#ifdef _WIN32
-            int pid = _getpid();
-#else
-            pid_t pid = getpid();
-#endif
-            std::string temp_filename = file_path.filename().string() + "." + std::to_string(pid) +
-                                        "." + std::to_string(timestamp) + "." + std::to_string(++file_counter) + ".nej_tmp";
-            temp_file_path = file_path.parent_path() / temp_filename;
-
-            temp_outfile.open(temp_file_path);
-            if (!temp_outfile.is_open()) {
-                std::cerr << "Error: Could not open temporary file for writing: " << temp_file_path
-                          << "\n";
-                continue;
+            first_change = offset;  // Dry runs only count, so they still scan the whole file
+        }
+    }
+
+    // Compaction overwrites the file from its first change on and truncates it, with no
+    // temporary file; files that are not mapped take the temporary file path below
+    if (args.in_place && args.compact && input.isMapped()) {
+        EmojiStreamFilter filter(args.engine);
+        if (!input.compactFrom(file_path.c_str(), first_change, filter)) {
+            messages.err << "Error: Could not rewrite " << file_path << " in place: "
+                         << std::strerror(errno) << "\n";
+        }
+        return;
+    }
+
+    // The output is an anonymous temporary file where supported, so an interrupted run
+    // leaves no stray files behind
+    ReplacementFile replacement;
+    if (args.in_place && !replacement.open(file_path.string())) {
+        messages.err << "Error: Could not create temporary file for " << file_path << ": "
+                     << std::strerror(errno) << "\n";
+        return;
+    }
+
+    // Newlines are ordinary bytes to the engine, so the output matches the input byte for
+    // byte apart from the replacements, including a missing final newline
+    int output_fd = output_descriptor(args, replacement);
+    uint64_t total_removed_emoji_count = 0;
+    bool processed = false;
+    if (chunk_jobs > 1 && input.isMapped()) {
+        if (queue != nullptr) {
+            queue->begin_shared_file();
+        }
+        processed = input.filterParallelFrom(
+            first_change, output_fd, args.engine, chunk_jobs, total_removed_emoji_count,
+            queue != nullptr ? queue->chunk_submitter() : TaskSubmitter());
+        if (queue != nullptr) {
+            queue->end_shared_file();
+        }
+    } else {
+        EmojiStreamFilter filter(args.engine);
+        processed = input.filterFrom(first_change, output_fd, filter);
+        total_removed_emoji_count = filter.removedEmojiCount();
+    }
+    if (!processed) {
+        messages.err << "Error: Could not process " << file_path << ": " << std::strerror(errno)
+                     << "\n";
+        return;  // The uncommitted output is discarded
+    }
+
+    if (args.in_place) {
+        fs::path backup_path;
+
+        // Keep the original under a backup name only if a backup extension is provided
+        if (!args.backup_extension.empty()) {
+            auto find_unique_backup_path = [](const fs::path& base_path,
+                                              const std::string& extension) -> fs::path {
+                std::function<fs::path(const fs::path&, const std::string&, int)> find_path =
+                    [&find_path](const fs::path& base, const std::string& ext,
+                                 int counter) -> fs::path {
+                    auto candidate = base;
+                    candidate += ext + (counter == 0 ? "" : std::to_string(counter));
+
+                    if (!fs::exists(candidate)) {
+                        return candidate;  // Base case
+                    }
+
+                    // Tail call - nothing happens after this return
+                    return find_path(base, ext, counter + 1);
+                };
+
+                return find_path(base_path, extension, 0);
+            };
+
+            backup_path = find_unique_backup_path(file_path, args.backup_extension);
+        }
+
+        if (!replacement.commit(backup_path.string())) {
+            messages.err << "Error: Could not replace " << file_path << ": "
+                         << std::strerror(errno) << "\n";
+            return;
+        }
+    }
+
+    if (args.dry_run) {
+        report_dry_run(messages.out, file_path, total_removed_emoji_count);
+    }
+}
+
+void process_file(const Arguments& args, const fs::path& file_path, unsigned int chunk_jobs,
+                  WorkQueue* queue, CleanCache* cache, FileMessages& messages) {
+    if (file_path == "-") {
+        process_standard_input(args, messages);
+        return;
+    }
+
+    InputFile input;
+    if (!open_input(file_path, input, messages)) {
+        return;
+    }
+    // A file the cache knows to be clean is skipped before any of it is read
+    if (cache != nullptr && cache->isClean(file_path.string(), input.status(), input.content())) {
+        if (args.dry_run) {
+            report_dry_run(messages.out, file_path, 0);
+        }
+        return;
+    }
+    if (!is_binary_input(file_path, input, messages)) {
+        process_input(args, file_path, input, chunk_jobs, queue, cache, messages);
+    }
+}
+
+// A file opened, and if small enough processed, ahead of its turn in ordered stdout mode
+struct PreparedFile {
+    FileMessages messages;
+    InputFile input;
+    bool opened = false;                // False if the file is skipped; `messages` says why
+    size_t unchanged_size = 0;          // Leading bytes of the content that go out as they are
+    std::optional<std::string> output;  // Processed content after them, if it was buffered
+};
+
+// Files up to this size are processed into memory ahead of their turn; larger ones, and anything
+// that is not mapped, are processed straight to stdout when they reach the head of the queue
+constexpr size_t MAX_BUFFERED_FILE_SIZE = PARALLEL_CHUNK_SIZE;
+
+auto prepare_file(const Arguments& args, const fs::path& file_path) -> PreparedFile {
+    PreparedFile prepared;
+    if (file_path == "-") {
+        return prepared;  // Standard input is only read when its turn comes
+    }
+    prepared.opened = open_input(file_path, prepared.input, prepared.messages) &&
+                      !is_binary_input(file_path, prepared.input, prepared.messages);
+    std::string_view content = prepared.input.content();
+    if (prepared.opened && prepared.input.isMapped() && content.size() <= MAX_BUFFERED_FILE_SIZE) {
+        // Only the part from the first change on is buffered; the rest is written from the mapping
+        size_t first_change = findFirstChange(content, args.engine);
+        prepared.unchanged_size = std::min(first_change, content.size());
+        std::string output;
+        if (first_change != std::string_view::npos) {
+            output.reserve(content.size() - first_change);  // Output never outgrows the input
+            removeEmojisFromBlock(content.substr(first_change), true, output, args.engine);
+        }
+        prepared.output = std::move(output);
+    }
+    return prepared;
+}
+
+// True for files that nej itself writes: named temporary files, backups with the current
+// extension and any counter find_unique_backup_path appends to it, and the --cache file
+auto is_own_output(const Arguments& args, const std::string& path) -> bool {
+    std::string name = fs::path(path).filename().string();
+    if (!args.cache_path.empty() && name == fs::path(args.cache_path).filename()) {
+        std::error_code error;
+        if (fs::equivalent(path, args.cache_path, error)) {
+            return true;
+        }
+    }
+    const std::string& backup_extension = args.backup_extension;
+    auto ends_with = [&name](const std::string& suffix) {
+        return name.size() >= suffix.size() &&
+               name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+    };
+    if (ends_with(".nej_tmp")) {
+        return true;
+    }
+    if (backup_extension.empty()) {
+        return false;
+    }
+    // The extension itself may end in digits, so try every split of trailing digits into the end
+    // of the extension and a counter, starting with no counter at all
+    size_t counter_start = name.find_last_not_of("0123456789") + 1;
+    while (!ends_with(backup_extension)) {
+        if (name.size() == counter_start) {
+            return false;
+        }
+        name.pop_back();
+    }
+    return true;
+}
+
+// True if separate files are processed concurrently, which only happens in place and in dry
+// runs; output to stdout has to follow the order of the inputs
+auto processes_files_concurrently(const Arguments& args) -> bool {
+    return (args.in_place || args.dry_run) && args.jobs > 1;
+}
+
+// Queues one input, walking it first if it is a directory and -r is given. When files are
+// processed concurrently, their order does not matter and subdirectories are walked on the
+// workers too.
+void enqueue_input(const Arguments& args, const std::string& file_path_str, WorkQueue& queue) {
+    struct stat status {};
+    if (!args.recursive || file_path_str == "-" || stat(file_path_str.c_str(), &status) != 0 ||
+        !S_ISDIR(status.st_mode)) {
+        queue.push(file_path_str);
+        return;
+    }
+
+    walkDirectory(
+        file_path_str, args.walk_filter,
+        [&args, &queue](const std::string& path) {
+            if (!is_own_output(args, path)) {
+                queue.push(path);
+            }
+        },
+        [](const std::string& path, int error) {
+            FileMessages messages;
+            messages.err << "Error: Could not read directory " << fs::path(path) << ": "
+                         << std::strerror(error) << "\n";
+            flush_messages(messages);
+        },
+        processes_files_concurrently(args)
+            ? [&queue](std::function<void()> walk) { queue.push_walk(std::move(walk)); }
+            : WalkSubmitter());
+}
+
+// Queues the files named on the command line and then those listed by --files-from, as the list
+// is read, and closes the queue when done
+void enqueue_inputs(const Arguments& args, WorkQueue& queue) {
+    for (const auto& file_path_str : args.files) {
+        enqueue_input(args, file_path_str, queue);
+    }
+
+    if (!args.files_from.empty()) {
+        std::ifstream list_file;
+        if (args.files_from != "-") {
+            list_file.open(args.files_from, std::ios::binary);
+        }
+        std::istream& list = args.files_from == "-" ? std::cin : list_file;
+        if (!list) {
+            FileMessages messages;
+            messages.err << "Error: Could not open file list " << fs::path(args.files_from)
+                         << ": " << std::strerror(errno) << "\n";
+            flush_messages(messages);
+        }
+
+        std::string file_path_str;
+        while (std::getline(list, file_path_str, args.null_separated ? '\0' : '\n')) {
+            if (!file_path_str.empty()) {
+                enqueue_input(args, file_path_str, queue);
             }
         }
+    }
+    queue.close();
+}
 
-        // Reopen infile for line-by-line reading
-        infile.open(file_path);
-        if (!infile.is_open()) {
-            std::cerr << "Error: Could not re-open file for reading: " << file_path << "\n";
-            if (args.in_place) {
-                fs::remove(temp_file_path);  // Clean up temp file if created
+// Processes files concurrently for stdout mode while keeping their output in queue order. Up to
+// args.jobs files are prepared ahead of the one being written, which bounds the memory held in
+// buffered outputs however long the file at the head takes.
+void process_files_in_order(const Arguments& args, WorkQueue& queue) {
+    std::deque<std::pair<fs::path, std::future<PreparedFile>>> in_flight;
+    while (true) {
+        // Only wait for a path when nothing is in flight; a walk or a file list may be slow to
+        // deliver the next one, and a finished file must not be held back behind it
+        while (in_flight.size() < args.jobs) {
+            std::optional<WorkQueue::Item> item = in_flight.empty() ? queue.pop() : queue.try_pop();
+            if (!item) {
+                break;
             }
-            continue;
+            auto prepared = std::async(std::launch::async | std::launch::deferred, prepare_file,
+                                       std::cref(args), fs::path(item->path));
+            in_flight.emplace_back(item->path, std::move(prepared));
+        }
+        if (in_flight.empty()) {
+            return;
         }
 
-        while (std::getline(infile, line)) {
-            auto [processed_line, removed_emoji_count] = removeEmojis(line);
-            total_removed_emoji_count += removed_emoji_count;
+        fs::path file_path = std::move(in_flight.front().first);
+        PreparedFile prepared = in_flight.front().second.get();
+        in_flight.pop_front();
 
-            if (!args.dry_run) {
-                if (args.in_place) {
-                    temp_outfile << processed_line << '\n';
-                } else {
-                    std::cout << processed_line << '\n';
-                }
+        if (prepared.output) {
+            std::string_view content = prepared.input.content();
+            if (!writeAll(STDOUT_FILENO, content.substr(0, prepared.unchanged_size)) ||
+                !writeAll(STDOUT_FILENO, *prepared.output)) {
+                prepared.messages.err << "Error: Could not process " << file_path << ": "
+                                      << std::strerror(errno) << "\n";
             }
+        } else if (prepared.opened) {
+            process_input(args, file_path, prepared.input, args.jobs, nullptr, nullptr,
+                          prepared.messages);
+        } else if (file_path == "-") {
+            process_standard_input(args, prepared.messages);
         }
-        infile.close();  // Close input file after processing
+        flush_messages(prepared.messages);
+    }
+}
 
-        if (args.in_place) {
-            temp_outfile.close();  // Close temp output file
+// Processes the files on up to args.jobs threads. Each worker takes the next item from the queue
+// and keeps its own buffers and output file; only the finished messages of a file are serialized.
+// Large files are split into chunks that idle workers take over, or, with a single worker, that
+// get threads of their own. Several files written to stdout go through process_files_in_order.
+void process_files(const Arguments& args, WorkQueue& queue, CleanCache* cache) {
+    // A directory walk or a file list may yield any number of files
+    size_t file_count =
+        args.recursive || !args.files_from.empty() ? args.jobs : args.files.size();
+    if (!args.in_place && !args.dry_run && args.jobs > 1 && file_count > 1) {
+        process_files_in_order(args, queue);
+        return;
+    }
+
+    size_t thread_count = std::min<size_t>(args.jobs, file_count);
+    WorkQueue* chunk_queue = thread_count > 1 ? &queue : nullptr;
 
-            if (!fs::exists(temp_file_path)) {
-                std::cerr << "Error: Temporary file was not created or is empty: " << temp_file_path
-                          << "\n";
+    auto worker = [&args, &queue, chunk_queue, cache]() {
+        while (std::optional<WorkQueue::Item> item = queue.pop()) {
+            if (item->task) {
+                item->task();
                 continue;
             }
+            FileMessages messages;
+            process_file(args, item->path, args.jobs, chunk_queue, cache, messages);
+            flush_messages(messages);
+        }
+    };
 
-            std::error_code ec;
-            fs::path backup_path;
-
-            // Create backup only if backup extension is provided
-            if (!args.backup_extension.empty()) {
-                auto find_unique_backup_path = [](const fs::path& base_path,
-                                                  const std::string& extension) -> fs::path {
-                    std::function<fs::path(const fs::path&, const std::string&, int)> find_path =
-                        [&find_path](const fs::path& base, const std::string& ext,
-                                     int counter) -> fs::path {
-                        auto candidate = base;
-                        candidate += ext + (counter == 0 ? "" : std::to_string(counter));
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < thread_count; ++t) {
+        try {
+            workers.emplace_back(worker);
+        } catch (const std::system_error&) {
+            break;  // Carry on with the threads that could be started
+        }
+    }
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+}
 
-                        if (!fs::exists(candidate)) {
-                            return candidate;  // Base case
-                        }
+auto main(int argc, char** argv) noexcept -> int {
+    Arguments args = parse_arguments(argc, argv);
+    
+    if (args.help) {
+        show_help(argv[0]);
+        return 0;
+    }
 
-                        // Tail call - nothing happens after this return
-                        return find_path(base, ext, counter + 1);
-                    };
+    if (args.compact && (!args.in_place || !args.backup_extension.empty())) {
+        std::cerr << "Error: --compact requires -i without a backup extension\n";
+        return 1;
+    }
 
-                    return find_path(base_path, extension, 0);
-                };
+    // Standard input cannot be edited in place, so -i needs files to work on
+    if (args.in_place && !args.dry_run && args.files.empty() && args.files_from.empty() &&
+        !args.recursive) {
+        std::cerr << "Error: No input files specified\n";
+        std::cerr << "Try '" << argv[0] << " --help' for more information.\n";
+        return 1;
+    }
+    if (args.in_place && !args.dry_run &&
+        std::find(args.files.begin(), args.files.end(), "-") != args.files.end()) {
+        std::cerr << "Error: Cannot edit standard input in place\n";
+        return 1;
+    }
 
-                backup_path = find_unique_backup_path(file_path, args.backup_extension);
+    const WalkFilter& walk_filter = args.walk_filter;
+    if (!args.recursive && (!walk_filter.include.empty() || !walk_filter.exclude.empty())) {
+        std::cerr << "Error: --include and --exclude require -r\n";
+        return 1;
+    }
 
-                fs::rename(file_path, backup_path, ec);
-                if (ec) {
-                    std::cerr << "Error: Could not create backup file for " << file_path << ": "
-                              << ec.message() << "\n";
-                    fs::remove(temp_file_path);
-                    continue;
-                }
-            } else {
-                // No backup - just remove the original file
-                fs::remove(file_path, ec);
-                if (ec) {
-                    std::cerr << "Error: Could not remove original file " << file_path << ": "
-                              << ec.message() << "\n";
-                    fs::remove(temp_file_path);
-                    continue;
-                }
-            }
+    // --dry-run only reports, so it never touches files even when combined with -i
+    if (args.dry_run) {
+        args.in_place = false;
+    }
+    
+    if (!args.cache_path.empty() && !args.in_place && !args.dry_run) {
+        std::cerr << "Error: --cache requires -i or --dry-run\n";
+        return 1;
+    }
 
-            fs::rename(temp_file_path, file_path, ec);
-            if (ec) {
-                std::cerr << "Error: Could not rename temporary file to original: " << file_path
-                          << ": " << ec.message() << "\n";
-                if (!args.backup_extension.empty()) {
-                    fs::rename(backup_path, file_path, ec);
-                    if (ec) {
-                        std::cerr << "Error: Could not restore original file from backup "
-                                  << backup_path << ": " << ec.message() << "\n";
-                    }
-                }
-                fs::remove(temp_file_path);
-                continue;
-            }
+    // The cache only ever lets files be skipped, so one that cannot be read is not fatal
+    std::optional<CleanCache> cache;
+    if (!args.cache_path.empty()) {
+        cache.emplace();
+        if (!cache->load(args.cache_path)) {
+            std::cerr << "Warning: Could not read cache " << fs::path(args.cache_path) << ": "
+                      << std::strerror(errno) << "\n";
         }
+    }
 
-        if (args.dry_run) {
-            if (total_removed_emoji_count > 0) {
-                std::cout << "File: " << file_path
-                          << ", Emojis removed: " << total_removed_emoji_count << "\n";
-            } else {
-                std::cout << "File: " << file_path << ", No emojis found.\n";
-            }
+    bool reads_standard_input =
+        std::find(args.files.begin(), args.files.end(), "-") != args.files.end();
+    if (args.files_from == "-" && reads_standard_input) {
+        std::cerr << "Error: Standard input cannot hold both the file list and an input\n";
+        return 1;
+    }
+
+    // With no files, act as a filter from standard input to standard output, or sweep the
+    // current directory with -r
+    if (args.files.empty() && args.files_from.empty()) {
+        args.files.emplace_back(args.recursive ? "." : "-");
+    }
+
+    // Walking and reading the file list run on their own thread, so that files are processed
+    // while the rest of the tree or list is still being read
+    // Where separate files are processed concurrently, starting the largest first keeps a big
+    // file from being left to run alone at the end
+    WorkQueue queue(processes_files_concurrently(args));
+    std::thread producer;
+    if (args.recursive || !args.files_from.empty()) {
+        try {
+            producer = std::thread(enqueue_inputs, std::cref(args), std::ref(queue));
+        } catch (const std::system_error&) {
+            enqueue_inputs(args, queue);
         }
+    } else {
+        enqueue_inputs(args, queue);
+    }
+
+    process_files(args, queue, cache ? &*cache : nullptr);
+    if (producer.joinable()) {
+        producer.join();
+    }
+
+    if (cache && !cache->save()) {
+        std::cerr << "Error: Could not write cache " << fs::path(args.cache_path) << ": "
+                  << std::strerror(errno) << "\n";
     }
 
     return 0;
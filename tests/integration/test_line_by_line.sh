@@ -124,6 +124,232 @@ else
     exit 1
 fi
 
+# --- Test 4: Missing Final Newline Is Preserved ---
+echo -n "Test 4: Missing final newline preserved... "
+INPUT_FILE_NO_NEWLINE="${TEST_DIR}/input_no_newline.txt"
+printf 'first 👋\nlast line 🚀' > "${INPUT_FILE_NO_NEWLINE}"
+
+if [[ "$("${NEJ_BIN}" "${INPUT_FILE_NO_NEWLINE}" | od -c)" == "$(printf 'first  \nlast line  ' | od -c)" ]]; then
+    echo -e "${GREEN}PASS${NC}"
+else
+    echo -e "${RED}FAIL${NC}"
+    echo "Output was not byte-exact:"
+    "${NEJ_BIN}" "${INPUT_FILE_NO_NEWLINE}" | od -c
+    exit 1
+fi
+
+# --- Test 5: Standard Input Filter ---
+echo -n "Test 5: Standard input filter... "
+STDIN_OUTPUT=$(printf 'piped 👋 text\n' | "${NEJ_BIN}")
+STDIN_DASH_OUTPUT=$(printf 'piped ✨ text\n' | "${NEJ_BIN}" -)
+# Standard input cannot be edited in place
+IN_PLACE_STATUS=0
+printf 'piped 👋 text\n' | "${NEJ_BIN}" -i > /dev/null 2>&1 || IN_PLACE_STATUS=$?
+IN_PLACE_DASH_STATUS=0
+printf 'piped 👋 text\n' | "${NEJ_BIN}" -i - > /dev/null 2>&1 || IN_PLACE_DASH_STATUS=$?
+
+if [[ "${STDIN_OUTPUT}" == "piped   text" && "${STDIN_DASH_OUTPUT}" == "piped   text" &&
+      "${IN_PLACE_STATUS}" -eq 1 && "${IN_PLACE_DASH_STATUS}" -eq 1 ]]; then
+    echo -e "${GREEN}PASS${NC}"
+else
+    echo -e "${RED}FAIL${NC}"
+    echo "Actual (no arguments): '${STDIN_OUTPUT}'"
+    echo "Actual ('-'):          '${STDIN_DASH_OUTPUT}'"
+    echo "Exit status of -i:     ${IN_PLACE_STATUS}"
+    echo "Exit status of -i -:   ${IN_PLACE_DASH_STATUS}"
+    exit 1
+fi
+
+# --- Test 6: Unchanged Files Are Not Rewritten ---
+echo -n "Test 6: Unchanged file left untouched by -i... "
+INPUT_FILE_CLEAN="${TEST_DIR}/input_clean.txt"
+printf 'Nothing to remove here.\n' > "${INPUT_FILE_CLEAN}"
+touch -d '2001-01-01 00:00:00' "${INPUT_FILE_CLEAN}"
+MTIME_BEFORE=$(stat -c %Y "${INPUT_FILE_CLEAN}")
+INODE_BEFORE=$(stat -c %i "${INPUT_FILE_CLEAN}")
+
+"${NEJ_BIN}" -i.bak "${INPUT_FILE_CLEAN}"
+
+if [[ "$(stat -c %Y "${INPUT_FILE_CLEAN}")" == "${MTIME_BEFORE}" &&
+      "$(stat -c %i "${INPUT_FILE_CLEAN}")" == "${INODE_BEFORE}" &&
+      ! -e "${INPUT_FILE_CLEAN}.bak" ]]; then
+    echo -e "${GREEN}PASS${NC}"
+else
+    echo -e "${RED}FAIL${NC}"
+    echo "File was rewritten or a backup was created."
+    exit 1
+fi
+
+# --- Test 7: In-Place Compaction ---
+echo -n "Test 7: In-place compaction without a temporary file... "
+INPUT_FILE_COMPACT="${TEST_DIR}/input_compact.txt"
+cat <<EOF > "${INPUT_FILE_COMPACT}"
+Hello world!
+This line has an emoji: 👋
+And one more with multiple: ✨🐛📝
+EOF
+INODE_BEFORE=$(stat -c %i "${INPUT_FILE_COMPACT}")
+
+"${NEJ_BIN}" -i --compact "${INPUT_FILE_COMPACT}"
+
+EXPECTED_COMPACT=$(printf 'Hello world!\nThis line has an emoji:  \nAnd one more with multiple:    ')
+if [[ "$(cat "${INPUT_FILE_COMPACT}")" == "${EXPECTED_COMPACT}" &&
+      "$(stat -c %i "${INPUT_FILE_COMPACT}")" == "${INODE_BEFORE}" ]]; then
+    echo -e "${GREEN}PASS${NC}"
+else
+    echo -e "${RED}FAIL${NC}"
+    echo "Actual content:"
+    cat "${INPUT_FILE_COMPACT}"
+    exit 1
+fi
+
+# --- Test 8: Parallel In-Place Editing ---
+echo -n "Test 8: Parallel in-place editing with -j... "
+for n in 1 2 3 4 5; do
+    printf 'file %s 👋\nplain line\n' "${n}" > "${TEST_DIR}/input_jobs_${n}.txt"
+done
+
+"${NEJ_BIN}" -j 3 -i.bak "${TEST_DIR}"/input_jobs_*.txt
+
+JOBS_OK=true
+for n in 1 2 3 4 5; do
+    if [[ "$(cat "${TEST_DIR}/input_jobs_${n}.txt")" != "$(printf 'file %s  \nplain line' "${n}")" ||
+          "$(cat "${TEST_DIR}/input_jobs_${n}.txt.bak")" != "$(printf 'file %s 👋\nplain line' "${n}")" ]]; then
+        JOBS_OK=false
+    fi
+done
+if ${JOBS_OK}; then
+    echo -e "${GREEN}PASS${NC}"
+else
+    echo -e "${RED}FAIL${NC}"
+    exit 1
+fi
+
+# --- Test 9: Parallel Output Keeps Argument Order ---
+echo -n "Test 9: Parallel output to stdout keeps argument order... "
+for n in 1 2 3 4 5; do
+    printf 'stdout %s ✨\n' "${n}" > "${TEST_DIR}/input_order_${n}.txt"
+done
+
+ACTUAL_ORDER=$("${NEJ_BIN}" -j 3 "${TEST_DIR}"/input_order_{5,1,4,2,3}.txt)
+EXPECTED_ORDER=$(printf 'stdout %s  \n' 5 1 4 2 3)
+if [[ "${ACTUAL_ORDER}" == "${EXPECTED_ORDER}" ]]; then
+    echo -e "${GREEN}PASS${NC}"
+else
+    echo -e "${RED}FAIL${NC}"
+    echo "Actual output:"
+    echo "${ACTUAL_ORDER}"
+    exit 1
+fi
+
+# --- Test 10: Recursive In-Place Editing ---
+echo -n "Test 10: Recursive in-place editing of a tree... "
+TREE_DIR="${TEST_DIR}/tree"
+mkdir -p "${TREE_DIR}/sub/deeper" "${TREE_DIR}/excluded"
+printf 'top 👋\n' > "${TREE_DIR}/top.txt"
+printf 'deep 👋\n' > "${TREE_DIR}/sub/deeper/deep.txt"
+printf 'markdown 👋\n' > "${TREE_DIR}/sub/notes.md"
+printf 'excluded 👋\n' > "${TREE_DIR}/excluded/skip.txt"
+printf 'old backup 👋\n' > "${TREE_DIR}/sub/old.txt.v2"
+printf 'older backup 👋\n' > "${TREE_DIR}/sub/old.txt.v21"
+
+"${NEJ_BIN}" -r -i.v2 --include '*.txt' --include '*.v2*' --exclude excluded "${TREE_DIR}"
+
+if [[ "$(cat "${TREE_DIR}/top.txt")" == "top  " &&
+      "$(cat "${TREE_DIR}/sub/deeper/deep.txt")" == "deep  " &&
+      "$(cat "${TREE_DIR}/sub/notes.md")" == "markdown 👋" &&
+      "$(cat "${TREE_DIR}/excluded/skip.txt")" == "excluded 👋" &&
+      "$(cat "${TREE_DIR}/sub/old.txt.v2")" == "old backup 👋" &&
+      "$(cat "${TREE_DIR}/sub/old.txt.v21")" == "older backup 👋" &&
+      ! -e "${TREE_DIR}/sub/old.txt.v2.v2" ]]; then
+    echo -e "${GREEN}PASS${NC}"
+else
+    echo -e "${RED}FAIL${NC}"
+    find "${TREE_DIR}" -type f -exec sh -c 'echo "$1: $(cat "$1")"' _ {} \;
+    exit 1
+fi
+
+# --- Test 11: Parallel Recursive Dry Run ---
+echo -n "Test 11: Recursive dry run walking subdirectories on -j workers... "
+WIDE_DIR="${TEST_DIR}/wide"
+for d in 1 2 3 4 5 6; do
+    mkdir -p "${WIDE_DIR}/d${d}/inner"
+    printf 'outer %s 👋\n' "${d}" > "${WIDE_DIR}/d${d}/outer.txt"
+    printf 'inner %s\n' "${d}" > "${WIDE_DIR}/d${d}/inner/inner.txt"
+done
+
+ACTUAL_WIDE=$("${NEJ_BIN}" -r -j 4 --dry-run "${WIDE_DIR}" | sort)
+EXPECTED_WIDE=$(for d in 1 2 3 4 5 6; do
+    printf 'File: "%s", No emojis found.\n' "${WIDE_DIR}/d${d}/inner/inner.txt"
+    printf 'File: "%s", Emojis removed: 1\n' "${WIDE_DIR}/d${d}/outer.txt"
+done | sort)
+if [[ "${ACTUAL_WIDE}" == "${EXPECTED_WIDE}" ]]; then
+    echo -e "${GREEN}PASS${NC}"
+else
+    echo -e "${RED}FAIL${NC}"
+    echo "Actual output:"
+    echo "${ACTUAL_WIDE}"
+    exit 1
+fi
+
+# --- Test 12: NUL-Separated File List ---
+echo -n "Test 12: File list from standard input with -0... "
+LIST_FILE_1="${TEST_DIR}/listed file.txt"
+LIST_FILE_2="${TEST_DIR}/listed_other.txt"
+printf 'first 👋\n' > "${LIST_FILE_1}"
+printf 'second ✨\n' > "${LIST_FILE_2}"
+
+ACTUAL_LISTED=$(printf '%s\0' "${LIST_FILE_1}" "${LIST_FILE_2}" | "${NEJ_BIN}" -0 --files-from -)
+EXPECTED_LISTED=$(printf 'first  \nsecond  ')
+if [[ "${ACTUAL_LISTED}" == "${EXPECTED_LISTED}" ]]; then
+    echo -e "${GREEN}PASS${NC}"
+else
+    echo -e "${RED}FAIL${NC}"
+    echo "Actual output:"
+    echo "${ACTUAL_LISTED}"
+    exit 1
+fi
+
+# --- Test 13: Cache Of Clean Files ---
+echo -n "Test 13: Clean files recorded in the cache are skipped... "
+CACHE_DIR="${TEST_DIR}/cached"
+CACHE_FILE="${CACHE_DIR}/.nej-cache"
+mkdir -p "${CACHE_DIR}"
+printf 'clean\n' > "${CACHE_DIR}/clean.txt"
+printf 'dirty 👋\n' > "${CACHE_DIR}/dirty.txt"
+# Files modified moments ago are never recorded
+touch -d '1 hour ago' "${CACHE_DIR}/clean.txt" "${CACHE_DIR}/dirty.txt"
+touch -r "${CACHE_DIR}/clean.txt" "${TEST_DIR}/clean_mtime"
+
+"${NEJ_BIN}" -r -i --cache "${CACHE_FILE}" "${CACHE_DIR}"
+
+# Change the clean file behind the cache's back, keeping its inode, size and mtime
+printf 'c👋\n' 1<> "${CACHE_DIR}/clean.txt"
+touch -r "${TEST_DIR}/clean_mtime" "${CACHE_DIR}/clean.txt"
+ACTUAL_CACHED=$("${NEJ_BIN}" -r --dry-run --cache "${CACHE_FILE}" "${CACHE_DIR}")
+EXPECTED_CACHED=$(printf 'File: "%s", No emojis found.\nFile: "%s", No emojis found.' \
+    "${CACHE_DIR}/clean.txt" "${CACHE_DIR}/dirty.txt")
+if [[ "${ACTUAL_CACHED}" == "${EXPECTED_CACHED}" ]] &&
+   grep -q "/clean.txt$" "${CACHE_FILE}" && ! grep -q "/dirty.txt$" "${CACHE_FILE}"; then
+    echo -e "${GREEN}PASS${NC}"
+else
+    echo -e "${RED}FAIL${NC}"
+    echo "Actual output:"
+    echo "${ACTUAL_CACHED}"
+    cat "${CACHE_FILE}"
+    exit 1
+fi
+
+# --- Test 14: No Temporary Files Left Behind ---
+echo -n "Test 14: In-place runs leave no temporary files... "
+if compgen -G "${TEST_DIR}/*.nej_tmp" > /dev/null; then
+    echo -e "${RED}FAIL${NC}"
+    ls -la "${TEST_DIR}"
+    exit 1
+else
+    echo -e "${GREEN}PASS${NC}"
+fi
+
 # --- Test Cleanup ---
 echo "Cleaning up test directory: ${TEST_DIR}"
 rm -rf "${TEST_DIR}"
@@ -1,4 +1,13 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+#include "../src/clean_cache.h"
 #include "../src/core.h"  // Include core functions
+#include "../src/directory_walk.h"
+#include "../src/file_io.h"
 #include "gtest/gtest.h"
 
 // Test fixture for removeEmojis function
@@ -44,6 +53,380 @@ TEST_F(RemoveEmojisTest, DoesNotRemoveNonEmojis) {
     ASSERT_EQ(removeEmojis(non_emojis).first, non_emojis);
 }
 
+TEST_F(RemoveEmojisTest, RemovesMultiCodepointSequenceAsOne) {
+    // Family (man, woman, girl, boy) joined with ZWJ is a single emoji sequence
+    std::string family = "\U0001F468\u200D\U0001F469\u200D\U0001F467\u200D\U0001F466";
+    ASSERT_EQ(removeEmojis("a" + family + "b").first, "a b");
+}
+
+TEST_F(RemoveEmojisTest, HandlesLongLineWithoutEmojis) {
+    // Lookahead must stop as soon as no sequence can continue, or this line is quadratic
+    std::string long_line(1 << 20, 'x');
+    ASSERT_EQ(removeEmojis(long_line).first, long_line);
+}
+
+TEST_F(RemoveEmojisTest, ByteEngineMatchesCodePointEngine) {
+    const std::string inputs[] = {
+        "Hello 👋 World!",
+        "✨🐛📝",
+        "#\uFE0F\u20E3 keycap and plain # sign",
+        "\u65E5\u672C\u8A9E \U0001F468\u200D\U0001F469\u200D\U0001F467 \u0436",
+        "stray \xE9 Latin-1 \xF0\x9F truncated \xED\xA0\x80 surrogate \xC0\xAF overlong",
+    };
+    for (const auto& input : inputs) {
+        ASSERT_EQ(removeEmojis(input, MatchEngine::Byte),
+                  removeEmojis(input, MatchEngine::CodePoint))
+            << input;
+    }
+}
+
+TEST_F(RemoveEmojisTest, ReplacesMalformedBytes) {
+    // Stray Latin-1 bytes, a lone continuation byte and an emoji cut short before its last byte
+    ASSERT_EQ(removeEmojis("caf\xE9 \x80 \xF0\x9F\x9A").first, "caf? ? ???");
+}
+
+TEST_F(RemoveEmojisTest, ByteEngineReplacesMalformedBytes) {
+    ASSERT_EQ(removeEmojis("a\xFF" "b\xE2\x9C", MatchEngine::Byte).first, "a?b??");
+}
+
+TEST_F(RemoveEmojisTest, KeepsKeycapAtEndOfAsciiRun) {
+    for (auto engine : {MatchEngine::CodePoint, MatchEngine::Byte}) {
+        ASSERT_EQ(removeEmojis("abc#\uFE0F\u20E3def", engine).first, "abc def");
+        ASSERT_EQ(removeEmojis("abc#", engine).first, "abc#");
+    }
+}
+
+TEST_F(RemoveEmojisTest, RemovesEmojiAtEveryOffsetOfLongAsciiRun) {
+    // Covers emoji positions on both sides of the 16- and 32-byte vector boundaries
+    for (size_t offset = 0; offset < 70; ++offset) {
+        std::string input = std::string(offset, 'a') + "🚀" + std::string(40, 'b');
+        std::string expected = std::string(offset, 'a') + " " + std::string(40, 'b');
+        for (auto engine : {MatchEngine::CodePoint, MatchEngine::Byte}) {
+            ASSERT_EQ(removeEmojis(input, engine).first, expected) << offset;
+        }
+    }
+}
+
+TEST_F(RemoveEmojisTest, PreservesNonEmojiMultilingualText) {
+    std::string text =
+        "\u65E5\u672C\u8A9E \u041F\u0440\u0438\u0432\u0435\u0442 caf\u00E9 \u00A9 \u2122";
+    for (auto engine : {MatchEngine::CodePoint, MatchEngine::Byte}) {
+        ASSERT_EQ(removeEmojis(text, engine).first, text);
+    }
+}
+
+TEST(CountEmojisTest, CountsWithoutChangingAnything) {
+    for (auto engine : {MatchEngine::CodePoint, MatchEngine::Byte}) {
+        ASSERT_EQ(countEmojis("plain text", engine), 0U);
+        ASSERT_EQ(countEmojis("Text with \u2728 and \U0001F41B, caf\xE9", engine), 2U);
+        ASSERT_EQ(countEmojis("\u2728\U0001F41B\U0001F4DD", engine), 3U);
+    }
+}
+
+TEST(RemoveEmojisIfPresentTest, ReportsUnchangedInputWithoutCopying) {
+    EmojiRemoval removal = removeEmojisIfPresent("plain text");
+    ASSERT_FALSE(removal.changed);
+    ASSERT_TRUE(removal.text.empty());
+    ASSERT_EQ(removal.removed_emoji_count, 0);
+}
+
+TEST(RemoveEmojisIfPresentTest, RemovesEmojisAndReplacesMalformedBytes) {
+    EmojiRemoval removal = removeEmojisIfPresent("a \u2728 b");
+    ASSERT_TRUE(removal.changed);
+    ASSERT_EQ(removal.text, "a   b");
+    ASSERT_EQ(removal.removed_emoji_count, 1);
+
+    // A malformed byte changes the output even though no emoji was removed
+    removal = removeEmojisIfPresent("caf\xE9");
+    ASSERT_TRUE(removal.changed);
+    ASSERT_EQ(removal.text, "caf?");
+    ASSERT_EQ(removal.removed_emoji_count, 0);
+}
+
+TEST(BlockProcessingTest, SplittingInputAnywhereGivesTheSameOutput) {
+    const std::string input =
+        "line 1 \U0001F44B\nkeycap #\uFE0F\u20E3 and \U0001F468\u200D\U0001F469\u200D\U0001F467"
+        " caf\xE9\n\u65E5\u672C \u2728#";
+    for (auto engine : {MatchEngine::CodePoint, MatchEngine::Byte}) {
+        const auto whole = removeEmojis(input, engine);
+        for (size_t split = 0; split <= input.size(); ++split) {
+            std::string output;
+            std::string pending = input.substr(0, split);
+            BlockResult first = removeEmojisFromBlock(pending, false, output, engine);
+            pending = pending.substr(first.consumed) + input.substr(split);
+            BlockResult last = removeEmojisFromBlock(pending, true, output, engine);
+
+            ASSERT_EQ(last.consumed, pending.size());
+            ASSERT_EQ(output, whole.first) << split;
+            ASSERT_EQ(first.removed_emoji_count + last.removed_emoji_count,
+                      static_cast<uint64_t>(whole.second));
+            ASSERT_EQ(countEmojisInBlock(input, true, engine).removed_emoji_count,
+                      static_cast<uint64_t>(whole.second));
+        }
+    }
+}
+
+TEST(FindSafeSplitTest, CuttingAtSafeSplitsGivesTheSameOutput) {
+    const std::string input =
+        "line 1 \U0001F44B\nkeycap #\uFE0F\u20E3 and \U0001F468\u200D\U0001F469\u200D\U0001F467"
+        " caf\xE9\n\u65E5\u672C \u2728#";
+    for (auto engine : {MatchEngine::CodePoint, MatchEngine::Byte}) {
+        const auto whole = removeEmojis(input, engine);
+        for (size_t pos = 0; pos <= input.size(); ++pos) {
+            size_t split = findSafeSplit(input, pos);
+            ASSERT_GE(split, pos);
+            ASSERT_EQ(removeEmojis(input.substr(0, split), engine).first +
+                          removeEmojis(input.substr(split), engine).first,
+                      whole.first)
+                << split;
+        }
+    }
+    ASSERT_EQ(findSafeSplit("#\uFE0F\u20E3 x", 1), 8U);
+    ASSERT_EQ(findSafeSplit("\u65E5\u672C", 1), 6U);
+}
+
+TEST(EmojiStreamFilterTest, ByteAtATimeMatchesWholeInput) {
+    const std::string input =
+        "a \U0001F468\u200D\U0001F469\u200D\U0001F467\u200D\U0001F466 b #\uFE0F\u20E3 "
+        "caf\xE9 \xF0\x9F \u2728";
+    for (auto engine : {MatchEngine::CodePoint, MatchEngine::Byte}) {
+        EmojiStreamFilter filter(engine);
+        std::string output;
+        for (char byte : input) {
+            filter.feed(std::string_view(&byte, 1), &output);
+            ASSERT_LE(filter.pendingSize(), 64U);
+        }
+        filter.finish(&output);
+
+        const auto whole = removeEmojis(input, engine);
+        ASSERT_EQ(output, whole.first);
+        ASSERT_EQ(filter.removedEmojiCount(), static_cast<uint64_t>(whole.second));
+    }
+}
+
+TEST(EmojiStreamFilterTest, PassingUnchangedPrefixThroughMatchesWholeInput) {
+    const std::string input =
+        "plain text \U0001F44B then #️⃣ and caf\xE9 \xF0\x9F ✨ tail";
+    for (auto engine : {MatchEngine::CodePoint, MatchEngine::Byte}) {
+        for (size_t chunk_size = 1; chunk_size <= 8; ++chunk_size) {
+            EmojiStreamFilter filter(engine);
+            std::string output;
+            for (size_t pos = 0; pos < input.size(); pos += chunk_size) {
+                std::string_view chunk = std::string_view(input).substr(pos, chunk_size);
+                size_t unchanged = filter.unchangedPrefix(chunk);
+                output.append(chunk.substr(0, unchanged));
+                filter.feed(chunk.substr(unchanged), &output);
+            }
+            filter.finish(&output);
+            ASSERT_EQ(output, removeEmojis(input, engine).first);
+        }
+    }
+}
+
+TEST(EmojiStreamFilterTest, LongLineKeepsMemoryBounded) {
+    // One long line whose emoji keep landing across chunk boundaries
+    std::string line;
+    for (int i = 0; i < 256; ++i) {
+        line += std::string(4094, 'x') + "\U0001F680";
+    }
+
+    EmojiStreamFilter filter;
+    std::string output;
+    for (size_t pos = 0; pos < line.size(); pos += 4096) {
+        output.clear();
+        filter.feed(std::string_view(line).substr(pos, 4096), &output);
+        ASSERT_LE(filter.pendingSize(), 64U);
+    }
+    filter.finish(nullptr);
+    ASSERT_EQ(filter.removedEmojiCount(), 256U);
+}
+
+TEST(FindFirstChangeTest, ReportsOffsetOfFirstEmojiOrMalformedByte) {
+    for (auto engine : {MatchEngine::CodePoint, MatchEngine::Byte}) {
+        ASSERT_EQ(findFirstChange("no emoji here", engine), std::string_view::npos);
+        ASSERT_EQ(findFirstChange("abc \u2728 def \U0001F41B", engine), 4U);
+        ASSERT_EQ(findFirstChange("caf\xE9 \u2728", engine), 3U);
+    }
+}
+
+TEST(FilterBufferParallelTest, MatchesSequentialOutputAcrossManyChunks) {
+    std::string input;
+    while (input.size() < 3 * PARALLEL_CHUNK_SIZE) {
+        input += "chat line \U0001F44B with keycap #\uFE0F\u20E3 and caf\xE9\n";
+        input += std::string(997, 'x');
+    }
+    const auto whole = removeEmojis(input);
+
+    FILE* output_file = std::tmpfile();
+    ASSERT_NE(output_file, nullptr);
+    uint64_t removed_emoji_count = 0;
+    ASSERT_TRUE(filterBufferParallel(input, fileno(output_file), MatchEngine::CodePoint, 4,
+                                     removed_emoji_count));
+    ASSERT_EQ(removed_emoji_count, static_cast<uint64_t>(whole.second));
+
+    std::string output(whole.first.size() + 1, '\0');
+    std::rewind(output_file);
+    output.resize(std::fread(output.data(), 1, output.size(), output_file));
+    std::fclose(output_file);
+    ASSERT_EQ(output, whole.first);
+
+    uint64_t counted = 0;
+    ASSERT_TRUE(filterBufferParallel(input, -1, MatchEngine::Byte, 3, counted));
+    ASSERT_EQ(counted, static_cast<uint64_t>(whole.second));
+
+    // Chunks handed to a submitter that never runs them are processed by the caller, and running
+    // them afterwards does nothing
+    std::vector<std::function<void()>> submitted;
+    uint64_t counted_alone = 0;
+    ASSERT_TRUE(filterBufferParallel(
+        input, -1, MatchEngine::CodePoint, 4, counted_alone,
+        [&submitted](std::function<void()> task) { submitted.push_back(std::move(task)); }));
+    ASSERT_EQ(counted_alone, static_cast<uint64_t>(whole.second));
+    ASSERT_GT(submitted.size(), 1U);
+    for (auto& task : submitted) {
+        task();
+    }
+}
+
+TEST(WalkDirectoryTest, VisitsSelectedFilesInNameOrder) {
+    namespace fs = std::filesystem;
+    const fs::path root = fs::temp_directory_path() / "nej_walk_test";
+    fs::remove_all(root);
+    fs::create_directories(root / "docs" / "deep");
+    fs::create_directories(root / "skip");
+    for (const char* name : {"b.txt", "a.md", "docs/c.txt", "docs/deep/d.txt", "skip/e.txt"}) {
+        std::ofstream(root / name) << "text\n";
+    }
+    fs::create_symlink(root / "b.txt", root / "docs" / "link.txt");
+
+    std::vector<std::string> visited;
+    walkDirectory(
+        root.string(), WalkFilter{{"*.txt"}, {"skip", "docs/deep"}},
+        [&visited](const std::string& path) {
+            visited.push_back(fs::path(path).lexically_relative(fs::temp_directory_path()));
+        },
+        [](const std::string& path, int) { FAIL() << path; });
+    fs::remove_all(root);
+
+    const std::vector<std::string> expected = {"nej_walk_test/b.txt", "nej_walk_test/docs/c.txt"};
+    ASSERT_EQ(visited, expected);
+}
+
+TEST(WalkDirectoryTest, WalksSubdirectoriesThroughSubmitter) {
+    namespace fs = std::filesystem;
+    const fs::path root = fs::temp_directory_path() / "nej_walk_submit_test";
+    fs::remove_all(root);
+    fs::create_directories(root / "a" / "deep");
+    fs::create_directories(root / "b");
+    fs::create_directories(root / "skip");
+    for (const char* name : {"top.txt", "a/x.txt", "a/deep/y.txt", "b/z.txt", "skip/s.txt"}) {
+        std::ofstream(root / name) << "text\n";
+    }
+
+    // Tasks run only after walkDirectory has returned, most recent first
+    std::vector<std::string> visited;
+    std::vector<std::function<void()>> tasks;
+    walkDirectory(
+        root.string(), WalkFilter{{}, {"skip"}},
+        [&visited](const std::string& path) {
+            visited.push_back(fs::path(path).lexically_relative(fs::temp_directory_path()));
+        },
+        [](const std::string& path, int) { FAIL() << path; },
+        [&tasks](std::function<void()> task) { tasks.push_back(std::move(task)); });
+    ASSERT_EQ(visited, std::vector<std::string>{"nej_walk_submit_test/top.txt"});
+    while (!tasks.empty()) {
+        std::function<void()> task = std::move(tasks.back());
+        tasks.pop_back();
+        task();
+    }
+    fs::remove_all(root);
+
+    std::sort(visited.begin(), visited.end());
+    const std::vector<std::string> expected = {
+        "nej_walk_submit_test/a/deep/y.txt", "nej_walk_submit_test/a/x.txt",
+        "nej_walk_submit_test/b/z.txt", "nej_walk_submit_test/top.txt"};
+    ASSERT_EQ(visited, expected);
+}
+
+TEST(CleanCacheTest, SkipsUnchangedFilesAcrossRuns) {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "nej_cache_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    const std::string file = (dir / "clean.txt").string();
+    const std::string cache_file = (dir / "cache").string();
+    std::ofstream(file) << "clean text\n";
+    // Freshly modified files are not recorded
+    fs::last_write_time(file, fs::file_time_type::clock::now() - std::chrono::hours(1));
+
+    auto status_of = [&file]() {
+        struct stat status {};
+        stat(file.c_str(), &status);
+        return status;
+    };
+    {
+        CleanCache cache;
+        ASSERT_TRUE(cache.load(cache_file));
+        ASSERT_FALSE(cache.isClean(file, status_of(), "clean text\n"));
+        cache.recordClean(file, status_of(), "clean text\n");
+        ASSERT_TRUE(cache.save());
+    }
+
+    CleanCache cache;
+    ASSERT_TRUE(cache.load(cache_file));
+    // Unchanged metadata is trusted without reading the content
+    ASSERT_TRUE(cache.isClean(file, status_of(), ""));
+    // A touched file is compared by hash, and forgotten once its content differs
+    fs::last_write_time(file, fs::file_time_type::clock::now() - std::chrono::minutes(30));
+    ASSERT_TRUE(cache.isClean(file, status_of(), "clean text\n"));
+    fs::last_write_time(file, fs::file_time_type::clock::now() - std::chrono::minutes(20));
+    ASSERT_FALSE(cache.isClean(file, status_of(), "dirty text\n"));
+    ASSERT_FALSE(cache.isClean(file, status_of(), "clean text\n"));
+    fs::remove_all(dir);
+}
+
+TEST(CleanCacheTest, DropsDeletedFilesOnSave) {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "nej_cache_prune_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    const std::string kept = (dir / "kept.txt").string();
+    const std::string deleted = (dir / "deleted.txt").string();
+    const std::string cache_file = (dir / "cache").string();
+    {
+        CleanCache cache;
+        ASSERT_TRUE(cache.load(cache_file));
+        for (const auto& file : {kept, deleted}) {
+            std::ofstream(file) << "clean text\n";
+            fs::last_write_time(file, fs::file_time_type::clock::now() - std::chrono::hours(1));
+            struct stat status {};
+            stat(file.c_str(), &status);
+            cache.recordClean(file, status, "clean text\n");
+        }
+        ASSERT_TRUE(cache.save());
+    }
+    fs::remove(deleted);
+
+    // A run that records nothing new still writes the cache back without the deleted file
+    {
+        CleanCache cache;
+        ASSERT_TRUE(cache.load(cache_file));
+        ASSERT_TRUE(cache.save());
+    }
+    std::ifstream cache_stream(cache_file);
+    std::string saved((std::istreambuf_iterator<char>(cache_stream)),
+                      std::istreambuf_iterator<char>());
+    ASSERT_NE(saved.find("kept.txt"), std::string::npos);
+    ASSERT_EQ(saved.find("deleted.txt"), std::string::npos);
+    fs::remove_all(dir);
+}
+
+TEST(IsBinaryContentTest, LooksForNullBytesInFirst4KB) {
+    ASSERT_FALSE(isBinaryContent("plain text \U0001F680"));
+    ASSERT_TRUE(isBinaryContent(std::string("ELF\0\1", 5)));
+    ASSERT_FALSE(isBinaryContent(std::string(4096, 'x') + std::string(1, '\0')));
+}
+
 auto main(int argc, char **argv) -> int {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();